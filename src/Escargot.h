@@ -338,11 +338,27 @@ typedef uint16_t ByteCodeRegisterIndex;
 #define FUNCTION_OBJECT_BYTECODE_SIZE_MAX 1024 * 1024 * 2
 #endif
 
+#ifndef STACK_TRACE_DEPTH_LIMIT_DEFAULT
+#define STACK_TRACE_DEPTH_LIMIT_DEFAULT 64
+#endif
+
 
 #ifndef ROPE_STRING_MIN_LENGTH
 #define ROPE_STRING_MIN_LENGTH 24
 #endif
 
+#ifndef ROPE_STRING_MAX_DEPTH
+#define ROPE_STRING_MAX_DEPTH 512
+#endif
+
+#ifndef ROPE_STRING_MAX_WALKED_NODE_COUNT
+#define ROPE_STRING_MAX_WALKED_NODE_COUNT 0xffff
+#endif
+
+#ifndef BY_NAME_RESOLUTION_CACHE_DEPTH_MAX
+#define BY_NAME_RESOLUTION_CACHE_DEPTH_MAX 8
+#endif
+
 #include "heap/Heap.h"
 #include "CheckedArithmetic.h"
 #include "runtime/String.h"
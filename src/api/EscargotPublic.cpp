@@ -38,6 +38,8 @@
 #include "runtime/ErrorObject.h"
 #include "runtime/DateObject.h"
 #include "runtime/StringObject.h"
+#include "runtime/ExternalString.h"
+#include "runtime/PropertyHandle.h"
 #include "runtime/NumberObject.h"
 #include "runtime/BooleanObject.h"
 #include "runtime/RegExpObject.h"
@@ -94,6 +96,7 @@ DEFINE_CAST(Job);
 #endif
 DEFINE_CAST(Script);
 DEFINE_CAST(ScriptParser);
+DEFINE_CAST(PropertyHandle);
 
 #if ESCARGOT_ENABLE_TYPEDARRAY
 DEFINE_CAST(ArrayBufferObject);
@@ -202,6 +205,21 @@ StringRef* StringRef::fromUTF16(const char16_t* s, size_t len)
     return toRef(new UTF16String(s, len));
 }
 
+StringRef* StringRef::fromExternalLatin1(const unsigned char* s, size_t len, ExternalStringReleaseCallback releaseCallback, void* callbackData)
+{
+    return toRef(new ExternalLatin1String(s, len, releaseCallback, callbackData));
+}
+
+StringRef* StringRef::fromExternalUTF16(const char16_t* s, size_t len, ExternalStringReleaseCallback releaseCallback, void* callbackData)
+{
+    return toRef(new ExternalUTF16String(s, len, releaseCallback, callbackData));
+}
+
+StringRef* StringRef::fromExternalUTF8(const char* s, size_t len, ExternalStringReleaseCallback releaseCallback, void* callbackData)
+{
+    return toRef(new ExternalUTF8String(s, len, releaseCallback, callbackData));
+}
+
 StringRef* StringRef::emptyString()
 {
     return toRef(String::emptyString);
@@ -495,6 +513,58 @@ SymbolRef* VMInstanceRef::unscopablesSymbol()
     return toRef(toImpl(this)->globalSymbols().unscopables);
 }
 
+VMInstanceRef::AtomicStringTableStatistics VMInstanceRef::atomicStringTableStatistics()
+{
+    AtomicStringMap& map = toImpl(this)->atomicStringMap();
+    map.sweepWeakStringsIfNeeded();
+
+    AtomicStringTableStatistics result;
+    result.tableSize = map.tableSize();
+    result.weakEntryCount = map.weakEntryCount();
+    result.reclaimedCountInLastSweep = map.reclaimedCountInLastSweep();
+    result.totalReclaimedCount = map.totalReclaimedCount();
+    return result;
+}
+
+VMInstanceRef::RegExpCacheStatistics VMInstanceRef::regexpCacheStatistics()
+{
+    RegExpCacheMap& cache = toImpl(this)->regexpCache();
+
+    RegExpCacheStatistics result;
+    result.size = cache.size();
+    result.hitCount = cache.hitCount();
+    result.missCount = cache.missCount();
+    return result;
+}
+
+bool VMInstanceRef::startSamplingProfiler(size_t intervalInMicroseconds)
+{
+    return toImpl(this)->ensureSamplingProfiler()->start(intervalInMicroseconds);
+}
+
+std::string VMInstanceRef::stopSamplingProfiler(SamplingProfileFormat format)
+{
+    SamplingProfiler* profiler = toImpl(this)->samplingProfiler();
+    if (!profiler) {
+        return std::string();
+    }
+    profiler->stop();
+    std::string result = format == PProf ? profiler->pprofProfile() : profiler->collapsedStacks();
+    delete profiler;
+    toImpl(this)->m_samplingProfiler = nullptr;
+    return result;
+}
+
+size_t VMInstanceRef::stackTraceDepthLimit()
+{
+    return toImpl(this)->stackTraceDepthLimit();
+}
+
+void VMInstanceRef::setStackTraceDepthLimit(size_t limit)
+{
+    toImpl(this)->setStackTraceDepthLimit(limit);
+}
+
 #ifdef ESCARGOT_ENABLE_PROMISE
 ValueRef* VMInstanceRef::drainJobQueue()
 {
@@ -523,16 +593,7 @@ void ContextRef::clearRelatedQueuedPromiseJobs()
 {
     Context* imp = toImpl(this);
 #ifdef ESCARGOT_ENABLE_PROMISE
-    DefaultJobQueue* jobQueue = DefaultJobQueue::get(imp->vmInstance()->jobQueue());
-    std::list<Job*, gc_allocator<Job*>>& impl = jobQueue->impl();
-    auto iter = impl.begin();
-    while (iter != impl.end()) {
-        if ((*iter)->relatedContext() == imp) {
-            iter = impl.erase(iter);
-        } else {
-            iter++;
-        }
-    }
+    DefaultJobQueue::get(imp->vmInstance()->jobQueue())->removeJobsRelatedWith(imp);
 #endif
 }
 
@@ -570,6 +631,54 @@ StringRef* AtomicStringRef::string()
     return toRef(toImpl(this).string());
 }
 
+PropertyHandleRef* PropertyHandleRef::create(ContextRef* c, const char* src)
+{
+    AtomicString a(toImpl(c), src, strlen(src));
+    return toRef(new (NoGC) PropertyHandle(a));
+}
+
+PropertyHandleRef* PropertyHandleRef::create(ContextRef* c, StringRef* src)
+{
+    AtomicString a(toImpl(c), toImpl(src));
+    return toRef(new (NoGC) PropertyHandle(a));
+}
+
+void PropertyHandleRef::destroy()
+{
+    PropertyHandle* imp = toImpl(this);
+    delete imp;
+}
+
+ValueRef* PropertyHandleRef::get(ExecutionStateRef* state, ObjectRef* obj)
+{
+    return toRef(toImpl(this)->get(*toImpl(state), toImpl(obj)));
+}
+
+bool PropertyHandleRef::set(ExecutionStateRef* state, ObjectRef* obj, ValueRef* value)
+{
+    return toImpl(this)->set(*toImpl(state), toImpl(obj), toImpl(value));
+}
+
+void PropertyHandleRef::getProperties(ExecutionStateRef* state, ObjectRef* obj, size_t count, PropertyHandleRef** handles, ValueRef** results)
+{
+    ExecutionState& s = *toImpl(state);
+    Object* o = toImpl(obj);
+    for (size_t i = 0; i < count; i++) {
+        results[i] = toRef(toImpl(handles[i])->get(s, o));
+    }
+}
+
+bool PropertyHandleRef::setProperties(ExecutionStateRef* state, ObjectRef* obj, size_t count, PropertyHandleRef** handles, ValueRef** values)
+{
+    ExecutionState& s = *toImpl(state);
+    Object* o = toImpl(obj);
+    bool result = true;
+    for (size_t i = 0; i < count; i++) {
+        result &= toImpl(handles[i])->set(s, o, toImpl(values[i]));
+    }
+    return result;
+}
+
 ScriptParserRef* ContextRef::scriptParser()
 {
     Context* imp = toImpl(this);
@@ -1237,6 +1346,43 @@ static FunctionObjectRef* createFunction(ExecutionStateRef* state, FunctionObjec
     return toRef(f);
 }
 
+class CallPublicFastFunctionData : public CallFastNativeFunctionData {
+public:
+    FunctionObjectRef::FastNativeFunctionPointer m_publicFastFn;
+};
+
+static Value publicFastFunctionBridge(ExecutionState& state, FunctionObject* callee, const Value& thisValue, size_t argc, Value* argv)
+{
+    CallPublicFastFunctionData* code = (CallPublicFastFunctionData*)callee->codeBlock()->nativeFunctionData();
+    FunctionObjectRef::FastNativeFunctionArguments arguments(toRef(callee), argc, argv);
+    return toImpl(code->m_publicFastFn(toRef(&state), toRef(thisValue), arguments));
+}
+
+ValueRef* FunctionObjectRef::FastNativeFunctionArguments::operator[](size_t idx) const
+{
+    if (LIKELY(idx < m_argc)) {
+        return toRef(((Value*)m_argv)[idx]);
+    }
+    return toRef(Value());
+}
+
+FunctionObjectRef* FunctionObjectRef::createFastNativeFunction(ExecutionStateRef* state, FunctionObjectRef::FastNativeFunctionInfo info)
+{
+    CallPublicFastFunctionData* data = new CallPublicFastFunctionData();
+    data->m_fastFn = publicFastFunctionBridge;
+    data->m_publicFastFn = info.m_nativeFunction;
+    // generic path for callers which do not check hasFastNativeFunctionCode
+    data->m_fn = [](ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression) -> Value {
+        FunctionObject* callee = state.executionContext()->resolveCallee();
+        return publicFastFunctionBridge(state, callee, thisValue, argc, argv);
+    };
+    data->m_ctorFn = nullptr;
+
+    CodeBlock* cb = new CodeBlock(toImpl(state)->context(), toImpl(info.m_name), info.m_argumentCount, true, false, data);
+    cb->setHasFastNativeFunctionCode();
+    return toRef(new FunctionObject(*toImpl(state), cb, nullptr));
+}
+
 FunctionObjectRef* FunctionObjectRef::create(ExecutionStateRef* state, FunctionObjectRef::NativeFunctionInfo info)
 {
     return createFunction(state, info, false);
@@ -1409,6 +1555,17 @@ void ContextRef::setSecurityPolicyCheckCallback(SecurityPolicyCheckCallback cb)
     });
 }
 
+ContextRef::CompiledEvalCacheStatistics ContextRef::compiledEvalCacheStatistics()
+{
+    CompiledEvalCache& cache = toImpl(this)->compiledEvalCache();
+
+    CompiledEvalCacheStatistics result;
+    result.size = cache.size();
+    result.hitCount = cache.hitCount();
+    result.missCount = cache.missCount();
+    return result;
+}
+
 ExecutionStateRef* ExecutionStateRef::create(ContextRef* ctxref)
 {
     Context* ctx = toImpl(ctxref);
@@ -71,6 +71,7 @@ class ScriptParserRef;
 class ExecutionStateRef;
 class ValueVectorRef;
 class JobRef;
+class PropertyHandleRef;
 
 class EXPORT Globals {
 public:
@@ -188,6 +189,15 @@ public:
     static StringRef* fromASCII(const char* s, size_t len);
     static StringRef* fromUTF8(const char* s, size_t len);
     static StringRef* fromUTF16(const char16_t* s, size_t len);
+
+    // external strings use host buffer without copying
+    // buffer should be valid and unchanged until releaseCallback(buffer, callbackData) is called at GC
+    // releaseCallback can be nullptr if host buffer lives forever
+    typedef void (*ExternalStringReleaseCallback)(void* buffer, void* callbackData);
+    static StringRef* fromExternalLatin1(const unsigned char* s, size_t len, ExternalStringReleaseCallback releaseCallback, void* callbackData);
+    static StringRef* fromExternalUTF16(const char16_t* s, size_t len, ExternalStringReleaseCallback releaseCallback, void* callbackData);
+    // ASCII content is used directly. other content is transcoded into UTF-16 when it is read first
+    static StringRef* fromExternalUTF8(const char* s, size_t len, ExternalStringReleaseCallback releaseCallback, void* callbackData);
     static StringRef* emptyString();
 
     char16_t charAt(size_t idx);
@@ -200,6 +210,7 @@ public:
 
     // don't store this sturct
     // this is only for temporary access
+    // 8-bit content(ASCII, Latin-1) is exposed as is without conversion
     struct StringBufferAccessDataRef {
         bool has8BitContent;
         size_t length;
@@ -250,6 +261,43 @@ public:
     SymbolRef* iteratorSymbol();
     SymbolRef* unscopablesSymbol();
 
+    // property names made at runtime are interned weakly, and removed from atomic string table after GC reclaims them
+    // reclaimed entries are swept before the numbers are read
+    struct AtomicStringTableStatistics {
+        size_t tableSize;
+        size_t weakEntryCount;
+        size_t reclaimedCountInLastSweep;
+        size_t totalReclaimedCount;
+    };
+    AtomicStringTableStatistics atomicStringTableStatistics();
+
+    // compiled RegExp patterns are cached per VMInstance, keyed on source and flags
+    // RegExp literals keep their compiled pattern, so only the first evaluation of a literal looks up this cache
+    struct RegExpCacheStatistics {
+        size_t size;
+        size_t hitCount;
+        size_t missCount;
+    };
+    RegExpCacheStatistics regexpCacheStatistics();
+
+    // sampling profiler for JavaScript code. a sample is requested every intervalInMicroseconds of CPU time
+    // returns false if another profiler is running or the platform does not support it
+    bool startSamplingProfiler(size_t intervalInMicroseconds = 1000);
+    enum SamplingProfileFormat {
+        // "outermost;...;innermost count" per line. input of flamegraph.pl
+        CollapsedStacks,
+        // uncompressed profile.proto. `pprof` reads it directly
+        PProf,
+    };
+    // stops profiler and returns samples in the format
+    std::string stopSamplingProfiler(SamplingProfileFormat format = CollapsedStacks);
+
+    // maximum number of frames recorded into stack of thrown error(default is STACK_TRACE_DEPTH_LIMIT_DEFAULT)
+    // frames are recorded from innermost one, and frames beyond the limit are dropped
+    // new limit is applied from the next thrown error
+    size_t stackTraceDepthLimit();
+    void setStackTraceDepthLimit(size_t limit);
+
 #ifdef ESCARGOT_ENABLE_PROMISE
     // if there is an error, executing will be stopped and returns ErrorValue
     // if thres is no job or no error, returns EmptyValue
@@ -280,6 +328,15 @@ public:
     VirtualIdentifierCallback virtualIdentifierCallback();
 
     void setSecurityPolicyCheckCallback(SecurityPolicyCheckCallback cb);
+
+    // parsed eval and Function constructor code is cached per Context
+    // the cache is cleared when bytecode of functions is flushed
+    struct CompiledEvalCacheStatistics {
+        size_t size;
+        size_t hitCount;
+        size_t missCount;
+    };
+    CompiledEvalCacheStatistics compiledEvalCacheStatistics();
 };
 
 class EXPORT AtomicStringRef {
@@ -290,6 +347,24 @@ public:
     StringRef* string();
 };
 
+// interned property name which caches location of own property per object structure
+// use this for accessing same property of many objects which have same shape
+// handle is not collected by GC. call destroy when it is not needed anymore
+class EXPORT PropertyHandleRef {
+public:
+    static PropertyHandleRef* create(ContextRef* c, const char* src); // from ASCII string
+    static PropertyHandleRef* create(ContextRef* c, StringRef* src);
+    void destroy();
+
+    ValueRef* get(ExecutionStateRef* state, ObjectRef* obj);
+    bool set(ExecutionStateRef* state, ObjectRef* obj, ValueRef* value);
+
+    // read or write count properties of obj in one call
+    static void getProperties(ExecutionStateRef* state, ObjectRef* obj, size_t count, PropertyHandleRef** handles, ValueRef** results);
+    // returns false if any of set operations fails
+    static bool setProperties(ExecutionStateRef* state, ObjectRef* obj, size_t count, PropertyHandleRef** handles, ValueRef** values);
+};
+
 class EXPORT ExecutionStateRef {
 public:
     // this can not create sandbox
@@ -639,6 +714,56 @@ public:
     static FunctionObjectRef* create(ExecutionStateRef* state, NativeFunctionInfo info);
     static FunctionObjectRef* createBuiltinFunction(ExecutionStateRef* state, NativeFunctionInfo info);
 
+    // arguments of fast native function
+    // this refers argument registers of caller directly and each value is converted when it is read
+    // don't store this class
+    class EXPORT FastNativeFunctionArguments {
+    public:
+        FastNativeFunctionArguments(FunctionObjectRef* callee, size_t argc, void* argv)
+            : m_callee(callee)
+            , m_argc(argc)
+            , m_argv(argv)
+        {
+        }
+
+        size_t length() const
+        {
+            return m_argc;
+        }
+
+        // returns undefined if idx >= length()
+        ValueRef* operator[](size_t idx) const;
+
+        FunctionObjectRef* callee() const
+        {
+            return m_callee;
+        }
+
+    private:
+        FunctionObjectRef* m_callee;
+        size_t m_argc;
+        void* m_argv;
+    };
+
+    // fast native function is called on the state of caller without its own environment and execution context
+    // thisValue is passed without conversion(strict mode) and the function cannot be used as constructor
+    typedef ValueRef* (*FastNativeFunctionPointer)(ExecutionStateRef* state, ValueRef* thisValue, const FastNativeFunctionArguments& arguments);
+
+    struct FastNativeFunctionInfo {
+        AtomicStringRef* m_name;
+        FastNativeFunctionPointer m_nativeFunction;
+        size_t m_argumentCount;
+
+        FastNativeFunctionInfo(AtomicStringRef* name, FastNativeFunctionPointer fn, size_t argc)
+            : m_name(name)
+            , m_nativeFunction(fn)
+            , m_argumentCount(argc)
+        {
+        }
+    };
+
+    static FunctionObjectRef* createFastNativeFunction(ExecutionStateRef* state, FastNativeFunctionInfo info);
+
     // getter of internal [[Prototype]]
     ValueRef* getFunctionPrototype(ExecutionStateRef* state);
     // setter of internal [[Prototype]]
@@ -59,6 +59,8 @@ int getValidValueInArrayObject(void* ptr, GC_mark_custom_result* arr)
     arr[2].to = (GC_word*)current->m_values.data();
     arr[3].from = (GC_word*)&current->m_fastModeData;
     arr[3].to = (GC_word*)current->m_fastModeData.data();
+    arr[4].from = (GC_word*)&current->m_sparseData;
+    arr[4].to = (GC_word*)current->m_sparseData;
     return 0;
 }
 
@@ -127,6 +129,7 @@ void initializeCustomAllocators()
     GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ArrayObject, m_prototype));
     GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ArrayObject, m_values));
     GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ArrayObject, m_fastModeData));
+    GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ArrayObject, m_sparseData));
     auto descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ArrayObject));
 
     s_gcKinds[HeapObjectKind::ArrayObjectKind] = GC_new_kind_enumerable(GC_new_free_list(),
@@ -135,7 +138,7 @@ void initializeCustomAllocators()
                                                                         TRUE);
 #else
     s_gcKinds[HeapObjectKind::ArrayObjectKind] = GC_new_kind_enumerable(GC_new_free_list(),
-                                                                        GC_MAKE_PROC(GC_new_proc(markAndPushCustom<getValidValueInArrayObject, 4>), 0),
+                                                                        GC_MAKE_PROC(GC_new_proc(markAndPushCustom<getValidValueInArrayObject, 5>), 0),
                                                                         FALSE,
                                                                         TRUE);
 #endif
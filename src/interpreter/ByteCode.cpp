@@ -21,6 +21,8 @@
 #include "ByteCode.h"
 #include "ByteCodeInterpreter.h"
 #include "runtime/Context.h"
+#include "runtime/Environment.h"
+#include "runtime/EnvironmentRecord.h"
 #include "parser/Lexer.h"
 #include "parser/ScriptParser.h"
 #include "parser/ast/AST.h"
@@ -82,55 +84,42 @@ void* ByteCodeBlock::operator new(size_t size)
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
-void ByteCodeBlock::fillLocDataIfNeeded(Context* c)
+ExtendedNodeLOC ByteCodeBlock::computeNodeLOCFromByteCode(size_t codePosition, CodeBlock* cb)
 {
-    if (!m_codeBlock->isInterpretedCodeBlock() || m_locData || (m_codeBlock->isInterpretedCodeBlock() && m_codeBlock->asInterpretedCodeBlock()->src().length() == 0)) {
-        return;
+    if (codePosition == SIZE_MAX || !m_locData || m_locData->empty()) {
+        return ExtendedNodeLOC(SIZE_MAX, SIZE_MAX, SIZE_MAX);
     }
 
-    ByteCodeGenerator g;
-    ByteCodeBlock* block;
-    // TODO
-    // give correct stack limit to parser
-    if (m_codeBlock->asInterpretedCodeBlock()->isGlobalScopeCodeBlock()) {
-        RefPtr<ProgramNode> nd = esprima::parseProgram(c, m_codeBlock->asInterpretedCodeBlock()->src(), m_codeBlock->asInterpretedCodeBlock()->isStrict(), SIZE_MAX);
-        block = g.generateByteCode(c, m_codeBlock->asInterpretedCodeBlock(), nd.get(), nd->scopeContext(), m_isEvalMode, m_isOnGlobal, true);
-    } else {
-        auto ret = c->scriptParser().parseFunction(m_codeBlock->asInterpretedCodeBlock(), SIZE_MAX);
-        block = g.generateByteCode(c, m_codeBlock->asInterpretedCodeBlock(), std::get<0>(ret).get(), std::get<1>(ret), m_isEvalMode, m_isOnGlobal, true);
+    // find last entry which starts at or before codePosition
+    auto iter = std::upper_bound(m_locData->begin(), m_locData->end(), codePosition, [](size_t position, const ByteCodeLOCDataEntry& entry) -> bool {
+        return position < entry.m_codePosition;
+    });
+    if (iter == m_locData->begin()) {
+        return ExtendedNodeLOC(SIZE_MAX, SIZE_MAX, SIZE_MAX);
     }
-    m_locData = block->m_locData;
-    block->m_locData = nullptr;
-    // prevent infinate fillLocDataIfNeeded if m_locData.size() == 0 in here
-    m_locData->push_back(std::make_pair(SIZE_MAX, SIZE_MAX));
-}
-
-ExtendedNodeLOC ByteCodeBlock::computeNodeLOCFromByteCode(Context* c, size_t codePosition, CodeBlock* cb)
-{
-    if (codePosition == SIZE_MAX) {
+    iter--;
+    if (iter->m_sourceIndex == std::numeric_limits<uint32_t>::max()) {
         return ExtendedNodeLOC(SIZE_MAX, SIZE_MAX, SIZE_MAX);
     }
 
-    fillLocDataIfNeeded(c);
-
-    size_t index = 0;
-    for (size_t i = 0; i < m_locData->size(); i++) {
-        if ((*m_locData)[i].first == codePosition) {
-            index = (*m_locData)[i].second;
-            if (index == SIZE_MAX) {
-                return ExtendedNodeLOC(SIZE_MAX, SIZE_MAX, SIZE_MAX);
-            }
-            break;
-        }
+    size_t index = iter->m_sourceIndex;
+    InterpretedCodeBlock* codeBlock = cb->asInterpretedCodeBlock();
+    ExtendedNodeLOC sourceElementStart = codeBlock->sourceElementStart();
+    Script* script = codeBlock->script();
+    if (!script) {
+        auto result = computeNodeLOC(codeBlock->src(), sourceElementStart, index - sourceElementStart.index);
+        result.index = index;
+        return result;
     }
 
-    size_t indexRelatedWithScript = index;
-    index -= cb->asInterpretedCodeBlock()->sourceElementStart().index;
-
-    auto result = computeNodeLOC(cb->asInterpretedCodeBlock()->src(), cb->asInterpretedCodeBlock()->sourceElementStart(), index);
-    result.index = indexRelatedWithScript;
-
-    return result;
+    // line and column are computed relative to start of code block,
+    // because start position of some code blocks is adjusted (e.g. Function constructor)
+    size_t startLine = script->lineNumberOf(sourceElementStart.index);
+    size_t line = script->lineNumberOf(index);
+    if (line == startLine) {
+        return ExtendedNodeLOC(sourceElementStart.line, sourceElementStart.column + index - sourceElementStart.index, index);
+    }
+    return ExtendedNodeLOC(sourceElementStart.line + line - startLine, index - script->lineStartIndex(line) + 1, index);
 }
 
 ExtendedNodeLOC ByteCodeBlock::computeNodeLOC(StringView src, ExtendedNodeLOC sourceElementStart, size_t index)
@@ -167,6 +156,19 @@ void* SetObjectInlineCache::operator new(size_t size)
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
+void ByNameResolutionCache::update(LexicalEnvironment* env, size_t depth, size_t index, bool hasObjectRecordInPath)
+{
+    ASSERT(depth <= BY_NAME_RESOLUTION_CACHE_DEPTH_MAX);
+    for (size_t i = 0; i <= depth; i++) {
+        m_layouts[i] = env->record()->bindingLayout();
+        ASSERT(m_layouts[i]);
+        env = env->outerEnvironment();
+    }
+    m_depth = depth;
+    m_index = index;
+    m_hasObjectRecordInPath = hasObjectRecordInPath;
+}
+
 void* EnumerateObjectData::operator new(size_t size)
 {
     static bool typeInited = false;
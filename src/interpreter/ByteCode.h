@@ -29,6 +29,7 @@
 
 namespace Escargot {
 class ObjectStructure;
+struct RegExpLiteralCache;
 class Node;
 
 // <OpcodeName, PushCount, PopCount>
@@ -64,7 +65,6 @@ class Node;
     F(BinaryInstanceOfOperation, 1, 2)                \
     F(CreateObject, 1, 0)                             \
     F(CreateArray, 1, 0)                              \
-    F(CreateSpreadObject, 1, 0)                       \
     F(CreateFunction, 1, 0)                           \
     F(CreateClass, 0, 0)                              \
     F(SuperReference, 1, 0)                           \
@@ -72,6 +72,7 @@ class Node;
     F(ObjectDefineOwnPropertyOperation, 0, 0)         \
     F(ObjectDefineOwnPropertyWithNameOperation, 0, 0) \
     F(ArrayDefineOwnPropertyOperation, 0, 0)          \
+    F(ArrayDefineOwnPropertyBySpreadOperation, 0, 0)  \
     F(GetObject, 1, 2)                                \
     F(SetObjectOperation, 0, 2)                       \
     F(GetObjectPreComputedCase, 1, 1)                 \
@@ -255,16 +256,49 @@ public:
 #endif
 };
 
+// remembers where LoadByName/StoreByName found its binding
+// the cache is keyed on binding layouts of records on scope chain(see EnvironmentRecord::bindingLayout),
+// so it is shared by every activation of the code that has the same scope shape
+// this is allocated on first resolution and kept alive by ByteCodeBlock::m_literalData
+// the memory is scanned, so cached layouts are never freed and their addresses are never reused
+struct ByNameResolutionCache : public gc {
+    ByNameResolutionCache()
+        : m_depth(0)
+        , m_index(SIZE_MAX)
+        , m_hasObjectRecordInPath(false)
+    {
+    }
+
+    // binding can be accessed by m_index without visiting records between
+    ALWAYS_INLINE bool canAccessDirectly()
+    {
+        return m_index != SIZE_MAX && !m_hasObjectRecordInPath;
+    }
+
+    void update(LexicalEnvironment* env, size_t depth, size_t index, bool hasObjectRecordInPath);
+
+    // number of records between starting environment and target
+    size_t m_depth;
+    // binding index in target record
+    // SIZE_MAX means the binding should be looked up by name (object, global record)
+    size_t m_index;
+    // object records before target are checked every time
+    bool m_hasObjectRecordInPath;
+    void* m_layouts[BY_NAME_RESOLUTION_CACHE_DEPTH_MAX + 1];
+};
+
 class LoadByName : public ByteCode {
 public:
     LoadByName(const ByteCodeLOC& loc, const size_t registerIndex, const AtomicString& name)
         : ByteCode(Opcode::LoadByNameOpcode, loc)
         , m_registerIndex(registerIndex)
         , m_name(name)
+        , m_resolutionCache(nullptr)
     {
     }
     ByteCodeRegisterIndex m_registerIndex;
     AtomicString m_name;
+    ByNameResolutionCache* m_resolutionCache;
 
 #ifndef NDEBUG
     void dump(const char* byteCodeStart)
@@ -280,10 +314,12 @@ public:
         : ByteCode(Opcode::StoreByNameOpcode, loc)
         , m_registerIndex(registerIndex)
         , m_name(name)
+        , m_resolutionCache(nullptr)
     {
     }
     ByteCodeRegisterIndex m_registerIndex;
     AtomicString m_name;
+    ByNameResolutionCache* m_resolutionCache;
 
 #ifndef NDEBUG
     void dump(const char* byteCodeStart)
@@ -515,17 +551,15 @@ public:
 
 class CreateArray : public ByteCode {
 public:
-    CreateArray(const ByteCodeLOC& loc, const size_t registerIndex, bool hasSpreadElement)
+    CreateArray(const ByteCodeLOC& loc, const size_t registerIndex)
         : ByteCode(Opcode::CreateArrayOpcode, loc)
         , m_registerIndex(registerIndex)
-        , m_hasSpreadElement(hasSpreadElement)
     {
         m_length = 0;
     }
 
     ByteCodeRegisterIndex m_registerIndex;
     size_t m_length;
-    bool m_hasSpreadElement : 1;
 
 #ifndef NDEBUG
     void dump(const char* byteCodeStart)
@@ -535,26 +569,6 @@ public:
 #endif
 };
 
-class CreateSpreadObject : public ByteCode {
-public:
-    CreateSpreadObject(const ByteCodeLOC& loc, const size_t registerIndex, const size_t spreadIndex)
-        : ByteCode(Opcode::CreateSpreadObjectOpcode, loc)
-        , m_registerIndex(registerIndex)
-        , m_spreadIndex(spreadIndex)
-    {
-    }
-
-    ByteCodeRegisterIndex m_registerIndex;
-    ByteCodeRegisterIndex m_spreadIndex;
-
-#ifndef NDEBUG
-    void dump(const char* byteCodeStart)
-    {
-        printf("create spread object(r%d) -> r%d", (int)m_spreadIndex, (int)m_registerIndex);
-    }
-#endif
-};
-
 class GetObject : public ByteCode {
 public:
     GetObject(const ByteCodeLOC& loc, const size_t objectRegisterIndex, const size_t propertyRegisterIndex, const size_t storeRegisterIndex)
@@ -668,6 +682,32 @@ public:
 #endif
 };
 
+// used for array literal with spread element
+// elements are appended to the array, because the number of values from spread element is known only at runtime
+class ArrayDefineOwnPropertyBySpreadOperation : public ByteCode {
+public:
+    ArrayDefineOwnPropertyBySpreadOperation(const ByteCodeLOC& loc, const size_t objectRegisterIndex, uint8_t count)
+        : ByteCode(Opcode::ArrayDefineOwnPropertyBySpreadOperationOpcode, loc)
+        , m_objectRegisterIndex(objectRegisterIndex)
+        , m_count(count)
+    {
+    }
+
+    ByteCodeRegisterIndex m_objectRegisterIndex;
+    uint8_t m_count;
+    // REGISTER_LIMIT means hole
+    ByteCodeRegisterIndex m_loadRegisterIndexs[ARRAY_DEFINE_OPERATION_MERGE_COUNT];
+    // loaded value is spread into the array instead of being an element itself
+    bool m_isSpreadElement[ARRAY_DEFINE_OPERATION_MERGE_COUNT];
+
+#ifndef NDEBUG
+    void dump(const char* byteCodeStart)
+    {
+        printf("array define own property by spread r%d[length, count %d] <- r<--->", (int)m_objectRegisterIndex, (int)m_count);
+    }
+#endif
+};
+
 class ObjectStructureChainItem : public gc {
 public:
     ObjectStructure* m_objectStructure;
@@ -1390,13 +1430,14 @@ public:
 
 class CallFunctionWithSpreadElement : public ByteCode {
 public:
-    CallFunctionWithSpreadElement(const ByteCodeLOC& loc, const size_t receiverIndex, const size_t calleeIndex, const size_t argumentsStartIndex, const size_t argumentCount, const size_t resultIndex)
+    CallFunctionWithSpreadElement(const ByteCodeLOC& loc, const size_t receiverIndex, const size_t calleeIndex, const size_t argumentsStartIndex, const size_t argumentCount, const size_t resultIndex, bool* isSpreadElement)
         : ByteCode(Opcode::CallFunctionWithSpreadElementOpcode, loc)
         , m_receiverIndex(receiverIndex)
         , m_calleeIndex(calleeIndex)
         , m_argumentsStartIndex(argumentsStartIndex)
         , m_argumentCount(argumentCount)
         , m_resultIndex(resultIndex)
+        , m_isSpreadElement(isSpreadElement)
     {
     }
 
@@ -1405,6 +1446,8 @@ public:
     ByteCodeRegisterIndex m_argumentsStartIndex;
     uint16_t m_argumentCount;
     ByteCodeRegisterIndex m_resultIndex;
+    // which arguments are spread. see SpreadElementNode::generateSpreadElementFlags
+    bool* m_isSpreadElement;
 
 #ifndef NDEBUG
     void dump(const char* byteCodeStart)
@@ -1420,14 +1463,14 @@ public:
 
 class CallEvalFunction : public ByteCode {
 public:
-    CallEvalFunction(const ByteCodeLOC& loc, const size_t evalIndex, const size_t argumentsStartIndex, size_t argumentCount, const size_t resultIndex, bool inWithScope, bool hasSpreadElement)
+    CallEvalFunction(const ByteCodeLOC& loc, const size_t evalIndex, const size_t argumentsStartIndex, size_t argumentCount, const size_t resultIndex, bool inWithScope, bool* isSpreadElement)
         : ByteCode(Opcode::CallEvalFunctionOpcode, loc)
         , m_evalIndex(evalIndex)
         , m_argumentsStartIndex(argumentsStartIndex)
         , m_argumentCount(argumentCount)
         , m_resultIndex(resultIndex)
         , m_inWithScope(inWithScope)
-        , m_hasSpreadElement(hasSpreadElement)
+        , m_isSpreadElement(isSpreadElement)
     {
     }
     ByteCodeRegisterIndex m_evalIndex;
@@ -1435,7 +1478,8 @@ public:
     uint16_t m_argumentCount;
     ByteCodeRegisterIndex m_resultIndex;
     bool m_inWithScope : 1;
-    bool m_hasSpreadElement : 1;
+    // nullptr when there is no spread argument
+    bool* m_isSpreadElement;
 
 #ifndef NDEBUG
     void dump(const char* byteCodeStart)
@@ -1447,13 +1491,13 @@ public:
 
 class CallFunctionInWithScope : public ByteCode {
 public:
-    CallFunctionInWithScope(const ByteCodeLOC& loc, const AtomicString& calleeName, const size_t argumentsStartIndex, size_t argumentCount, const size_t resultIndex, bool hasSpreadElement)
+    CallFunctionInWithScope(const ByteCodeLOC& loc, const AtomicString& calleeName, const size_t argumentsStartIndex, size_t argumentCount, const size_t resultIndex, bool* isSpreadElement)
         : ByteCode(Opcode::CallFunctionInWithScopeOpcode, loc)
         , m_calleeName(calleeName)
         , m_argumentsStartIndex(argumentsStartIndex)
         , m_argumentCount(argumentCount)
         , m_resultIndex(resultIndex)
-        , m_hasSpreadElement(hasSpreadElement)
+        , m_isSpreadElement(isSpreadElement)
     {
     }
 
@@ -1461,7 +1505,8 @@ public:
     ByteCodeRegisterIndex m_argumentsStartIndex;
     uint16_t m_argumentCount;
     ByteCodeRegisterIndex m_resultIndex;
-    bool m_hasSpreadElement : 1;
+    // nullptr when there is no spread argument
+    bool* m_isSpreadElement;
 
 #ifndef NDEBUG
     void dump(const char* byteCodeStart)
@@ -1496,12 +1541,13 @@ public:
 
 class NewOperationWithSpreadElement : public ByteCode {
 public:
-    NewOperationWithSpreadElement(const ByteCodeLOC& loc, const size_t calleeIndex, const size_t argumentsStartIndex, const size_t argumentCount, const size_t resultIndex)
+    NewOperationWithSpreadElement(const ByteCodeLOC& loc, const size_t calleeIndex, const size_t argumentsStartIndex, const size_t argumentCount, const size_t resultIndex, bool* isSpreadElement)
         : ByteCode(Opcode::NewOperationWithSpreadElementOpcode, loc)
         , m_calleeIndex(calleeIndex)
         , m_argumentsStartIndex(argumentsStartIndex)
         , m_argumentCount(argumentCount)
         , m_resultIndex(resultIndex)
+        , m_isSpreadElement(isSpreadElement)
     {
     }
 
@@ -1509,6 +1555,8 @@ public:
     ByteCodeRegisterIndex m_argumentsStartIndex;
     uint16_t m_argumentCount;
     ByteCodeRegisterIndex m_resultIndex;
+    // which arguments are spread. see SpreadElementNode::generateSpreadElementFlags
+    bool* m_isSpreadElement;
 #ifndef NDEBUG
     void dump(const char* byteCodeStart)
     {
@@ -1801,12 +1849,14 @@ public:
         , m_registerIndex(registerIndex)
         , m_body(body)
         , m_option(opt)
+        , m_literalCache(nullptr)
     {
     }
 
     ByteCodeRegisterIndex m_registerIndex;
     String* m_body;
     String* m_option;
+    RegExpLiteralCache* m_literalCache;
 #ifndef NDEBUG
     void dump(const char* byteCodeStart)
     {
@@ -1912,7 +1962,13 @@ public:
 
 
 typedef Vector<char, std::allocator<char>, 200> ByteCodeBlockData;
-typedef std::vector<std::pair<size_t, size_t>, std::allocator<std::pair<size_t, size_t>>> ByteCodeLOCData;
+// source index of bytecodes, recorded when bytecode is generated
+// an entry covers bytecodes from its position to position of next entry, so entries are sorted by position
+struct ByteCodeLOCDataEntry {
+    uint32_t m_codePosition;
+    uint32_t m_sourceIndex;
+};
+typedef std::vector<ByteCodeLOCDataEntry, std::allocator<ByteCodeLOCDataEntry>> ByteCodeLOCData;
 typedef Vector<void*, GCUtil::gc_malloc_ignore_off_page_allocator<void*>> ByteCodeLiteralData;
 typedef Vector<Value, std::allocator<Value>> ByteCodeNumeralLiteralData;
 typedef std::unordered_set<ObjectStructure*, std::hash<ObjectStructure*>, std::equal_to<ObjectStructure*>,
@@ -1968,8 +2024,7 @@ public:
 
         char* first = (char*)&code;
         size_t start = m_code.size();
-        if (context->m_shouldGenerateLOCData)
-            m_locData->push_back(std::make_pair(start, idx));
+        pushLOCData(start, idx);
 
         m_code.resizeWithUninitializedValues(m_code.size() + sizeof(CodeType));
         for (size_t i = 0; i < sizeof(CodeType); i++) {
@@ -2001,19 +2056,31 @@ public:
         return m_code.size();
     }
 
+    void pushLOCData(size_t codePosition, size_t sourceIndex)
+    {
+        ASSERT(codePosition < std::numeric_limits<uint32_t>::max());
+        ASSERT(sourceIndex == SIZE_MAX || sourceIndex < std::numeric_limits<uint32_t>::max());
+        uint32_t index = sourceIndex == SIZE_MAX ? std::numeric_limits<uint32_t>::max() : sourceIndex;
+        if (m_locData->empty() || m_locData->back().m_sourceIndex != index) {
+            ByteCodeLOCDataEntry entry;
+            entry.m_codePosition = codePosition;
+            entry.m_sourceIndex = index;
+            m_locData->push_back(entry);
+        }
+    }
+
     size_t memoryAllocatedSize()
     {
         size_t siz = m_code.size();
-        siz += m_locData ? (m_locData->size() * sizeof(std::pair<size_t, size_t>)) : 0;
+        siz += m_locData ? (m_locData->size() * sizeof(ByteCodeLOCDataEntry)) : 0;
         siz += m_literalData.size() * sizeof(size_t);
         siz += m_objectStructuresInUse->size() * sizeof(size_t);
         siz += m_getObjectCodePositions.size() * sizeof(size_t);
         return siz;
     }
 
-    ExtendedNodeLOC computeNodeLOCFromByteCode(Context* c, size_t codePosition, CodeBlock* cb);
+    ExtendedNodeLOC computeNodeLOCFromByteCode(size_t codePosition, CodeBlock* cb);
     ExtendedNodeLOC computeNodeLOC(StringView src, ExtendedNodeLOC sourceElementStart, size_t index);
-    void fillLocDataIfNeeded(Context* c);
 
     bool m_isEvalMode : 1;
     bool m_isOnGlobal : 1;
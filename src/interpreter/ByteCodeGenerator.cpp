@@ -146,7 +146,7 @@ static const uint8_t byteCodeLengths[] = {
 #undef ITER_BYTE_CODE
 };
 
-ByteCodeBlock* ByteCodeGenerator::generateByteCode(Context* c, InterpretedCodeBlock* codeBlock, Node* ast, ASTScopeContext* scopeCtx, bool isEvalMode, bool isOnGlobal, bool shouldGenerateLOCData)
+ByteCodeBlock* ByteCodeGenerator::generateByteCode(Context* c, InterpretedCodeBlock* codeBlock, Node* ast, ASTScopeContext* scopeCtx, bool isEvalMode, bool isOnGlobal)
 {
     ByteCodeBlock* block = new ByteCodeBlock(codeBlock);
     block->m_isEvalMode = isEvalMode;
@@ -167,10 +167,7 @@ ByteCodeBlock* ByteCodeGenerator::generateByteCode(Context* c, InterpretedCodeBl
     }
 
     ByteCodeGenerateContext ctx(codeBlock, block, info, nData);
-    ctx.m_shouldGenerateLOCData = shouldGenerateLOCData;
-    if (shouldGenerateLOCData) {
-        block->m_locData = new ByteCodeLOCData();
-    }
+    block->m_locData = new ByteCodeLOCData();
 
     // load/store this value first
     if (codeBlock->needToLoadThisValue()) {
@@ -223,11 +220,8 @@ ByteCodeBlock* ByteCodeGenerator::generateByteCode(Context* c, InterpretedCodeBl
         ThrowStaticErrorOperation code(ByteCodeLOC(err.m_index), ErrorObject::SyntaxError, data);
         block->m_code.resize(sizeof(ThrowStaticErrorOperation));
         memcpy(block->m_code.data(), &code, sizeof(ThrowStaticErrorOperation));
-        if (block->m_locData) {
-            delete block->m_locData;
-        }
-        block->m_locData = new ByteCodeLOCData();
-        block->m_locData->push_back(std::make_pair(0, err.m_index));
+        block->m_locData->clear();
+        block->pushLOCData(0, err.m_index);
     } catch (const char* err) {
         // TODO
         RELEASE_ASSERT_NOT_REACHED();
@@ -341,6 +335,13 @@ ByteCodeBlock* ByteCodeGenerator::generateByteCode(Context* c, InterpretedCodeBl
                     assignStackIndexIfNeeded(cd->m_loadRegisterIndexs[i], stackBase, stackBaseWillBe, stackVariableSize);
                 break;
             }
+            case ArrayDefineOwnPropertyBySpreadOperationOpcode: {
+                ArrayDefineOwnPropertyBySpreadOperation* cd = (ArrayDefineOwnPropertyBySpreadOperation*)currentCode;
+                assignStackIndexIfNeeded(cd->m_objectRegisterIndex, stackBase, stackBaseWillBe, stackVariableSize);
+                for (size_t i = 0; i < cd->m_count; i++)
+                    assignStackIndexIfNeeded(cd->m_loadRegisterIndexs[i], stackBase, stackBaseWillBe, stackVariableSize);
+                break;
+            }
             case GetObjectPreComputedCaseOpcode: {
                 GetObjectPreComputedCase* cd = (GetObjectPreComputedCase*)currentCode;
                 assignStackIndexIfNeeded(cd->m_objectRegisterIndex, stackBase, stackBaseWillBe, stackVariableSize);
@@ -554,12 +555,6 @@ ByteCodeBlock* ByteCodeGenerator::generateByteCode(Context* c, InterpretedCodeBl
                 assignStackIndexIfNeeded(plus->m_dstIndex, stackBase, stackBaseWillBe, stackVariableSize);
                 break;
             }
-            case CreateSpreadObjectOpcode: {
-                CreateSpreadObject* cd = (CreateSpreadObject*)currentCode;
-                assignStackIndexIfNeeded(cd->m_registerIndex, stackBase, stackBaseWillBe, stackVariableSize);
-                assignStackIndexIfNeeded(cd->m_spreadIndex, stackBase, stackBaseWillBe, stackVariableSize);
-                break;
-            }
             case NewOperationWithSpreadElementOpcode: {
                 NewOperationWithSpreadElement* cd = (NewOperationWithSpreadElement*)currentCode;
                 assignStackIndexIfNeeded(cd->m_calleeIndex, stackBase, stackBaseWillBe, stackVariableSize);
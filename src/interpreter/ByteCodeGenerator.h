@@ -79,7 +79,6 @@ struct ByteCodeGenerateContext {
         , m_canSkipCopyToRegister(true)
         , m_keepNumberalLiteralsInRegisterFile(numeralLiteralData)
         , m_catchScopeCount(0)
-        , m_shouldGenerateLOCData(false)
         , m_forInOfVarBinding(false)
         , m_registerStack(new std::vector<ByteCodeRegisterIndex>())
         , m_currentLabels(new std::vector<std::pair<String*, size_t>>())
@@ -108,7 +107,6 @@ struct ByteCodeGenerateContext {
         , m_catchScopeCount(contextBefore.m_catchScopeCount)
         , m_shouldGenerateByteCodeInstantly(contextBefore.m_shouldGenerateByteCodeInstantly)
         , m_inCallingExpressionScope(contextBefore.m_inCallingExpressionScope)
-        , m_shouldGenerateLOCData(contextBefore.m_shouldGenerateLOCData)
         , m_forInOfVarBinding(contextBefore.m_forInOfVarBinding)
         , m_registerStack(contextBefore.m_registerStack)
         , m_currentLabels(contextBefore.m_currentLabels)
@@ -262,7 +260,6 @@ struct ByteCodeGenerateContext {
     bool m_shouldGenerateByteCodeInstantly : 1;
     bool m_inCallingExpressionScope : 1;
     bool m_isHeadOfMemberExpression : 1;
-    bool m_shouldGenerateLOCData : 1;
     bool m_forInOfVarBinding : 1;
 
     std::shared_ptr<std::vector<ByteCodeRegisterIndex>> m_registerStack;
@@ -295,7 +292,7 @@ public:
     void generateStoreThisValueByteCode(ByteCodeBlock* block, ByteCodeGenerateContext* context);
     void generateLoadThisValueByteCode(ByteCodeBlock* block, ByteCodeGenerateContext* context);
 
-    ByteCodeBlock* generateByteCode(Context* c, InterpretedCodeBlock* codeBlock, Node* ast, ASTScopeContext* scopeCtx, bool isEvalMode = false, bool isOnGlobal = false, bool shouldGenerateLOCData = false);
+    ByteCodeBlock* generateByteCode(Context* c, InterpretedCodeBlock* codeBlock, Node* ast, ASTScopeContext* scopeCtx, bool isEvalMode = false, bool isOnGlobal = false);
 };
 }
 
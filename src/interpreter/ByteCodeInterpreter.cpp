@@ -31,8 +31,8 @@
 #include "runtime/ErrorObject.h"
 #include "runtime/ArrayObject.h"
 #include "runtime/VMInstance.h"
+#include "runtime/SamplingProfiler.h"
 #include "runtime/IteratorOperations.h"
-#include "runtime/SpreadObject.h"
 #include "parser/ScriptParser.h"
 #include "util/Util.h"
 #include "../third_party/checked_arithmetic/CheckedArithmetic.h"
@@ -44,6 +44,11 @@
 namespace Escargot {
 
 #define ADD_PROGRAM_COUNTER(CodeType) programCounter += sizeof(CodeType);
+// every loop has backward jump (Jump for for/while, conditional jump for do-while), so long running loops are sampled here
+#define SAMPLE_ON_BACKWARD_JUMP(code)                                                                  \
+    if (UNLIKELY(SamplingProfiler::isSampleRequested()) && code->m_jumpPosition <= (size_t)code) { \
+        SamplingProfiler::takeSample(state, byteCodeBlock, (size_t)code);                          \
+    }
 
 ALWAYS_INLINE size_t jumpTo(char* codeBuffer, const size_t jumpPosition)
 {
@@ -55,6 +60,21 @@ ALWAYS_INLINE size_t resolveProgramCounter(char* codeBuffer, const size_t progra
     return programCounter - (size_t)codeBuffer;
 }
 
+// returns environment that has the binding when env has the scope shape of cache
+ALWAYS_INLINE LexicalEnvironment* findByNameResolutionTarget(ByNameResolutionCache* cache, LexicalEnvironment* env)
+{
+    for (size_t i = 0; i < cache->m_depth; i++) {
+        if (env->record()->bindingLayout() != cache->m_layouts[i]) {
+            return nullptr;
+        }
+        env = env->outerEnvironment();
+    }
+    if (env->record()->bindingLayout() != cache->m_layouts[cache->m_depth]) {
+        return nullptr;
+    }
+    return env;
+}
+
 Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteCodeBlock, size_t programCounter, Value* registerFile)
 {
 #if defined(COMPILER_GCC)
@@ -71,6 +91,10 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
         char* codeBuffer = byteCodeBlock->m_code.data();
         programCounter = (size_t)(codeBuffer + programCounter);
 
+        if (UNLIKELY(SamplingProfiler::isSampleRequested())) {
+            SamplingProfiler::takeSample(state, byteCodeBlock, programCounter);
+        }
+
         try {
 #if defined(COMPILER_GCC)
 
@@ -479,6 +503,7 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
             {
                 Jump* code = (Jump*)programCounter;
                 ASSERT(code->m_jumpPosition != SIZE_MAX);
+                SAMPLE_ON_BACKWARD_JUMP(code);
                 programCounter = code->m_jumpPosition;
                 NEXT_INSTRUCTION();
             }
@@ -500,6 +525,7 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                 if (relation) {
                     ADD_PROGRAM_COUNTER(JumpIfRelation);
                 } else {
+                    SAMPLE_ON_BACKWARD_JUMP(code);
                     programCounter = code->m_jumpPosition;
                 }
                 NEXT_INSTRUCTION();
@@ -522,6 +548,7 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                 if (equality ^ code->m_shouldNegate) {
                     ADD_PROGRAM_COUNTER(JumpIfEqual);
                 } else {
+                    SAMPLE_ON_BACKWARD_JUMP(code);
                     programCounter = code->m_jumpPosition;
                 }
                 NEXT_INSTRUCTION();
@@ -533,6 +560,7 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                 JumpIfTrue* code = (JumpIfTrue*)programCounter;
                 ASSERT(code->m_jumpPosition != SIZE_MAX);
                 if (registerFile[code->m_registerIndex].toBoolean(state)) {
+                    SAMPLE_ON_BACKWARD_JUMP(code);
                     programCounter = code->m_jumpPosition;
                 } else {
                     ADD_PROGRAM_COUNTER(JumpIfTrue);
@@ -546,6 +574,7 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                 JumpIfFalse* code = (JumpIfFalse*)programCounter;
                 ASSERT(code->m_jumpPosition != SIZE_MAX);
                 if (!registerFile[code->m_registerIndex].toBoolean(state)) {
+                    SAMPLE_ON_BACKWARD_JUMP(code);
                     programCounter = code->m_jumpPosition;
                 } else {
                     ADD_PROGRAM_COUNTER(JumpIfFalse);
@@ -583,8 +612,8 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                     upperEnv = upperEnv->outerEnvironment();
                 }
                 FunctionEnvironmentRecord* record = upperEnv->record()->asDeclarativeEnvironmentRecord()->asFunctionEnvironmentRecord();
-                ASSERT(record->isFunctionEnvironmentRecordOnHeap() || record->isFunctionEnvironmentRecordNotIndexed());
-                registerFile[code->m_registerIndex] = ((FunctionEnvironmentRecordOnHeap*)record)->m_heapStorage[code->m_index];
+                ASSERT(record->isFunctionEnvironmentRecordOnHeap());
+                registerFile[code->m_registerIndex] = ((FunctionEnvironmentRecordOnHeap*)record)->heapStorage()[code->m_index];
                 ADD_PROGRAM_COUNTER(LoadByHeapIndex);
                 NEXT_INSTRUCTION();
             }
@@ -598,8 +627,8 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                     upperEnv = upperEnv->outerEnvironment();
                 }
                 FunctionEnvironmentRecord* record = upperEnv->record()->asDeclarativeEnvironmentRecord()->asFunctionEnvironmentRecord();
-                ASSERT(record->isFunctionEnvironmentRecordOnHeap() || record->isFunctionEnvironmentRecordNotIndexed());
-                ((FunctionEnvironmentRecordOnHeap*)record)->m_heapStorage[code->m_index] = registerFile[code->m_registerIndex];
+                ASSERT(record->isFunctionEnvironmentRecordOnHeap());
+                ((FunctionEnvironmentRecordOnHeap*)record)->heapStorage()[code->m_index] = registerFile[code->m_registerIndex];
                 ADD_PROGRAM_COUNTER(StoreByHeapIndex);
                 NEXT_INSTRUCTION();
             }
@@ -736,7 +765,7 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                 :
             {
                 CreateArray* code = (CreateArray*)programCounter;
-                ArrayObject* arr = new ArrayObject(state, code->m_hasSpreadElement);
+                ArrayObject* arr = new ArrayObject(state);
                 arr->setArrayLength(state, code->m_length);
                 registerFile[code->m_registerIndex] = arr;
                 ADD_PROGRAM_COUNTER(CreateArray);
@@ -788,29 +817,10 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                         }
                     }
                 } else {
-                    size_t spreadCount = 0;
                     for (size_t i = 0; i < code->m_count; i++) {
                         if (LIKELY(code->m_loadRegisterIndexs[i] != REGISTER_LIMIT)) {
                             const Value& element = registerFile[code->m_loadRegisterIndexs[i]];
-
-                            if (element.isObject() && element.asObject()->isSpreadObject()) {
-                                SpreadObject* spreadObj = element.asObject()->asSpreadObject();
-                                Value iterator = getIterator(state, spreadObj->spreadValue());
-
-                                while (true) {
-                                    Value next = iteratorStep(state, iterator);
-                                    if (next.isFalse()) {
-                                        spreadCount--;
-                                        break;
-                                    }
-
-                                    Value nextValue = iteratorValue(state, next);
-                                    arr->defineOwnProperty(state, ObjectPropertyName(state, Value(i + spreadCount + code->m_baseIndex)), ObjectPropertyDescriptor(nextValue, ObjectPropertyDescriptor::AllPresent));
-                                    spreadCount++;
-                                }
-                            } else {
-                                arr->defineOwnProperty(state, ObjectPropertyName(state, Value(i + spreadCount + code->m_baseIndex)), ObjectPropertyDescriptor(element, ObjectPropertyDescriptor::AllPresent));
-                            }
+                            arr->defineOwnProperty(state, ObjectPropertyName(state, Value(i + code->m_baseIndex)), ObjectPropertyDescriptor(element, ObjectPropertyDescriptor::AllPresent));
                         }
                     }
                 }
@@ -818,12 +828,12 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                 NEXT_INSTRUCTION();
             }
 
-            DEFINE_OPCODE(CreateSpreadObject)
+            DEFINE_OPCODE(ArrayDefineOwnPropertyBySpreadOperation)
                 :
             {
-                CreateSpreadObject* code = (CreateSpreadObject*)programCounter;
-                registerFile[code->m_registerIndex] = new SpreadObject(state, registerFile[code->m_spreadIndex]);
-                ADD_PROGRAM_COUNTER(CreateSpreadObject);
+                ArrayDefineOwnPropertyBySpreadOperation* code = (ArrayDefineOwnPropertyBySpreadOperation*)programCounter;
+                arrayDefineOwnPropertyBySpreadOperation(state, code, registerFile);
+                ADD_PROGRAM_COUNTER(ArrayDefineOwnPropertyBySpreadOperation);
                 NEXT_INSTRUCTION();
             }
 
@@ -913,7 +923,14 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                 :
             {
                 LoadByName* code = (LoadByName*)programCounter;
-                registerFile[code->m_registerIndex] = loadByName(state, ec->lexicalEnvironment(), code->m_name);
+                LexicalEnvironment* env = ec->lexicalEnvironment();
+                ByNameResolutionCache* cache = code->m_resolutionCache;
+                LexicalEnvironment* target;
+                if (LIKELY(cache && cache->canAccessDirectly() && (target = findByNameResolutionTarget(cache, env)))) {
+                    registerFile[code->m_registerIndex] = target->record()->getBindingValue(state, cache->m_index);
+                } else {
+                    registerFile[code->m_registerIndex] = loadByNameSlowCase(state, env, code, byteCodeBlock);
+                }
                 ADD_PROGRAM_COUNTER(LoadByName);
                 NEXT_INSTRUCTION();
             }
@@ -922,7 +939,14 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                 :
             {
                 StoreByName* code = (StoreByName*)programCounter;
-                storeByName(state, ec->lexicalEnvironment(), code->m_name, registerFile[code->m_registerIndex]);
+                LexicalEnvironment* env = ec->lexicalEnvironment();
+                ByNameResolutionCache* cache = code->m_resolutionCache;
+                LexicalEnvironment* target;
+                if (LIKELY(cache && cache->canAccessDirectly() && (target = findByNameResolutionTarget(cache, env)))) {
+                    target->record()->setMutableBindingByIndex(state, cache->m_index, code->m_name, registerFile[code->m_registerIndex]);
+                } else {
+                    storeByNameSlowCase(state, env, code, registerFile[code->m_registerIndex], byteCodeBlock);
+                }
                 ADD_PROGRAM_COUNTER(StoreByName);
                 NEXT_INSTRUCTION();
             }
@@ -1138,12 +1162,12 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
             {
                 IteratorStep* code = (IteratorStep*)programCounter;
                 Value iterator = registerFile[code->m_iterRegisterIndex];
-                Value nextResult = iteratorStep(state, iterator);
+                Value nextValue;
 
-                if (nextResult.isFalse()) {
+                if (!iteratorStepValue(state, iterator, nextValue)) {
                     programCounter = jumpTo(codeBuffer, code->m_forOfEndPosition);
                 } else {
-                    registerFile[code->m_registerIndex] = iteratorValue(state, nextResult);
+                    registerFile[code->m_registerIndex] = nextValue;
                     ADD_PROGRAM_COUNTER(IteratorStep);
                 }
                 NEXT_INSTRUCTION();
@@ -1153,7 +1177,14 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                 :
             {
                 LoadRegexp* code = (LoadRegexp*)programCounter;
-                auto reg = new RegExpObject(state, code->m_body, code->m_option);
+                RegExpObject* reg;
+                if (LIKELY(code->m_literalCache != nullptr)) {
+                    reg = new RegExpObject(state, code->m_literalCache);
+                } else {
+                    reg = new RegExpObject(state, code->m_body, code->m_option);
+                    code->m_literalCache = reg->createLiteralCache(state);
+                    byteCodeBlock->m_literalData.pushBack(code->m_literalCache);
+                }
                 registerFile[code->m_registerIndex] = reg;
                 ADD_PROGRAM_COUNTER(LoadRegexp);
                 NEXT_INSTRUCTION();
@@ -1263,7 +1294,7 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                 const Value& callee = registerFile[code->m_calleeIndex];
                 const Value& receiver = code->m_receiverIndex == REGISTER_LIMIT ? Value() : registerFile[code->m_receiverIndex];
                 ValueVector spreadArgs;
-                spreadFunctionArguments(state, &registerFile[code->m_argumentsStartIndex], code->m_argumentCount, spreadArgs);
+                spreadFunctionArguments(state, &registerFile[code->m_argumentsStartIndex], code->m_argumentCount, code->m_isSpreadElement, spreadArgs);
                 registerFile[code->m_resultIndex] = FunctionObject::call(state, callee, receiver, spreadArgs.size(), spreadArgs.data());
                 ADD_PROGRAM_COUNTER(CallFunctionWithSpreadElement);
                 NEXT_INSTRUCTION();
@@ -1275,7 +1306,7 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                 NewOperationWithSpreadElement* code = (NewOperationWithSpreadElement*)programCounter;
                 const Value& callee = registerFile[code->m_calleeIndex];
                 ValueVector spreadArgs;
-                spreadFunctionArguments(state, &registerFile[code->m_argumentsStartIndex], code->m_argumentCount, spreadArgs);
+                spreadFunctionArguments(state, &registerFile[code->m_argumentsStartIndex], code->m_argumentCount, code->m_isSpreadElement, spreadArgs);
                 registerFile[code->m_resultIndex] = newOperation(state, registerFile[code->m_calleeIndex], spreadArgs.size(), spreadArgs.data());
                 ADD_PROGRAM_COUNTER(NewOperationWithSpreadElement);
                 NEXT_INSTRUCTION();
@@ -1285,8 +1316,11 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                 :
             {
                 IteratorValue* code = (IteratorValue*)programCounter;
-                Value next = iteratorStep(state, registerFile[code->m_iterIndex]);
-                registerFile[code->m_dstIndex] = next.isFalse() ? Value() : iteratorValue(state, next);
+                Value nextValue;
+                if (!iteratorStepValue(state, registerFile[code->m_iterIndex], nextValue)) {
+                    nextValue = Value();
+                }
+                registerFile[code->m_dstIndex] = nextValue;
 
                 ADD_PROGRAM_COUNTER(IteratorValue);
                 NEXT_INSTRUCTION();
@@ -1297,17 +1331,13 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
             {
                 BindingRestElement* code = (BindingRestElement*)programCounter;
 
-                ArrayObject* array = new ArrayObject(state, false);
+                ArrayObject* array = new ArrayObject(state);
                 const Value& iterator = registerFile[code->m_iterIndex];
 
                 size_t i = 0;
-                while (true) {
-                    Value next = iteratorStep(state, iterator);
-                    if (next.isFalse()) {
-                        break;
-                    }
-
-                    array->setIndexedProperty(state, Value(i++), iteratorValue(state, next));
+                Value nextValue;
+                while (iteratorStepValue(state, iterator, nextValue)) {
+                    array->setIndexedProperty(state, Value(i++), nextValue);
                 }
 
                 registerFile[code->m_dstIndex] = array;
@@ -1409,6 +1439,128 @@ NEVER_INLINE void ByteCodeInterpreter::storeByName(ExecutionState& state, Lexica
     o->setThrowsExceptionWhenStrictMode(state, name, value, o);
 }
 
+NEVER_INLINE Value ByteCodeInterpreter::loadByNameSlowCase(ExecutionState& state, LexicalEnvironment* env, LoadByName* code, ByteCodeBlock* block)
+{
+    const AtomicString& name = code->m_name;
+    ByNameResolutionCache* cache = code->m_resolutionCache;
+    LexicalEnvironment* target;
+
+    if (cache && (target = findByNameResolutionTarget(cache, env))) {
+        // with statement can add property to its object anytime
+        if (cache->m_hasObjectRecordInPath) {
+            for (LexicalEnvironment* e = env; e != target; e = e->outerEnvironment()) {
+                if (e->record()->isObjectEnvironmentRecord()) {
+                    EnvironmentRecord::GetBindingValueResult result = e->record()->getBindingValue(state, name);
+                    if (result.m_hasBindingValue) {
+                        return result.m_value;
+                    }
+                }
+            }
+        }
+        if (cache->m_index != SIZE_MAX) {
+            return target->record()->getBindingValue(state, cache->m_index);
+        }
+        return loadByName(state, target, name);
+    }
+
+    bool canCache = true;
+    bool hasObjectRecordInPath = false;
+    size_t depth = 0;
+    for (LexicalEnvironment* e = env; e; e = e->outerEnvironment(), depth++) {
+        EnvironmentRecord* record = e->record();
+        void* layout = record->bindingLayout();
+        if (!layout || depth > BY_NAME_RESOLUTION_CACHE_DEPTH_MAX) {
+            canCache = false;
+        }
+        if (layout && record->isDeclarativeEnvironmentRecord()) {
+            auto slot = record->hasBinding(state, name);
+            if (slot.m_index != SIZE_MAX) {
+                if (canCache) {
+                    updateByNameResolutionCache(code->m_resolutionCache, block, env, depth, slot.m_index, hasObjectRecordInPath);
+                }
+                return record->getBindingValue(state, slot.m_index);
+            }
+        } else {
+            EnvironmentRecord::GetBindingValueResult result = record->getBindingValue(state, name);
+            if (result.m_hasBindingValue) {
+                if (canCache) {
+                    // object or global record
+                    updateByNameResolutionCache(code->m_resolutionCache, block, env, depth, SIZE_MAX, hasObjectRecordInPath);
+                }
+                return result.m_value;
+            }
+            if (record->isObjectEnvironmentRecord()) {
+                hasObjectRecordInPath = true;
+            }
+        }
+    }
+
+    // virtual identifier or ReferenceError
+    return loadByName(state, nullptr, name);
+}
+
+NEVER_INLINE void ByteCodeInterpreter::storeByNameSlowCase(ExecutionState& state, LexicalEnvironment* env, StoreByName* code, const Value& value, ByteCodeBlock* block)
+{
+    const AtomicString& name = code->m_name;
+    ByNameResolutionCache* cache = code->m_resolutionCache;
+    LexicalEnvironment* target;
+
+    if (cache && (target = findByNameResolutionTarget(cache, env))) {
+        if (cache->m_hasObjectRecordInPath) {
+            for (LexicalEnvironment* e = env; e != target; e = e->outerEnvironment()) {
+                if (e->record()->isObjectEnvironmentRecord()) {
+                    auto slot = e->record()->hasBinding(state, name);
+                    if (slot.m_index != SIZE_MAX) {
+                        e->record()->setMutableBindingByIndex(state, slot.m_index, name, value);
+                        return;
+                    }
+                }
+            }
+        }
+        if (cache->m_index != SIZE_MAX) {
+            target->record()->setMutableBindingByIndex(state, cache->m_index, name, value);
+            return;
+        }
+        storeByName(state, target, name, value);
+        return;
+    }
+
+    bool canCache = true;
+    bool hasObjectRecordInPath = false;
+    size_t depth = 0;
+    for (LexicalEnvironment* e = env; e; e = e->outerEnvironment(), depth++) {
+        EnvironmentRecord* record = e->record();
+        if (!record->bindingLayout() || depth > BY_NAME_RESOLUTION_CACHE_DEPTH_MAX) {
+            canCache = false;
+        }
+        auto slot = record->hasBinding(state, name);
+        if (slot.m_index != SIZE_MAX) {
+            if (canCache) {
+                // binding of object or global record is looked up by name
+                size_t index = record->isDeclarativeEnvironmentRecord() ? slot.m_index : SIZE_MAX;
+                updateByNameResolutionCache(code->m_resolutionCache, block, env, depth, index, hasObjectRecordInPath);
+            }
+            record->setMutableBindingByIndex(state, slot.m_index, name, value);
+            return;
+        }
+        if (record->isObjectEnvironmentRecord()) {
+            hasObjectRecordInPath = true;
+        }
+    }
+
+    // ReferenceError in strict mode or new property of global object
+    storeByName(state, nullptr, name, value);
+}
+
+void ByteCodeInterpreter::updateByNameResolutionCache(ByNameResolutionCache*& cache, ByteCodeBlock* block, LexicalEnvironment* env, size_t depth, size_t index, bool hasObjectRecordInPath)
+{
+    if (!cache) {
+        cache = new ByNameResolutionCache();
+        block->m_literalData.pushBack(cache);
+    }
+    cache->update(env, depth, index, hasObjectRecordInPath);
+}
+
 NEVER_INLINE Value ByteCodeInterpreter::plusSlowCase(ExecutionState& state, const Value& left, const Value& right)
 {
     Value ret(Value::ForceUninitialized);
@@ -2096,7 +2248,7 @@ NEVER_INLINE size_t ByteCodeInterpreter::tryOperation(ExecutionState& state, Try
         }
 #endif
 
-        state.context()->m_sandBoxStack.back()->m_stackTraceData.clear();
+        state.context()->m_sandBoxStack.back()->clearStackTraceFrames();
         if (code->m_hasCatch == false) {
             state.rareData()->m_controlFlowRecord->back() = new ControlFlowRecord(ControlFlowRecord::NeedsThrow, val);
             programCounter = jumpTo(codeBuffer, code->m_tryCatchEndPosition);
@@ -2151,8 +2303,8 @@ NEVER_INLINE void ByteCodeInterpreter::evalOperation(ExecutionState& state, Call
     Value* argv;
     ValueVector spreadArgs;
 
-    if (code->m_hasSpreadElement) {
-        spreadFunctionArguments(state, &registerFile[code->m_argumentsStartIndex], code->m_argumentCount, spreadArgs);
+    if (code->m_isSpreadElement) {
+        spreadFunctionArguments(state, &registerFile[code->m_argumentsStartIndex], code->m_argumentCount, code->m_isSpreadElement, spreadArgs);
         argv = spreadArgs.data();
         argc = spreadArgs.size();
     } else {
@@ -2383,34 +2535,83 @@ NEVER_INLINE Value ByteCodeInterpreter::callFunctionInWithScope(ExecutionState&
     else
         receiverObj = state.context()->globalObject();
 
-    if (code->m_hasSpreadElement) {
+    if (code->m_isSpreadElement) {
         ValueVector spreadArgs;
-        spreadFunctionArguments(state, argv, code->m_argumentCount, spreadArgs);
+        spreadFunctionArguments(state, argv, code->m_argumentCount, code->m_isSpreadElement, spreadArgs);
         return FunctionObject::call(state, callee, receiverObj, spreadArgs.size(), spreadArgs.data());
     }
     return FunctionObject::call(state, callee, receiverObj, code->m_argumentCount, argv);
 }
 
-void ByteCodeInterpreter::spreadFunctionArguments(ExecutionState& state, const Value* argv, const size_t argc, ValueVector& argVector)
+NEVER_INLINE void ByteCodeInterpreter::arrayDefineOwnPropertyBySpreadOperation(ExecutionState& state, ArrayDefineOwnPropertyBySpreadOperation* code, Value* registerFile)
+{
+    ArrayObject* arr = registerFile[code->m_objectRegisterIndex].asObject()->asArrayObject();
+    size_t index = arr->getArrayLength(state);
+    for (size_t i = 0; i < code->m_count; i++) {
+        if (UNLIKELY(code->m_loadRegisterIndexs[i] == REGISTER_LIMIT)) {
+            index++;
+            continue;
+        }
+
+        const Value& element = registerFile[code->m_loadRegisterIndexs[i]];
+        if (!code->m_isSpreadElement[i]) {
+            arr->defineOwnProperty(state, ObjectPropertyName(state, Value(index++)), ObjectPropertyDescriptor(element, ObjectPropertyDescriptor::AllPresent));
+            continue;
+        }
+
+        if (element.isObject() && element.asObject()->isArrayObject() && arr->isFastModeArray()) {
+            ArrayObject* spreadArray = element.asObject()->asArrayObject();
+            if (spreadArray->isFastModeArrayWithBuiltinIterator(state) && spreadArray->canReadHoleAsUndefined(state)) {
+                size_t spreadLength = spreadArray->getArrayLength(state);
+                if (arr->setArrayLength(state, index + spreadLength) && LIKELY(arr->isFastModeArray())) {
+                    for (size_t j = 0; j < spreadLength; j++) {
+                        Value v = spreadArray->m_fastModeData[j];
+                        arr->m_fastModeData[index + j] = v.isEmpty() ? Value() : v;
+                    }
+                    index += spreadLength;
+                    continue;
+                }
+            }
+        }
+
+        Value iterator = getIterator(state, element);
+        Value nextValue;
+        while (iteratorStepValue(state, iterator, nextValue)) {
+            arr->defineOwnProperty(state, ObjectPropertyName(state, Value(index++)), ObjectPropertyDescriptor(nextValue, ObjectPropertyDescriptor::AllPresent));
+        }
+    }
+
+    // trailing holes
+    if (arr->getArrayLength(state) < index) {
+        arr->setArrayLength(state, index);
+    }
+}
+
+void ByteCodeInterpreter::spreadFunctionArguments(ExecutionState& state, const Value* argv, const size_t argc, const bool* isSpreadElement, ValueVector& argVector)
 {
     bool isOngoingSupercall = state.executionContext()->isOnGoingSuperCall();
     state.executionContext()->setOnGoingSuperCall(false);
     for (size_t i = 0; i < argc; i++) {
-        Value arg = argv[i];
-        if (arg.isObject() && arg.asObject()->isSpreadObject()) {
-            SpreadObject* spreadObj = arg.asObject()->asSpreadObject();
-            Value iterator = getIterator(state, spreadObj->spreadValue());
-
-            while (true) {
-                Value next = iteratorStep(state, iterator);
-                if (next.isFalse()) {
-                    break;
+        if (isSpreadElement[i]) {
+            const Value& spreadValue = argv[i];
+            if (spreadValue.isObject() && spreadValue.asObject()->isArrayObject() && spreadValue.asObject()->asArrayObject()->isFastModeArrayWithBuiltinIterator(state)) {
+                ArrayObject* spreadArray = spreadValue.asObject()->asArrayObject();
+                size_t base = argVector.size();
+                argVector.resizeWithUninitializedValues(base + spreadArray->getArrayLength(state));
+                if (LIKELY(spreadArray->tryToCopyFastModeElements(state, argVector.data() + base))) {
+                    continue;
                 }
+                argVector.resize(base);
+            }
+
+            Value iterator = getIterator(state, spreadValue);
 
-                argVector.push_back(iteratorValue(state, next));
+            Value nextValue;
+            while (iteratorStepValue(state, iterator, nextValue)) {
+                argVector.push_back(nextValue);
             }
         } else {
-            argVector.push_back(arg);
+            argVector.push_back(argv[i]);
         }
     }
 
@@ -2432,8 +2633,8 @@ NEVER_INLINE void ByteCodeInterpreter::declareFunctionDeclarations(ExecutionStat
                     stackStorage[info.m_indexForIndexedStorage] = fn;
                 } else {
                     FunctionEnvironmentRecord* record = lexicalEnvironment->record()->asDeclarativeEnvironmentRecord()->asFunctionEnvironmentRecord();
-                    ASSERT(record->isFunctionEnvironmentRecordOnHeap() || record->isFunctionEnvironmentRecordNotIndexed());
-                    ((FunctionEnvironmentRecordOnHeap*)record)->m_heapStorage[info.m_indexForIndexedStorage] = fn;
+                    ASSERT(record->isFunctionEnvironmentRecordOnHeap());
+                    ((FunctionEnvironmentRecordOnHeap*)record)->heapStorage()[info.m_indexForIndexedStorage] = fn;
                 }
             }
         }
@@ -2547,57 +2748,21 @@ NEVER_INLINE void ByteCodeInterpreter::processException(ExecutionState& state, c
         ec = ecInput->parent();
     }
 
-    bool alreadyExists = false;
-
-    for (size_t i = 0; i < sb->m_stackTraceData.size(); i++) {
-        if (sb->m_stackTraceData[i].first == ec) {
-            alreadyExists = true;
-            break;
-        }
+    CodeBlock* cb;
+    if (env->record()->isGlobalEnvironmentRecord()) {
+        cb = env->record()->asGlobalEnvironmentRecord()->globalCodeBlock();
+    } else {
+        cb = env->record()->asDeclarativeEnvironmentRecord()->asFunctionEnvironmentRecord()->functionObject()->codeBlock();
     }
 
-    if (!alreadyExists) {
-        if (env->record()->isGlobalEnvironmentRecord()) {
-            CodeBlock* cb = env->record()->asGlobalEnvironmentRecord()->globalCodeBlock();
-            ByteCodeBlock* b = cb->asInterpretedCodeBlock()->byteCodeBlock();
-            ExtendedNodeLOC loc(SIZE_MAX, SIZE_MAX, SIZE_MAX);
-            if (programCounter != SIZE_MAX) {
-                loc.byteCodePosition = programCounter - (size_t)b->m_code.data();
-                loc.actualCodeBlock = b;
-            }
-            SandBox::StackTraceData data;
-            data.loc = loc;
-            data.fileName = cb->asInterpretedCodeBlock()->script()->fileName();
-            data.source = cb->asInterpretedCodeBlock()->script()->src();
-            sb->m_stackTraceData.pushBack(std::make_pair(ec, data));
-        } else {
-            FunctionObject* fn = env->record()->asDeclarativeEnvironmentRecord()->asFunctionEnvironmentRecord()->functionObject();
-            CodeBlock* cb = fn->codeBlock();
-            ExtendedNodeLOC loc(SIZE_MAX, SIZE_MAX, SIZE_MAX);
-            if (cb->isInterpretedCodeBlock()) {
-                ByteCodeBlock* b = cb->asInterpretedCodeBlock()->byteCodeBlock();
-                if (programCounter != SIZE_MAX) {
-                    loc.byteCodePosition = programCounter - (size_t)b->m_code.data();
-                    loc.actualCodeBlock = b;
-                }
-            }
-            SandBox::StackTraceData data;
-            data.loc = loc;
-            if (cb->isInterpretedCodeBlock() && cb->asInterpretedCodeBlock()->script()) {
-                data.fileName = cb->asInterpretedCodeBlock()->script()->fileName();
-            } else {
-                StringBuilder builder;
-                builder.appendString("function ");
-                builder.appendString(cb->functionName().string());
-                builder.appendString("() { ");
-                builder.appendString("[native function]");
-                builder.appendString(" } ");
-                data.fileName = builder.finalize();
-            }
-            data.source = String::emptyString;
-            sb->m_stackTraceData.pushBack(std::make_pair(ec, data));
-        }
+    ByteCodeBlock* b = nullptr;
+    size_t byteCodePosition = SIZE_MAX;
+    if (cb->isInterpretedCodeBlock() && programCounter != SIZE_MAX) {
+        b = cb->asInterpretedCodeBlock()->byteCodeBlock();
+        byteCodePosition = programCounter - (size_t)b->m_code.data();
     }
+    sb->recordStackTraceFrame(ec, cb, b, byteCodePosition);
+
     sb->throwException(state, value);
 }
 }
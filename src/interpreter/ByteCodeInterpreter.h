@@ -33,6 +33,9 @@ class LexicalEnvironment;
 struct GetObjectInlineCache;
 struct SetObjectInlineCache;
 struct EnumerateObjectData;
+struct ByNameResolutionCache;
+class LoadByName;
+class StoreByName;
 class GetGlobalObject;
 class SetGlobalObject;
 class CallFunctionInWithScope;
@@ -46,6 +49,7 @@ class TemplateOperation;
 class DeclareFunctionDeclarations;
 class ObjectDefineGetter;
 class ObjectDefineSetter;
+class ArrayDefineOwnPropertyBySpreadOperation;
 class GlobalObject;
 
 class ByteCodeInterpreter {
@@ -54,6 +58,9 @@ public:
     static Value loadByName(ExecutionState& state, LexicalEnvironment* env, const AtomicString& name, bool throwException = true);
     static EnvironmentRecord* getBindedEnvironmentRecordByName(ExecutionState& state, LexicalEnvironment* env, const AtomicString& name, Value& bindedValue, bool throwException = true);
     static void storeByName(ExecutionState& state, LexicalEnvironment* env, const AtomicString& name, const Value& value);
+    static Value loadByNameSlowCase(ExecutionState& state, LexicalEnvironment* env, LoadByName* code, ByteCodeBlock* block);
+    static void storeByNameSlowCase(ExecutionState& state, LexicalEnvironment* env, StoreByName* code, const Value& value, ByteCodeBlock* block);
+    static void updateByNameResolutionCache(ByNameResolutionCache*& cache, ByteCodeBlock* block, LexicalEnvironment* env, size_t depth, size_t index, bool hasObjectRecordInPath);
     static Value plusSlowCase(ExecutionState& state, const Value& a, const Value& b);
     static Value modOperation(ExecutionState& state, const Value& left, const Value& right);
     static Object* newOperation(ExecutionState& state, const Value& callee, size_t argc, Value* argv);
@@ -88,7 +95,8 @@ public:
     static Value withOperation(ExecutionState& state, WithOperation* code, Object* obj, ExecutionContext* ec, LexicalEnvironment* env, size_t& programCounter, ByteCodeBlock* byteCodeBlock, Value* registerFile, Value* stackStorage);
     static bool binaryInOperation(ExecutionState& state, const Value& left, const Value& right);
     static Value callFunctionInWithScope(ExecutionState& state, CallFunctionInWithScope* code, ExecutionContext* ec, LexicalEnvironment* env, Value* argv);
-    static void spreadFunctionArguments(ExecutionState& state, const Value* argv, const size_t argc, ValueVector& argVector);
+    static void arrayDefineOwnPropertyBySpreadOperation(ExecutionState& state, ArrayDefineOwnPropertyBySpreadOperation* code, Value* registerFile);
+    static void spreadFunctionArguments(ExecutionState& state, const Value* argv, const size_t argc, const bool* isSpreadElement, ValueVector& argVector);
 
     static void declareFunctionDeclarations(ExecutionState& state, DeclareFunctionDeclarations* code, LexicalEnvironment* lexicalEnvironment, Value* stackStorage);
     static void defineObjectGetter(ExecutionState& state, ObjectDefineGetter* code, Value* registerFile);
@@ -90,6 +90,7 @@ CodeBlock::CodeBlock(Context* ctx, const NativeFunctionInfo& info)
     , m_isConstructor(info.m_isConstructor)
     , m_isStrict(info.m_isStrict)
     , m_hasCallNativeFunctionCode(true)
+    , m_hasFastNativeFunctionCode(false)
     , m_isFunctionNameSaveOnHeap(false)
     , m_isFunctionNameExplicitlyDeclared(false)
     , m_canUseIndexedVariableStorage(true)
@@ -128,6 +129,7 @@ CodeBlock::CodeBlock(Context* ctx, AtomicString name, size_t argc, bool isStrict
     , m_isConstructor(isCtor)
     , m_isStrict(isStrict)
     , m_hasCallNativeFunctionCode(true)
+    , m_hasFastNativeFunctionCode(false)
     , m_isFunctionNameSaveOnHeap(false)
     , m_isFunctionNameExplicitlyDeclared(false)
     , m_canUseIndexedVariableStorage(true)
@@ -184,6 +186,7 @@ CodeBlock::CodeBlock(ExecutionState& state, FunctionObject* targetFunction, Valu
     , m_isConstructor(false)
     , m_isStrict(false)
     , m_hasCallNativeFunctionCode(true)
+    , m_hasFastNativeFunctionCode(false)
     , m_isFunctionNameSaveOnHeap(false)
     , m_isFunctionNameExplicitlyDeclared(false)
     , m_canUseIndexedVariableStorage(true)
@@ -252,6 +255,7 @@ InterpretedCodeBlock::InterpretedCodeBlock(Context* ctx, Script* script, StringV
     m_parameterCount = 0;
     m_isConstructor = false;
     m_hasCallNativeFunctionCode = false;
+    m_hasFastNativeFunctionCode = false;
     m_isFunctionDeclaration = false;
     m_isFunctionDeclarationWithSpecialBinding = false;
     m_isFunctionExpression = false;
@@ -320,6 +324,7 @@ InterpretedCodeBlock::InterpretedCodeBlock(Context* ctx, Script* script, StringV
     m_parameterCount = scopeCtx->m_hasRestElement ? parameterNames.size() - 1 : parameterNames.size();
     m_isConstructor = true;
     m_hasCallNativeFunctionCode = false;
+    m_hasFastNativeFunctionCode = false;
     m_isStrict = scopeCtx->m_isStrict;
     m_hasEval = scopeCtx->m_hasEval;
     m_hasWith = scopeCtx->m_hasWith;
@@ -75,6 +75,15 @@ public:
     NativeFunctionConstructor m_ctorFn;
 };
 
+// fast native function is called without FunctionEnvironmentRecord and ExecutionContext
+// caller's state, callee and caller's argument registers are passed as is
+typedef Value (*FastNativeFunctionPointer)(ExecutionState& state, FunctionObject* callee, const Value& thisValue, size_t argc, Value* argv);
+
+class CallFastNativeFunctionData : public CallNativeFunctionData {
+public:
+    FastNativeFunctionPointer m_fastFn;
+};
+
 class CallBoundFunctionData : public CallNativeFunctionData {
 public:
     void* operator new(size_t size);
@@ -214,6 +223,19 @@ public:
         return m_hasCallNativeFunctionCode;
     }
 
+    // nativeFunctionData() is CallFastNativeFunctionData
+    bool hasFastNativeFunctionCode() const
+    {
+        return m_hasFastNativeFunctionCode;
+    }
+
+    void setHasFastNativeFunctionCode()
+    {
+        ASSERT(m_hasCallNativeFunctionCode);
+        ASSERT(!m_isConstructor);
+        m_hasFastNativeFunctionCode = true;
+    }
+
     bool usesArgumentsObject() const
     {
         return m_usesArgumentsObject;
@@ -305,6 +327,7 @@ protected:
     bool m_isConstructor : 1;
     bool m_isStrict : 1;
     bool m_hasCallNativeFunctionCode : 1;
+    bool m_hasFastNativeFunctionCode : 1;
     bool m_isFunctionNameSaveOnHeap : 1;
     bool m_isFunctionNameExplicitlyDeclared : 1;
     bool m_canUseIndexedVariableStorage : 1;
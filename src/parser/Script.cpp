@@ -30,20 +30,55 @@
 #include "runtime/SandBox.h"
 #include "util/Util.h"
 #include "parser/ast/AST.h"
+#include "parser/Lexer.h"
 
 namespace Escargot {
 
-Value Script::execute(ExecutionState& state, bool isEvalMode, bool needNewEnv, bool isOnGlobal)
+void Script::generateTopCodeBlockByteCodeIfNeeded(ExecutionState& state, bool isEvalMode, bool isOnGlobal)
 {
+    // script from CompiledEvalCache can be executed many times
+    // AST is released after first execution, so bytecode of top code block is reused
+    if (m_topCodeBlock->byteCodeBlock()) {
+        return;
+    }
+
     RefPtr<Node> programNode = m_topCodeBlock->cachedASTNode();
+    ASSERT(programNode && programNode->type() == ASTNodeType::Program);
     if (m_topCodeBlock->m_cachedASTNode) {
         m_topCodeBlock->m_cachedASTNode->deref();
     }
     m_topCodeBlock->m_cachedASTNode = nullptr;
-    ASSERT(programNode && programNode->type() == ASTNodeType::Program);
 
     ByteCodeGenerator g;
     m_topCodeBlock->m_byteCodeBlock = g.generateByteCode(state.context(), m_topCodeBlock, programNode.get(), ((ProgramNode*)programNode.get())->scopeContext(), isEvalMode, isOnGlobal);
+}
+
+size_t Script::lineNumberOf(size_t index)
+{
+    if (!m_lineStartIndexes) {
+        m_lineStartIndexes = new Vector<size_t, GCUtil::gc_malloc_atomic_ignore_off_page_allocator<size_t>>();
+        m_lineStartIndexes->pushBack(0);
+        size_t length = m_src->length();
+        for (size_t i = 0; i < length; i++) {
+            char16_t c = m_src->charAt(i);
+            if (EscargotLexer::isLineTerminator(c)) {
+                // skip \r\n
+                if (c == 13 && i + 1 < length && m_src->charAt(i + 1) == 10) {
+                    i++;
+                }
+                m_lineStartIndexes->pushBack(i + 1);
+            }
+        }
+    }
+
+    auto begin = m_lineStartIndexes->data();
+    auto end = begin + m_lineStartIndexes->size();
+    return std::upper_bound(begin, end, index) - begin - 1;
+}
+
+Value Script::execute(ExecutionState& state, bool isEvalMode, bool needNewEnv, bool isOnGlobal)
+{
+    generateTopCodeBlockByteCodeIfNeeded(state, isEvalMode, isOnGlobal);
 
     LexicalEnvironment* env;
     ExecutionContext* prevEc;
@@ -109,13 +144,6 @@ Script::ScriptSandboxExecuteResult Script::sandboxExecute(ExecutionState& state)
 // NOTE: eval by direct call
 Value Script::executeLocal(ExecutionState& state, Value thisValue, InterpretedCodeBlock* parentCodeBlock, bool isEvalMode, bool needNewRecord)
 {
-    RefPtr<Node> programNode = m_topCodeBlock->cachedASTNode();
-    ASSERT(programNode && programNode->type() == ASTNodeType::Program);
-    if (m_topCodeBlock->m_cachedASTNode) {
-        m_topCodeBlock->m_cachedASTNode->deref();
-    }
-    m_topCodeBlock->m_cachedASTNode = nullptr;
-
     bool isOnGlobal = true;
     FunctionEnvironmentRecord* fnRecord = nullptr;
     {
@@ -130,8 +158,7 @@ Value Script::executeLocal(ExecutionState& state, Value thisValue, InterpretedCo
         }
     }
 
-    ByteCodeGenerator g;
-    m_topCodeBlock->m_byteCodeBlock = g.generateByteCode(state.context(), m_topCodeBlock, programNode.get(), ((ProgramNode*)programNode.get())->scopeContext(), isEvalMode, isOnGlobal);
+    generateTopCodeBlockByteCodeIfNeeded(state, isEvalMode, isOnGlobal);
 
     EnvironmentRecord* record;
     bool inStrict = false;
@@ -154,6 +181,10 @@ Value Script::executeLocal(ExecutionState& state, Value thisValue, InterpretedCo
     for (size_t i = 0; i < len; i++) {
         recordToAddVariable->createBinding(state, vec[i].m_name, inStrict ? false : true, true);
     }
+    if (len && recordToAddVariable == fnRecord && fnRecord->isFunctionEnvironmentRecordNotIndexed()) {
+        // bindings of this record are not decided by its code block anymore
+        ((FunctionEnvironmentRecordNotIndexed*)fnRecord)->didAddBindingsByEval();
+    }
     LexicalEnvironment* newEnvironment = new LexicalEnvironment(record, state.executionContext()->lexicalEnvironment());
 
     ExecutionContext ec(state.context(), state.executionContext(), newEnvironment, m_topCodeBlock->isStrict());
@@ -179,6 +210,9 @@ Value Script::executeLocal(ExecutionState& state, Value thisValue, InterpretedCo
         AtomicString arguments = state.context()->staticStrings().arguments;
         if (fnRecord->hasBinding(newState, arguments).m_index == SIZE_MAX) {
             fnRecord->functionObject()->generateArgumentsObject(newState, fnRecord, nullptr);
+            if (fnRecord->isFunctionEnvironmentRecordNotIndexed()) {
+                ((FunctionEnvironmentRecordNotIndexed*)fnRecord)->didAddBindingsByEval();
+            }
         }
     }
 
@@ -34,6 +34,7 @@ class Script : public gc {
         : m_fileName(fileName)
         , m_src(src)
         , m_topCodeBlock(nullptr)
+        , m_lineStartIndexes(nullptr)
     {
     }
 
@@ -69,11 +70,22 @@ public:
         return m_topCodeBlock;
     }
 
+    // returns 0-based line number of index in src
+    size_t lineNumberOf(size_t index);
+    size_t lineStartIndex(size_t lineNumber)
+    {
+        ASSERT(m_lineStartIndexes && lineNumber < m_lineStartIndexes->size());
+        return (*m_lineStartIndexes)[lineNumber];
+    }
+
 private:
+    void generateTopCodeBlockByteCodeIfNeeded(ExecutionState& state, bool isEvalMode, bool isOnGlobal);
     Value executeLocal(ExecutionState& state, Value thisValue, InterpretedCodeBlock* parentCodeBlock, bool isEvalMode = false, bool needNewEnv = false);
     String* m_fileName;
     String* m_src;
     InterpretedCodeBlock* m_topCodeBlock;
+    // start index of each line in m_src. this is computed on first lookup of source location
+    Vector<size_t, GCUtil::gc_malloc_atomic_ignore_off_page_allocator<size_t>>* m_lineStartIndexes;
 };
 }
 
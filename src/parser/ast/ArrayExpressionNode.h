@@ -22,6 +22,7 @@
 
 #include "ExpressionNode.h"
 #include "ArrayPatternNode.h"
+#include "SpreadElementNode.h"
 
 namespace Escargot {
 
@@ -70,44 +71,83 @@ public:
     virtual ASTNodeType type() { return ASTNodeType::ArrayExpression; }
     virtual void generateExpressionByteCode(ByteCodeBlock* codeBlock, ByteCodeGenerateContext* context, ByteCodeRegisterIndex dstRegister)
     {
-        size_t arrayIndex = codeBlock->currentCodeSize();
-        size_t arrLen = 0;
-        codeBlock->pushCode(CreateArray(ByteCodeLOC(m_loc.index), dstRegister, m_hasSpreadElement), context, this);
-        size_t objIndex = dstRegister;
+        if (m_hasSpreadElement) {
+            generateExpressionByteCodeWithSpreadElement(codeBlock, context, dstRegister);
+        } else {
+            size_t arrayIndex = codeBlock->currentCodeSize();
+            size_t arrLen = 0;
+            codeBlock->pushCode(CreateArray(ByteCodeLOC(m_loc.index), dstRegister), context, this);
+            size_t objIndex = dstRegister;
+            for (size_t i = 0; i < m_elements.size(); i += ARRAY_DEFINE_OPERATION_MERGE_COUNT) {
+                size_t fillCount = 0;
+                size_t regCount = 0;
+                ByteCodeRegisterIndex regs[ARRAY_DEFINE_OPERATION_MERGE_COUNT];
+                for (size_t j = 0; j < ARRAY_DEFINE_OPERATION_MERGE_COUNT && ((i + j) < m_elements.size()); j++) {
+                    arrLen = j + i + 1;
+
+                    ByteCodeRegisterIndex valueIndex = REGISTER_LIMIT;
+                    if (m_elements[i + j]) {
+                        valueIndex = m_elements[i + j]->getRegister(codeBlock, context);
+                        m_elements[i + j]->generateExpressionByteCode(codeBlock, context, valueIndex);
+                        regCount++;
+                    }
+                    fillCount++;
+                    regs[j] = valueIndex;
+                }
+                codeBlock->pushCode(ArrayDefineOwnPropertyOperation(ByteCodeLOC(m_loc.index), objIndex, i, fillCount), context, this);
+                memcpy(codeBlock->peekCode<ArrayDefineOwnPropertyOperation>(codeBlock->lastCodePosition<ArrayDefineOwnPropertyOperation>())->m_loadRegisterIndexs,
+                       regs, sizeof(regs));
+                for (size_t j = 0; j < regCount; j++) {
+                    // drop value register
+                    context->giveUpRegister();
+                }
+            }
+            codeBlock->peekCode<CreateArray>(arrayIndex)->m_length = arrLen;
+        }
+
+        codeBlock->m_shouldClearStack = true;
+
+        if (m_additionalPropertyExpression) {
+            size_t reg = m_additionalPropertyExpression->getRegister(codeBlock, context);
+            m_additionalPropertyExpression->generateExpressionByteCode(codeBlock, context, reg);
+            codeBlock->pushCode(ObjectDefineOwnPropertyWithNameOperation(ByteCodeLOC(m_loc.index), dstRegister, m_additionalPropertyName, reg), context, this);
+            context->giveUpRegister();
+        }
+    }
+
+    // argument of spread element is loaded as is, and ArrayDefineOwnPropertyBySpreadOperation spreads it
+    void generateExpressionByteCodeWithSpreadElement(ByteCodeBlock* codeBlock, ByteCodeGenerateContext* context, ByteCodeRegisterIndex dstRegister)
+    {
+        codeBlock->pushCode(CreateArray(ByteCodeLOC(m_loc.index), dstRegister), context, this);
         for (size_t i = 0; i < m_elements.size(); i += ARRAY_DEFINE_OPERATION_MERGE_COUNT) {
             size_t fillCount = 0;
             size_t regCount = 0;
             ByteCodeRegisterIndex regs[ARRAY_DEFINE_OPERATION_MERGE_COUNT];
+            bool isSpreadElement[ARRAY_DEFINE_OPERATION_MERGE_COUNT] = { false };
             for (size_t j = 0; j < ARRAY_DEFINE_OPERATION_MERGE_COUNT && ((i + j) < m_elements.size()); j++) {
-                arrLen = j + i + 1;
-
                 ByteCodeRegisterIndex valueIndex = REGISTER_LIMIT;
-                if (m_elements[i + j]) {
-                    valueIndex = m_elements[i + j]->getRegister(codeBlock, context);
-                    m_elements[i + j]->generateExpressionByteCode(codeBlock, context, valueIndex);
+                Node* element = m_elements[i + j].get();
+                if (element) {
+                    if (element->type() == ASTNodeType::SpreadElement) {
+                        element = ((SpreadElementNode*)element)->argument();
+                        isSpreadElement[j] = true;
+                    }
+                    valueIndex = element->getRegister(codeBlock, context);
+                    element->generateExpressionByteCode(codeBlock, context, valueIndex);
                     regCount++;
                 }
                 fillCount++;
                 regs[j] = valueIndex;
             }
-            codeBlock->pushCode(ArrayDefineOwnPropertyOperation(ByteCodeLOC(m_loc.index), objIndex, i, fillCount), context, this);
-            memcpy(codeBlock->peekCode<ArrayDefineOwnPropertyOperation>(codeBlock->lastCodePosition<ArrayDefineOwnPropertyOperation>())->m_loadRegisterIndexs,
-                   regs, sizeof(regs));
+            codeBlock->pushCode(ArrayDefineOwnPropertyBySpreadOperation(ByteCodeLOC(m_loc.index), dstRegister, fillCount), context, this);
+            ArrayDefineOwnPropertyBySpreadOperation* code = codeBlock->peekCode<ArrayDefineOwnPropertyBySpreadOperation>(codeBlock->lastCodePosition<ArrayDefineOwnPropertyBySpreadOperation>());
+            memcpy(code->m_loadRegisterIndexs, regs, sizeof(regs));
+            memcpy(code->m_isSpreadElement, isSpreadElement, sizeof(isSpreadElement));
             for (size_t j = 0; j < regCount; j++) {
                 // drop value register
                 context->giveUpRegister();
             }
         }
-        codeBlock->peekCode<CreateArray>(arrayIndex)->m_length = arrLen;
-
-        codeBlock->m_shouldClearStack = true;
-
-        if (m_additionalPropertyExpression) {
-            size_t reg = m_additionalPropertyExpression->getRegister(codeBlock, context);
-            m_additionalPropertyExpression->generateExpressionByteCode(codeBlock, context, reg);
-            codeBlock->pushCode(ObjectDefineOwnPropertyWithNameOperation(ByteCodeLOC(m_loc.index), dstRegister, m_additionalPropertyName, reg), context, this);
-            context->giveUpRegister();
-        }
     }
 
     virtual void iterateChildrenIdentifier(const std::function<void(AtomicString name, bool isAssignment)>& fn)
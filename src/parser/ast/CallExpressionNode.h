@@ -24,6 +24,7 @@
 #include "MemberExpressionNode.h"
 #include "PatternNode.h"
 #include "SuperExpressionNode.h"
+#include "SpreadElementNode.h"
 
 namespace Escargot {
 
@@ -34,7 +35,6 @@ public:
         : ExpressionNode()
         , m_callee(callee)
         , m_arguments(std::move(arguments))
-        , m_hasSpreadElement(false)
     {
     }
 
@@ -56,9 +56,6 @@ public:
             ByteCodeRegisterIndex regs[smallAmountOfArguments];
             for (size_t i = 0; i < m_arguments.size(); i++) {
                 regs[i] = m_arguments[i]->getRegister(codeBlock, context);
-                if (m_arguments[i]->type() == ASTNodeType::SpreadElement) {
-                    m_hasSpreadElement = true;
-                }
             }
 
             bool isSorted = true;
@@ -146,7 +143,8 @@ public:
             codeBlock->pushCode(LoadByName(ByteCodeLOC(m_loc.index), evalIndex, codeBlock->m_codeBlock->context()->staticStrings().eval), context, this);
             size_t startIndex = generateArguments(codeBlock, context, false);
             context->giveUpRegister();
-            codeBlock->pushCode(CallEvalFunction(ByteCodeLOC(m_loc.index), evalIndex, startIndex, m_arguments.size(), dstRegister, context->m_isWithScope, m_hasSpreadElement), context, this);
+            bool* isSpreadElement = SpreadElementNode::generateSpreadElementFlags(codeBlock, m_arguments);
+            codeBlock->pushCode(CallEvalFunction(ByteCodeLOC(m_loc.index), evalIndex, startIndex, m_arguments.size(), dstRegister, context->m_isWithScope, isSpreadElement), context, this);
             return;
         }
 
@@ -164,7 +162,8 @@ public:
             AtomicString calleeName = m_callee->asIdentifier()->name();
             size_t startIndex = generateArguments(codeBlock, context);
             context->m_inCallingExpressionScope = prevInCallingExpressionScope;
-            codeBlock->pushCode(CallFunctionInWithScope(ByteCodeLOC(m_loc.index), calleeName, startIndex, m_arguments.size(), dstRegister, m_hasSpreadElement), context, this);
+            bool* isSpreadElement = SpreadElementNode::generateSpreadElementFlags(codeBlock, m_arguments);
+            codeBlock->pushCode(CallFunctionInWithScope(ByteCodeLOC(m_loc.index), calleeName, startIndex, m_arguments.size(), dstRegister, isSpreadElement), context, this);
             return;
         }
 
@@ -211,8 +210,9 @@ public:
             context->giveUpRegister();
         }
 
-        if (m_hasSpreadElement) {
-            codeBlock->pushCode(CallFunctionWithSpreadElement(ByteCodeLOC(m_loc.index), receiverIndex, calleeIndex, argumentsStartIndex, m_arguments.size(), dstRegister), context, this);
+        bool* isSpreadElement = SpreadElementNode::generateSpreadElementFlags(codeBlock, m_arguments);
+        if (isSpreadElement) {
+            codeBlock->pushCode(CallFunctionWithSpreadElement(ByteCodeLOC(m_loc.index), receiverIndex, calleeIndex, argumentsStartIndex, m_arguments.size(), dstRegister, isSpreadElement), context, this);
         } else if (isCalleeHasReceiver) {
             codeBlock->pushCode(CallFunctionWithReceiver(ByteCodeLOC(m_loc.index), receiverIndex, calleeIndex, argumentsStartIndex, m_arguments.size(), dstRegister), context, this);
         } else {
@@ -235,7 +235,6 @@ public:
 private:
     RefPtr<Node> m_callee; // callee: Expression;
     ArgumentVector m_arguments; // arguments: [ Expression ];
-    bool m_hasSpreadElement : 1;
 };
 }
 
@@ -32,7 +32,6 @@ public:
         : ExpressionNode()
         , m_callee(callee)
         , m_arguments(arguments)
-        , m_hasSpreadElement(false)
     {
     }
 
@@ -51,9 +50,6 @@ public:
             ByteCodeRegisterIndex regs[smallAmountOfArguments];
             for (size_t i = 0; i < m_arguments.size(); i++) {
                 regs[i] = m_arguments[i]->getRegister(codeBlock, context);
-                if (m_arguments[i]->type() == ASTNodeType::SpreadElement) {
-                    m_hasSpreadElement = true;
-                }
             }
 
             bool isSorted = true;
@@ -107,8 +103,9 @@ public:
         // give up callee index
         context->giveUpRegister();
 
-        if (m_hasSpreadElement) {
-            codeBlock->pushCode(NewOperationWithSpreadElement(ByteCodeLOC(m_loc.index), callee, argumentsStartIndex, m_arguments.size(), dstRegister), context, this);
+        bool* isSpreadElement = SpreadElementNode::generateSpreadElementFlags(codeBlock, m_arguments);
+        if (isSpreadElement) {
+            codeBlock->pushCode(NewOperationWithSpreadElement(ByteCodeLOC(m_loc.index), callee, argumentsStartIndex, m_arguments.size(), dstRegister, isSpreadElement), context, this);
         } else {
             codeBlock->pushCode(NewOperation(ByteCodeLOC(m_loc.index), callee, argumentsStartIndex, m_arguments.size(), dstRegister), context, this);
         }
@@ -129,7 +126,6 @@ public:
 private:
     RefPtr<Node> m_callee;
     ArgumentVector m_arguments;
-    bool m_hasSpreadElement : 1;
 };
 }
 
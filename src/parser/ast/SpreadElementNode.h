@@ -41,12 +41,33 @@ public:
         return SpreadElement;
     }
 
+    Node* argument()
+    {
+        return m_arg.get();
+    }
+
+    // spread argument is loaded as is. call bytecode knows which arguments to spread by generateSpreadElementFlags
     virtual void generateExpressionByteCode(ByteCodeBlock* codeBlock, ByteCodeGenerateContext* context, ByteCodeRegisterIndex dstRegister)
     {
-        size_t spreadIndex = m_arg->getRegister(codeBlock, context);
-        m_arg->generateExpressionByteCode(codeBlock, context, spreadIndex);
-        codeBlock->pushCode(CreateSpreadObject(ByteCodeLOC(m_loc.index), dstRegister, spreadIndex), context, this);
-        context->giveUpRegister();
+        m_arg->generateExpressionByteCode(codeBlock, context, dstRegister);
+    }
+
+    // returns flags marking spread elements of argument list, or nullptr when there is no spread element
+    // flags are kept alive by ByteCodeBlock::m_literalData
+    static bool* generateSpreadElementFlags(ByteCodeBlock* codeBlock, const ArgumentVector& arguments)
+    {
+        bool* isSpreadElement = nullptr;
+        for (size_t i = 0; i < arguments.size(); i++) {
+            if (arguments[i]->type() == ASTNodeType::SpreadElement) {
+                if (!isSpreadElement) {
+                    isSpreadElement = (bool*)GC_MALLOC_ATOMIC(sizeof(bool) * arguments.size());
+                    memset(isSpreadElement, 0, sizeof(bool) * arguments.size());
+                    codeBlock->m_literalData.pushBack(isSpreadElement);
+                }
+                isSpreadElement[i] = true;
+            }
+        }
+        return isSpreadElement;
     }
 
 private:
@@ -27,25 +27,23 @@ namespace Escargot {
 
 size_t g_argumentsObjectTag;
 
-static Value ArgumentsObjectNativeGetter(ExecutionState& state, Object* self, FunctionEnvironmentRecord* targetRecord, InterpretedCodeBlock* codeBlock, AtomicString name)
+Value ArgumentsObject::mappedParameterValue(ExecutionState& state, const ArgumentPropertyInfo& info)
 {
-    InterpretedCodeBlock::IdentifierInfo info = codeBlock->identifierInfos()[codeBlock->findName(name)];
-    ASSERT(!info.m_needToAllocateOnStack);
+    ASSERT(info.m_name.string()->length());
     if (info.m_indexForIndexedStorage == SIZE_MAX) {
-        return targetRecord->getBindingValue(state, name).m_value;
+        return m_targetRecord->getBindingValue(state, info.m_name).m_value;
     }
-    return targetRecord->getHeapValueByIndex(info.m_indexForIndexedStorage);
+    return m_targetRecord->getHeapValueByIndex(info.m_indexForIndexedStorage);
 }
 
-static void ArgumentsObjectNativeSetter(ExecutionState& state, Object* self, const Value& setterInputData, FunctionEnvironmentRecord* targetRecord, InterpretedCodeBlock* codeBlock, AtomicString name)
+void ArgumentsObject::setMappedParameterValue(ExecutionState& state, const ArgumentPropertyInfo& info, const Value& value)
 {
-    InterpretedCodeBlock::IdentifierInfo info = codeBlock->identifierInfos()[codeBlock->findName(name)];
-    ASSERT(!info.m_needToAllocateOnStack);
+    ASSERT(info.m_name.string()->length());
     if (info.m_indexForIndexedStorage == SIZE_MAX) {
-        targetRecord->setMutableBinding(state, name, setterInputData);
+        m_targetRecord->setMutableBinding(state, info.m_name, value);
         return;
     }
-    targetRecord->setHeapValueByIndex(info.m_indexForIndexedStorage, setterInputData);
+    m_targetRecord->setHeapValueByIndex(info.m_indexForIndexedStorage, value);
 }
 
 void* ArgumentsObject::operator new(size_t size)
@@ -96,7 +94,8 @@ ArgumentsObject::ArgumentsObject(ExecutionState& state, FunctionEnvironmentRecor
 
     // Let map be the result of creating a new object as if by the expression new Object() where Object is the standard built-in constructor with that name
     // Let mappedNames be an empty List.
-    std::vector<AtomicString> mappedNames;
+    // NOTE: mappedNames is not materialized. names of parameters after indx are the names already mapped
+    const InterpretedCodeBlock::FunctionParametersInfoVector& parameters = blk->parametersInfomation();
     // Let indx = len - 1.
     int64_t indx = ((int64_t)len - 1);
     // Repeat while indx >= 0,
@@ -109,24 +108,36 @@ ArgumentsObject::ArgumentsObject(ExecutionState& state, FunctionEnvironmentRecor
         // Let val be the element of args at 0-origined list position indx.
         Value val = record->argv()[indx];
         // Call the [[DefineOwnProperty]] internal method on obj passing ToString(indx), the property descriptor {[[Value]]: val, [[Writable]]: true, [[Enumerable]]: true, [[Configurable]]: true}, and false as arguments.
-        m_argumentPropertyInfo[indx].first = val;
-        m_argumentPropertyInfo[indx].second = AtomicString();
+        ArgumentPropertyInfo& info = m_argumentPropertyInfo[indx];
+        info.m_value = val;
+        info.m_name = AtomicString();
+        info.m_indexForIndexedStorage = SIZE_MAX;
 
         // If indx is less than the number of elements in names, then
-        if ((size_t)indx < blk->parametersInfomation().size()) {
+        if (!isStrict && (size_t)indx < parameters.size()) {
             // Let name be the element of names at 0-origined list position indx.
-            AtomicString name = blk->parametersInfomation()[indx].m_name;
+            AtomicString name = parameters[indx].m_name;
+            bool isMappedName = false;
+            for (size_t i = indx + 1; i < std::min(len, parameters.size()); i++) {
+                if (parameters[i].m_name == name) {
+                    isMappedName = true;
+                    break;
+                }
+            }
             // If strict is false and name is not an element of mappedNames, then
-            if (!isStrict && std::find(mappedNames.begin(), mappedNames.end(), name) == mappedNames.end()) {
+            if (!isMappedName) {
                 // Add name as an element of the list mappedNames.
-                mappedNames.push_back(name);
                 // Let g be the result of calling the MakeArgGetter abstract operation with arguments name and env.
                 // Let p be the result of calling the MakeArgSetter abstract operation with arguments name and env.
                 // Set the [[ParameterMap]] internal property of obj to map.
                 // Set the [[Get]], [[GetOwnProperty]], [[DefineOwnProperty]], and [[Delete]] internal methods of obj to the definitions provided below.
                 // Call the [[DefineOwnProperty]] internal method of map passing ToString(indx), the Property Descriptor {[[Set]]: p, [[Get]]: g, [[Configurable]]: true}, and false as arguments.
-                m_argumentPropertyInfo[indx].first = Value();
-                m_argumentPropertyInfo[indx].second = name;
+                // NOTE: storage of parameter is resolved once here, so getter and setter don't need to search names
+                const InterpretedCodeBlock::IdentifierInfo& identifierInfo = blk->identifierInfos()[blk->findName(name)];
+                ASSERT(!identifierInfo.m_needToAllocateOnStack);
+                info.m_value = Value();
+                info.m_name = name;
+                info.m_indexForIndexedStorage = identifierInfo.m_indexForIndexedStorage;
             }
         }
         // Let indx = indx - 1
@@ -167,10 +178,11 @@ ObjectGetResult ArgumentsObject::getOwnProperty(ExecutionState& state, const Obj
 {
     uint64_t idx = P.tryToUseAsIndex();
     if (LIKELY(idx != Value::InvalidIndexValue) && idx < m_argumentPropertyInfo.size()) {
-        Value val = m_argumentPropertyInfo[idx].first;
+        const ArgumentPropertyInfo& info = m_argumentPropertyInfo[idx];
+        Value val = info.m_value;
         if (!val.isEmpty()) {
-            if (m_argumentPropertyInfo[idx].second.string()->length()) {
-                return ObjectGetResult(ArgumentsObjectNativeGetter(state, this, m_targetRecord, m_codeBlock, m_argumentPropertyInfo[idx].second), true, true, true);
+            if (info.m_name.string()->length()) {
+                return ObjectGetResult(mappedParameterValue(state, info), true, true, true);
             } else {
                 return ObjectGetResult(val, true, true, true);
             }
@@ -183,29 +195,30 @@ bool ArgumentsObject::defineOwnProperty(ExecutionState& state, const ObjectPrope
 {
     uint64_t idx = P.tryToUseAsIndex();
     if (LIKELY(idx != Value::InvalidIndexValue) && idx < m_argumentPropertyInfo.size()) {
-        Value val = m_argumentPropertyInfo[idx].first;
+        ArgumentPropertyInfo& info = m_argumentPropertyInfo[idx];
+        Value val = info.m_value;
         if (!val.isEmpty()) {
             if (desc.isDataWritableEnumerableConfigurable() || desc.isValuePresentAlone()) {
-                if (m_argumentPropertyInfo[idx].second.string()->length()) {
-                    ArgumentsObjectNativeSetter(state, this, desc.value(), m_targetRecord, m_codeBlock, m_argumentPropertyInfo[idx].second);
+                if (info.m_name.string()->length()) {
+                    setMappedParameterValue(state, info, desc.value());
                     return true;
                 } else {
-                    m_argumentPropertyInfo[idx].first = desc.value();
+                    info.m_value = desc.value();
                     return true;
                 }
             } else {
-                if (m_argumentPropertyInfo[idx].second.string()->length() && desc.isDataDescriptor() && desc.isValuePresent()) {
-                    ArgumentsObjectNativeSetter(state, this, desc.value(), m_targetRecord, m_codeBlock, m_argumentPropertyInfo[idx].second);
+                if (info.m_name.string()->length() && desc.isDataDescriptor() && desc.isValuePresent()) {
+                    setMappedParameterValue(state, info, desc.value());
                 }
                 ObjectPropertyDescriptor descCpy(desc);
                 if (!desc.isAccessorDescriptor() && !desc.isValuePresent()) {
-                    if (m_argumentPropertyInfo[idx].second.string()->length())
-                        descCpy.setValue(ArgumentsObjectNativeGetter(state, this, m_targetRecord, m_codeBlock, m_argumentPropertyInfo[idx].second));
+                    if (info.m_name.string()->length())
+                        descCpy.setValue(mappedParameterValue(state, info));
                     else
-                        descCpy.setValue(m_argumentPropertyInfo[idx].first);
+                        descCpy.setValue(info.m_value);
                 }
 
-                m_argumentPropertyInfo[idx].first = Value(Value::EmptyValue);
+                info.m_value = Value(Value::EmptyValue);
 
                 ObjectPropertyDescriptor newDesc(descCpy);
                 newDesc.setWritable(true);
@@ -241,9 +254,9 @@ bool ArgumentsObject::deleteOwnProperty(ExecutionState& state, const ObjectPrope
 {
     uint64_t idx = P.tryToUseAsIndex();
     if (LIKELY(idx != Value::InvalidIndexValue) && idx < m_argumentPropertyInfo.size()) {
-        Value val = m_argumentPropertyInfo[idx].first;
+        Value val = m_argumentPropertyInfo[idx].m_value;
         if (!val.isEmpty()) {
-            m_argumentPropertyInfo[idx].first = Value(Value::EmptyValue);
+            m_argumentPropertyInfo[idx].m_value = Value(Value::EmptyValue);
             return true;
         }
     }
@@ -253,7 +266,7 @@ bool ArgumentsObject::deleteOwnProperty(ExecutionState& state, const ObjectPrope
 void ArgumentsObject::enumeration(ExecutionState& state, bool (*callback)(ExecutionState& state, Object* self, const ObjectPropertyName&, const ObjectStructurePropertyDescriptor& desc, void* data), void* data, bool shouldSkipSymbolKey)
 {
     for (size_t i = 0; i < m_argumentPropertyInfo.size(); i++) {
-        Value v = m_argumentPropertyInfo[i].first;
+        Value v = m_argumentPropertyInfo[i].m_value;
         if (!v.isEmpty() && !callback(state, this, ObjectPropertyName(state, Value(i)), ObjectStructurePropertyDescriptor::createDataDescriptor(ObjectStructurePropertyDescriptor::AllPresent), data)) {
             return;
         }
@@ -265,10 +278,11 @@ ObjectGetResult ArgumentsObject::getIndexedProperty(ExecutionState& state, const
 {
     Value::ValueIndex idx = property.tryToUseAsIndex(state);
     if (LIKELY(idx != Value::InvalidIndexValue) && idx < m_argumentPropertyInfo.size()) {
-        Value val = m_argumentPropertyInfo[idx].first;
+        const ArgumentPropertyInfo& info = m_argumentPropertyInfo[idx];
+        Value val = info.m_value;
         if (!val.isEmpty()) {
-            if (m_argumentPropertyInfo[idx].second.string()->length()) {
-                return ObjectGetResult(ArgumentsObjectNativeGetter(state, this, m_targetRecord, m_codeBlock, m_argumentPropertyInfo[idx].second), true, true, true);
+            if (info.m_name.string()->length()) {
+                return ObjectGetResult(mappedParameterValue(state, info), true, true, true);
             } else {
                 return ObjectGetResult(val, true, true, true);
             }
@@ -281,17 +295,48 @@ bool ArgumentsObject::setIndexedProperty(ExecutionState& state, const Value& pro
 {
     Value::ValueIndex idx = property.tryToUseAsIndex(state);
     if (LIKELY(idx != Value::InvalidIndexValue) && idx < m_argumentPropertyInfo.size()) {
-        Value val = m_argumentPropertyInfo[idx].first;
+        ArgumentPropertyInfo& info = m_argumentPropertyInfo[idx];
+        Value val = info.m_value;
         if (!val.isEmpty()) {
-            if (m_argumentPropertyInfo[idx].second.string()->length()) {
-                ArgumentsObjectNativeSetter(state, this, value, m_targetRecord, m_codeBlock, m_argumentPropertyInfo[idx].second);
+            if (info.m_name.string()->length()) {
+                setMappedParameterValue(state, info, value);
                 return true;
             } else {
-                m_argumentPropertyInfo[idx].first = value;
+                info.m_value = value;
                 return true;
             }
         }
     }
     return set(state, ObjectPropertyName(state, property), value, this);
 }
+
+bool ArgumentsObject::tryToCopyArguments(ExecutionState& state, Value* argv)
+{
+    // user can change length or add indexed property by changing structure
+    bool isStrict = m_codeBlock->isStrict();
+    if (UNLIKELY(m_structure != (isStrict ? state.context()->defaultStructureForArgumentsObjectInStrictMode() : state.context()->defaultStructureForArgumentsObject()))) {
+        return false;
+    }
+
+    Value length = m_values[ESCARGOT_OBJECT_BUILTIN_PROPERTY_NUMBER];
+    if (UNLIKELY(!length.isUInt32() || length.asUInt32() != m_argumentPropertyInfo.size())) {
+        return false;
+    }
+
+    size_t len = m_argumentPropertyInfo.size();
+    for (size_t i = 0; i < len; i++) {
+        const ArgumentPropertyInfo& info = m_argumentPropertyInfo[i];
+        Value val = info.m_value;
+        if (UNLIKELY(val.isEmpty())) {
+            // deleted or redefined element can be shadowed by prototype or accessor
+            return false;
+        }
+        if (info.m_name.string()->length()) {
+            argv[i] = mappedParameterValue(state, info);
+        } else {
+            argv[i] = val;
+        }
+    }
+    return true;
+}
 }
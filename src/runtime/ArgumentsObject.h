@@ -49,10 +49,31 @@ public:
     void* operator new(size_t size);
     void* operator new[](size_t size) = delete;
 
+    // Fast path for `fn.apply(thisArg, arguments)`
+    // Copies every argument into `argv` when the object is not modified by user (elements and length are intact)
+    // `argv` should have space for `argumentCount()` values
+    bool tryToCopyArguments(ExecutionState& state, Value* argv);
+    size_t argumentCount() const
+    {
+        return m_argumentPropertyInfo.size();
+    }
+
 private:
+    struct ArgumentPropertyInfo {
+        // EmptyValue means this element is deleted or redefined
+        SmallValue m_value;
+        // not-empty name means this element is mapped into parameter
+        AtomicString m_name;
+        // resolved storage index of mapped parameter. SIZE_MAX means we should access parameter by name
+        size_t m_indexForIndexedStorage;
+    };
+
+    Value mappedParameterValue(ExecutionState& state, const ArgumentPropertyInfo& info);
+    void setMappedParameterValue(ExecutionState& state, const ArgumentPropertyInfo& info, const Value& value);
+
     FunctionEnvironmentRecord* m_targetRecord;
     InterpretedCodeBlock* m_codeBlock;
-    TightVector<std::pair<SmallValue, AtomicString>, GCUtil::gc_malloc_ignore_off_page_allocator<std::pair<SmallValue, AtomicString>>> m_argumentPropertyInfo;
+    TightVector<ArgumentPropertyInfo, GCUtil::gc_malloc_ignore_off_page_allocator<ArgumentPropertyInfo>> m_argumentPropertyInfo;
 };
 }
 
@@ -28,14 +28,15 @@ namespace Escargot {
 
 size_t g_arrayObjectTag;
 
-ArrayObject::ArrayObject(ExecutionState& state, bool hasSpreadElement)
+ArrayObject::ArrayObject(ExecutionState& state)
     : Object(state, ESCARGOT_OBJECT_BUILTIN_PROPERTY_NUMBER + 1, true)
+    , m_sparseData(nullptr)
 {
     m_structure = state.context()->defaultStructureForArrayObject();
     m_values[ESCARGOT_OBJECT_BUILTIN_PROPERTY_NUMBER] = Value(0);
     Object::setPrototype(state, state.context()->globalObject()->arrayPrototype());
 
-    if (UNLIKELY(state.context()->vmInstance()->didSomePrototypeObjectDefineIndexedProperty() || hasSpreadElement)) {
+    if (UNLIKELY(state.context()->vmInstance()->didSomePrototypeObjectDefineIndexedProperty())) {
         ensureObjectRareData()->m_isFastModeArrayObject = false;
     }
 }
@@ -60,9 +61,14 @@ ObjectGetResult ArrayObject::getOwnProperty(ExecutionState& state, const ObjectP
     ObjectGetResult v = getFastModeValue(state, P);
     if (LIKELY(v.hasValue())) {
         return v;
-    } else {
-        return Object::getOwnProperty(state, P);
     }
+    if (UNLIKELY(m_sparseData != nullptr)) {
+        v = getSparseValue(state, P);
+        if (v.hasValue()) {
+            return v;
+        }
+    }
+    return Object::getOwnProperty(state, P);
 }
 
 bool ArrayObject::defineOwnProperty(ExecutionState& state, const ObjectPropertyName& P, const ObjectPropertyDescriptor& desc) ESCARGOT_OBJECT_SUBCLASS_MUST_REDEFINE
@@ -78,7 +84,10 @@ bool ArrayObject::defineOwnProperty(ExecutionState& state, const ObjectPropertyN
     if (idx != Value::InvalidArrayIndexValue) {
         if ((idx >= oldLen) && !oldLenDesc.m_descriptor.isWritable())
             return false;
-        bool succeeded = Object::defineOwnProperty(state, P, desc);
+        bool succeeded;
+        if (!defineSparseValue(state, P, desc, succeeded)) {
+            succeeded = Object::defineOwnProperty(state, P, desc);
+        }
         if (!succeeded)
             return false;
         if (idx >= oldLen && ((idx + 1) <= Value::InvalidArrayIndexValue)) {
@@ -131,7 +140,7 @@ bool ArrayObject::defineOwnProperty(ExecutionState& state, const ObjectPropertyN
             while (newLen < oldLen) {
                 oldLen--;
 
-                bool deleteSucceeded = Object::deleteOwnProperty(state, ObjectPropertyName(state, Value(oldLen).toString(state)));
+                bool deleteSucceeded = deleteOwnProperty(state, ObjectPropertyName(state, Value(oldLen)));
                 if (!deleteSucceeded) {
                     newLenDesc.setValue(Value(oldLen + 1));
                     if (!newWritable) {
@@ -176,6 +185,16 @@ bool ArrayObject::deleteOwnProperty(ExecutionState& state, const ObjectPropertyN
                 return true;
             }
         }
+    } else if (m_sparseData != nullptr) {
+        uint64_t idx = P.tryToUseAsArrayIndex();
+        if (idx != Value::InvalidArrayIndexValue) {
+            auto iter = m_sparseData->find((uint32_t)idx);
+            if (iter != m_sparseData->end()) {
+                m_sparseData->erase(iter);
+                rareData()->m_shouldUpdateEnumerateObjectData = true;
+                return true;
+            }
+        }
     }
     return Object::deleteOwnProperty(state, P);
 }
@@ -192,10 +211,77 @@ void ArrayObject::enumeration(ExecutionState& state, bool (*callback)(ExecutionS
                 return;
             }
         }
+    } else if (m_sparseData != nullptr && m_sparseData->size()) {
+        // callback can modify the element store. so we iterate over copied keys
+        std::vector<uint32_t> keys;
+        keys.reserve(m_sparseData->size());
+        for (auto iter = m_sparseData->begin(); iter != m_sparseData->end(); iter++) {
+            keys.push_back(iter->first);
+        }
+        if (UNLIKELY(structure()->hasIndexPropertyName())) {
+            enumerationWithStructureIndexes(state, keys, callback, data, shouldSkipSymbolKey);
+            return;
+        }
+        for (size_t i = 0; i < keys.size(); i++) {
+            if (!callback(state, this, ObjectPropertyName(state, Value(keys[i])), ObjectStructurePropertyDescriptor::createDataDescriptor(ObjectStructurePropertyDescriptor::AllPresent), data)) {
+                return;
+            }
+        }
     }
     Object::enumeration(state, callback, data, shouldSkipSymbolKey);
 }
 
+// elements with non-default attributes are in ObjectStructure, and the others are in sparse element store
+// indexes of both are merged, so they are enumerated in ascending order before other properties
+void ArrayObject::enumerationWithStructureIndexes(ExecutionState& state, const std::vector<uint32_t>& sparseKeys, bool (*callback)(ExecutionState& state, Object* self, const ObjectPropertyName&, const ObjectStructurePropertyDescriptor& desc, void* data), void* data, bool shouldSkipSymbolKey)
+{
+    ObjectStructure structure(*m_structure);
+    size_t cnt = structure.propertyCount();
+
+    // pairs of index and position in structure
+    std::vector<std::pair<uint32_t, size_t>> structureIndexes;
+    for (size_t i = 0; i < cnt; i++) {
+        const ObjectStructureItem& item = structure.readProperty(state, i);
+        if (item.m_propertyName.isSymbol()) {
+            continue;
+        }
+        uint64_t idx = ObjectPropertyName(state, item.m_propertyName).tryToUseAsArrayIndex();
+        if (idx != Value::InvalidArrayIndexValue) {
+            structureIndexes.push_back(std::make_pair((uint32_t)idx, i));
+        }
+    }
+    std::sort(structureIndexes.begin(), structureIndexes.end());
+
+    size_t i = 0, j = 0;
+    while (i < sparseKeys.size() || j < structureIndexes.size()) {
+        bool fromSparse = j == structureIndexes.size() || (i < sparseKeys.size() && sparseKeys[i] < structureIndexes[j].first);
+        bool result;
+        if (fromSparse) {
+            result = callback(state, this, ObjectPropertyName(state, Value(sparseKeys[i++])), ObjectStructurePropertyDescriptor::createDataDescriptor(ObjectStructurePropertyDescriptor::AllPresent), data);
+        } else {
+            const ObjectStructureItem& item = structure.readProperty(state, structureIndexes[j++].second);
+            result = callback(state, this, ObjectPropertyName(state, item.m_propertyName), item.m_descriptor, data);
+        }
+        if (!result) {
+            return;
+        }
+    }
+
+    for (size_t k = 0; k < cnt; k++) {
+        const ObjectStructureItem& item = structure.readProperty(state, k);
+        if (item.m_propertyName.isSymbol()) {
+            if (shouldSkipSymbolKey) {
+                continue;
+            }
+        } else if (ObjectPropertyName(state, item.m_propertyName).tryToUseAsArrayIndex() != Value::InvalidArrayIndexValue) {
+            continue;
+        }
+        if (!callback(state, this, ObjectPropertyName(state, item.m_propertyName), item.m_descriptor, data)) {
+            return;
+        }
+    }
+}
+
 void ArrayObject::sort(ExecutionState& state, const std::function<bool(const Value& a, const Value& b)>& comp)
 {
     if (isFastModeArray()) {
@@ -254,10 +340,16 @@ void ArrayObject::convertIntoNonFastMode(ExecutionState& state)
 
     ensureObjectRareData()->m_isFastModeArrayObject = false;
 
+    // every element of fast-mode array is {writable:true, enumerable:true, configurable:true}
+    // so we can move them into sparse element store without going through ObjectStructure
     auto length = getArrayLength(state);
+    ArraySparseElementMap* sparseData = nullptr;
     for (size_t i = 0; i < length; i++) {
         if (!m_fastModeData[i].isEmpty()) {
-            defineOwnPropertyThrowsExceptionWhenStrictMode(state, ObjectPropertyName(state, Value(i)), ObjectPropertyDescriptor(m_fastModeData[i], ObjectPropertyDescriptor::AllPresent));
+            if (sparseData == nullptr) {
+                sparseData = ensureSparseData();
+            }
+            sparseData->insert(sparseData->end(), std::make_pair((uint32_t)i, m_fastModeData[i]));
         }
     }
 
@@ -284,7 +376,15 @@ bool ArrayObject::setArrayLength(ExecutionState& state, const uint64_t newLength
         }
         return true;
     } else {
-        if (!isInArrayObjectDefineOwnProperty()) {
+        if (!isInArrayObjectDefineOwnProperty() && m_sparseData != nullptr && !structure()->hasIndexPropertyName()) {
+            // every element is in sparse element store and they are all configurable
+            // so we can remove elements at once
+            auto iter = m_sparseData->lower_bound((uint32_t)std::min(newLength, (uint64_t)Value::InvalidArrayIndexValue));
+            if (iter != m_sparseData->end()) {
+                m_sparseData->erase(iter, m_sparseData->end());
+                ensureObjectRareData()->m_shouldUpdateEnumerateObjectData = true;
+            }
+        } else if (!isInArrayObjectDefineOwnProperty()) {
             auto oldLenDesc = structure()->readProperty(state, (size_t)0);
 
             int64_t oldLen = length(state);
@@ -384,6 +484,14 @@ ObjectGetResult ArrayObject::getIndexedProperty(ExecutionState& state, const Val
             }
             return get(state, ObjectPropertyName(state, property));
         }
+    } else if (m_sparseData != nullptr) {
+        uint32_t idx = property.tryToUseAsArrayIndex(state);
+        if (LIKELY(idx != Value::InvalidArrayIndexValue)) {
+            auto iter = m_sparseData->find(idx);
+            if (iter != m_sparseData->end()) {
+                return ObjectGetResult(iter->second, true, true, true);
+            }
+        }
     }
     return get(state, ObjectPropertyName(state, property));
 }
@@ -405,10 +513,126 @@ bool ArrayObject::setIndexedProperty(ExecutionState& state, const Value& propert
             m_fastModeData[idx] = value;
             return true;
         }
+    } else if (m_sparseData != nullptr) {
+        uint32_t idx = property.tryToUseAsArrayIndex(state);
+        if (LIKELY(idx != Value::InvalidArrayIndexValue)) {
+            auto iter = m_sparseData->find(idx);
+            if (iter != m_sparseData->end()) {
+                // elements in sparse element store are always writable
+                iter->second = value;
+                return true;
+            }
+        }
     }
     return set(state, ObjectPropertyName(state, property), value, this);
 }
 
+ObjectGetResult ArrayObject::getSparseValue(ExecutionState& state, const ObjectPropertyName& P)
+{
+    ASSERT(m_sparseData != nullptr);
+    uint64_t idx = P.tryToUseAsArrayIndex();
+    if (idx != Value::InvalidArrayIndexValue) {
+        auto iter = m_sparseData->find((uint32_t)idx);
+        if (iter != m_sparseData->end()) {
+            return ObjectGetResult(iter->second, true, true, true);
+        }
+    }
+    return ObjectGetResult();
+}
+
+bool ArrayObject::defineSparseValue(ExecutionState& state, const ObjectPropertyName& P, const ObjectPropertyDescriptor& desc, bool& succeeded)
+{
+    if (isFastModeArray()) {
+        return false;
+    }
+
+    uint64_t idx = P.tryToUseAsArrayIndex();
+    ASSERT(idx != Value::InvalidArrayIndexValue);
+
+    bool keepsDefaultAttribute = desc.isDataDescriptor() && (!desc.isWritablePresent() || desc.isWritable())
+        && (!desc.isEnumerablePresent() || desc.isEnumerable()) && (!desc.isConfigurablePresent() || desc.isConfigurable());
+
+    if (m_sparseData != nullptr) {
+        auto iter = m_sparseData->find((uint32_t)idx);
+        if (iter != m_sparseData->end()) {
+            if (LIKELY(keepsDefaultAttribute)) {
+                if (desc.isValuePresent()) {
+                    iter->second = desc.value();
+                }
+                succeeded = true;
+                return true;
+            }
+            // attribute of element is going to be changed.
+            // move the element into ObjectStructure then let Object::defineOwnProperty validate the descriptor.
+            // moving an existing element should not be rejected by non-extensible array
+            Value oldValue = iter->second;
+            m_sparseData->erase(iter);
+            bool isExtensible = rareData()->m_isExtensible;
+            rareData()->m_isExtensible = true;
+            Object::defineOwnProperty(state, P, ObjectPropertyDescriptor(oldValue, ObjectPropertyDescriptor::AllPresent));
+            rareData()->m_isExtensible = isExtensible;
+            succeeded = Object::defineOwnProperty(state, P, desc);
+            return true;
+        }
+    }
+
+    if (!desc.isDataWritableEnumerableConfigurable()) {
+        return false;
+    }
+
+    if (structure()->hasIndexPropertyName() && structure()->findProperty(state, P.toPropertyName(state)) != SIZE_MAX) {
+        return false;
+    }
+
+    if (UNLIKELY(!isExtensible(state))) {
+        succeeded = false;
+        return true;
+    }
+
+    if (UNLIKELY(isEverSetAsPrototypeObject() && !state.context()->vmInstance()->didSomePrototypeObjectDefineIndexedProperty())) {
+        state.context()->vmInstance()->somePrototypeObjectDefineIndexedProperty(state);
+    }
+
+    ensureSparseData()->insert(std::make_pair((uint32_t)idx, SmallValue(desc.value())));
+    succeeded = true;
+    return true;
+}
+
+bool ArrayObject::nextSparseIndexForward(const double cur, const double end, const bool skipUndefined, double& nextIndex)
+{
+    ASSERT(m_sparseData != nullptr);
+    if (cur >= Value::InvalidArrayIndexValue) {
+        return false;
+    }
+    auto iter = cur < 0 ? m_sparseData->begin() : m_sparseData->upper_bound((uint32_t)cur);
+    for (; iter != m_sparseData->end() && iter->first < end; iter++) {
+        if (skipUndefined && Value(iter->second).isUndefined()) {
+            continue;
+        }
+        nextIndex = iter->first;
+        return true;
+    }
+    return false;
+}
+
+bool ArrayObject::nextSparseIndexBackward(const double cur, const double end, const bool skipUndefined, double& nextIndex)
+{
+    ASSERT(m_sparseData != nullptr);
+    if (cur <= 0) {
+        return false;
+    }
+    auto iter = cur > Value::InvalidArrayIndexValue ? m_sparseData->end() : m_sparseData->lower_bound((uint32_t)std::ceil(cur));
+    while (iter != m_sparseData->begin()) {
+        iter--;
+        if (skipUndefined && Value(iter->second).isUndefined()) {
+            continue;
+        }
+        nextIndex = std::max(static_cast<double>(iter->first), end);
+        return true;
+    }
+    return false;
+}
+
 bool ArrayObject::preventExtensions(ExecutionState& state)
 {
     // first, convert to non-fast-mode.
@@ -417,6 +641,67 @@ bool ArrayObject::preventExtensions(ExecutionState& state)
     return Object::preventExtensions(state);
 }
 
+bool ArrayObject::isFastModeArrayWithBuiltinIterator(ExecutionState& state)
+{
+    if (UNLIKELY(!isFastModeArray())) {
+        return false;
+    }
+
+    GlobalObject* globalObject = state.context()->globalObject();
+    Object* arrayPrototype = globalObject->arrayPrototype();
+    if (UNLIKELY(getPrototypeObject(state) != arrayPrototype)) {
+        return false;
+    }
+
+    ObjectPropertyName iteratorName(state, state.context()->vmInstance()->globalSymbols().iterator);
+    if (UNLIKELY(getOwnProperty(state, iteratorName).hasValue())) {
+        return false;
+    }
+
+    ObjectGetResult result = arrayPrototype->getOwnProperty(state, iteratorName);
+    if (UNLIKELY(!result.hasValue() || !result.isDataProperty() || result.value(state, arrayPrototype) != Value(globalObject->arrayPrototypeValues()))) {
+        return false;
+    }
+
+    Object* arrayIteratorPrototype = globalObject->arrayIteratorPrototype();
+    result = arrayIteratorPrototype->getOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().next));
+    return result.hasValue() && result.isDataProperty() && result.value(state, arrayIteratorPrototype) == Value(globalObject->arrayIteratorPrototypeNext());
+}
+
+bool ArrayObject::tryToCopyFastModeElements(ExecutionState& state, Value* out)
+{
+    if (UNLIKELY(!isFastModeArray())) {
+        return false;
+    }
+
+    bool isHoleUndefined = false;
+    uint32_t length = getArrayLength(state);
+    for (uint32_t i = 0; i < length; i++) {
+        Value v = m_fastModeData[i];
+        if (UNLIKELY(v.isEmpty())) {
+            if (!isHoleUndefined) {
+                if (!canReadHoleAsUndefined(state)) {
+                    return false;
+                }
+                isHoleUndefined = true;
+            }
+            v = Value();
+        }
+        out[i] = v;
+    }
+    return true;
+}
+
+bool ArrayObject::canReadHoleAsUndefined(ExecutionState& state)
+{
+    // prototypes have no indexed property while fast mode array exists
+    // but an exotic object like Proxy can be anywhere in the prototype chain, so only the default chain is accepted
+    GlobalObject* globalObject = state.context()->globalObject();
+    Object* arrayPrototype = globalObject->arrayPrototype();
+    Object* objectPrototype = globalObject->objectPrototype();
+    return getPrototypeObject(state) == arrayPrototype && arrayPrototype->getPrototypeObject(state) == objectPrototype && !objectPrototype->getPrototypeObject(state);
+}
+
 ArrayIteratorObject::ArrayIteratorObject(ExecutionState& state, Object* a, Type type)
     : IteratorObject(state)
     , m_array(a)
@@ -33,6 +33,11 @@ extern size_t g_arrayObjectTag;
 
 class ArrayIteratorObject;
 
+// Element store of non-fast-mode ArrayObject.
+// Only holds plain data elements ({writable, enumerable, configurable} are all true)
+// keyed by index. Elements with other attributes are stored in ObjectStructure.
+typedef std::map<uint32_t, SmallValue, std::less<uint32_t>, gc_allocator<std::pair<const uint32_t, SmallValue>>> ArraySparseElementMap;
+
 class ArrayObject : public Object {
     friend class VMInstance;
     friend class Context;
@@ -43,7 +48,7 @@ class ArrayObject : public Object {
     friend int getValidValueInArrayObject(void* ptr, GC_mark_custom_result* arr);
 
 public:
-    explicit ArrayObject(ExecutionState& state, bool hasSpreadElement = false);
+    explicit ArrayObject(ExecutionState& state);
     ArrayObject(ExecutionState& state, double size); // http://www.ecma-international.org/ecma-262/7.0/index.html#sec-arraycreate
     virtual bool isArrayObject() const override
     {
@@ -69,6 +74,15 @@ public:
     virtual bool setIndexedProperty(ExecutionState& state, const Value& property, const Value& value) override;
     virtual bool preventExtensions(ExecutionState&) override;
 
+    // returns true when iterating this array with the builtin iterator only reads its elements in order
+    // so spread can read elements directly without making an iterator
+    bool isFastModeArrayWithBuiltinIterator(ExecutionState& state);
+    // copies length() elements into `out` when this array is in fast mode. holes are copied as undefined
+    // returns false when this array is not in fast mode, or has a hole which cannot be read as undefined
+    bool tryToCopyFastModeElements(ExecutionState& state, Value* out);
+    // returns true when prototype chain of this array is Array.prototype, Object.prototype and null
+    bool canReadHoleAsUndefined(ExecutionState& state);
+
     // Use custom allocator for Array object (for Badtime)
     void* operator new(size_t size);
     void* operator new[](size_t size) = delete;
@@ -112,7 +126,25 @@ private:
     ObjectGetResult getFastModeValue(ExecutionState& state, const ObjectPropertyName& P);
     bool setFastModeValue(ExecutionState& state, const ObjectPropertyName& P, const ObjectPropertyDescriptor& desc);
 
+    ArraySparseElementMap* ensureSparseData()
+    {
+        ASSERT(!isFastModeArray());
+        if (m_sparseData == nullptr) {
+            m_sparseData = new (GC) ArraySparseElementMap();
+        }
+        return m_sparseData;
+    }
+
+    ObjectGetResult getSparseValue(ExecutionState& state, const ObjectPropertyName& P);
+    // returns true when P is handled by sparse element store. result of define is stored into `succeeded`
+    bool defineSparseValue(ExecutionState& state, const ObjectPropertyName& P, const ObjectPropertyDescriptor& desc, bool& succeeded);
+    // same contract with Object::nextIndexForward/nextIndexBackward, but only searches sparse element store
+    bool nextSparseIndexForward(const double cur, const double end, const bool skipUndefined, double& nextIndex);
+    bool nextSparseIndexBackward(const double cur, const double end, const bool skipUndefined, double& nextIndex);
+    void enumerationWithStructureIndexes(ExecutionState& state, const std::vector<uint32_t>& sparseKeys, bool (*callback)(ExecutionState& state, Object* self, const ObjectPropertyName&, const ObjectStructurePropertyDescriptor& desc, void* data), void* data, bool shouldSkipSymbolKey);
+
     VectorWithNoSize<SmallValue, GCUtil::gc_malloc_ignore_off_page_allocator<SmallValue>> m_fastModeData;
+    ArraySparseElementMap* m_sparseData;
 };
 
 class ArrayIteratorObject : public IteratorObject {
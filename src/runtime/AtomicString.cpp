@@ -20,6 +20,7 @@
 #include "Escargot.h"
 #include "AtomicString.h"
 #include "Context.h"
+#include "PropertyName.h"
 
 namespace Escargot {
 
@@ -61,26 +62,34 @@ AtomicString::AtomicString(ExecutionState& ec, String* name)
     init(ec.context()->m_atomicStringMap, name);
 }
 
+AtomicString AtomicString::fromPropertyKey(ExecutionState& ec, String* name)
+{
+    AtomicString ret;
+    ret.initWeakly(ec.context()->m_atomicStringMap, name);
+    return ret;
+}
+
 AtomicString::AtomicString(Context* c, const SourceStringView& sv)
 {
     size_t v = sv.getTagInFirstDataArea();
-    if (v > POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA) {
-        m_string = (String*)(v & ~POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA);
+    if (LIKELY(v > POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA && !(v & ATOMIC_STRING_WEAK_TAG_IN_DATA))) {
+        m_string = (String*)(v & ~ATOMIC_STRING_TAG_MASK);
         return;
     }
 
     AtomicStringMap* ec = c->atomicStringMap();
     SourceStringView& str = const_cast<SourceStringView&>(sv);
     String* name = &str;
-    auto iter = ec->find(name);
-    if (ec->end() == iter) {
+    String* found = ec->lookup(name, true);
+    if (!found) {
         SourceStringView* newSv = new SourceStringView(sv);
         ec->insert(newSv);
         ASSERT(ec->find(newSv) != ec->end());
         m_string = newSv;
+        newSv->m_tag = (size_t)POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA | (size_t)m_string;
         str.m_tag = (size_t)POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA | (size_t)m_string;
     } else {
-        m_string = iter.operator*();
+        m_string = found;
         str.m_tag = (size_t)POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA | (size_t)m_string;
     }
 }
@@ -88,23 +97,24 @@ AtomicString::AtomicString(Context* c, const SourceStringView& sv)
 AtomicString::AtomicString(Context* c, const StringView& sv)
 {
     size_t v = sv.getTagInFirstDataArea();
-    if (v > POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA) {
-        m_string = (String*)(v & ~POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA);
+    if (LIKELY(v > POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA && !(v & ATOMIC_STRING_WEAK_TAG_IN_DATA))) {
+        m_string = (String*)(v & ~ATOMIC_STRING_TAG_MASK);
         return;
     }
 
     AtomicStringMap* ec = c->atomicStringMap();
     StringView& str = const_cast<StringView&>(sv);
     String* name = &str;
-    auto iter = ec->find(name);
-    if (ec->end() == iter) {
+    String* found = ec->lookup(name, true);
+    if (!found) {
         StringView* newSv = new StringView(sv);
         ec->insert(newSv);
         ASSERT(ec->find(newSv) != ec->end());
         m_string = newSv;
+        newSv->m_tag = (size_t)POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA | (size_t)m_string;
         str.m_tag = (size_t)POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA | (size_t)m_string;
     } else {
-        m_string = iter.operator*();
+        m_string = found;
         str.m_tag = (size_t)POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA | (size_t)m_string;
     }
 }
@@ -117,19 +127,130 @@ AtomicString::AtomicString(Context* c, String* name)
 void AtomicString::init(AtomicStringMap* ec, String* name)
 {
     size_t v = name->getTagInFirstDataArea();
-    if (v > POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA) {
-        m_string = (String*)(v & ~POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA);
+    if (LIKELY(v > POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA && !(v & ATOMIC_STRING_WEAK_TAG_IN_DATA))) {
+        m_string = (String*)(v & ~ATOMIC_STRING_TAG_MASK);
         return;
     }
-    auto iter = ec->find(name);
-    if (ec->end() == iter) {
+    String* found = ec->lookup(name, true);
+    if (!found) {
         ec->insert(name);
         ASSERT(ec->find(name) != ec->end());
         m_string = name;
         name->m_tag = (size_t)POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA | (size_t)m_string;
     } else {
-        m_string = iter.operator*();
+        m_string = found;
         name->m_tag = (size_t)POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA | (size_t)m_string;
     }
 }
+
+void AtomicString::initWeakly(AtomicStringMap* ec, String* name)
+{
+    size_t v = name->getTagInFirstDataArea();
+    if (LIKELY(v > POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA)) {
+        m_string = (String*)(v & ~ATOMIC_STRING_TAG_MASK);
+        return;
+    }
+    String* found = ec->lookup(name, false);
+    if (!found) {
+        ec->insertWeakly(name);
+        m_string = name;
+    } else {
+        m_string = found;
+        name->m_tag = (found->m_tag & ATOMIC_STRING_WEAK_TAG_IN_DATA) | (size_t)POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA | (size_t)m_string;
+    }
+}
+
+void AtomicStringMap::registerGCDisplacements()
+{
+    // weak atomic strings can be referenced only by tagged pointers(PropertyName and String::m_tag)
+    // registering same displacement again does nothing
+    GC_register_displacement(PROPERTY_NAME_ATOMIC_STRING_VIAS);
+    GC_register_displacement(POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA);
+    GC_register_displacement(ATOMIC_STRING_TAG_MASK);
+}
+
+AtomicStringMap::~AtomicStringMap()
+{
+    // VMInstance can be destroyed before GC reclaims weak entries
+    for (WeakAtomicStringItem* item : m_weakStrings) {
+        if (item->m_string) {
+            GC_unregister_disappearing_link((void**)&item->m_string);
+        }
+        delete item;
+    }
+}
+
+void AtomicStringMap::sweepWeakStringsIfNeeded()
+{
+    size_t gcNumber = GC_get_gc_no();
+    if (LIKELY(m_lastSweptGCNumber == gcNumber)) {
+        return;
+    }
+    m_lastSweptGCNumber = gcNumber;
+
+    size_t reclaimed = 0;
+    auto iter = m_weakStrings.begin();
+    while (iter != m_weakStrings.end()) {
+        WeakAtomicStringItem* item = *iter;
+        if (item->m_string) {
+            iter++;
+        } else {
+            iter = m_weakStrings.erase(iter);
+            delete item;
+            reclaimed++;
+        }
+    }
+
+    m_reclaimedCountInLastSweep = reclaimed;
+    m_totalReclaimedCount += reclaimed;
+}
+
+String* AtomicStringMap::lookup(String* name, bool shouldMakeStrong)
+{
+    auto iter = AtomicStringMapStd::find(name);
+    if (iter != end()) {
+        return *iter;
+    }
+
+    if (m_weakStrings.empty()) {
+        return nullptr;
+    }
+
+    sweepWeakStringsIfNeeded();
+
+    WeakAtomicStringItem key = { name, name->hashValue() };
+    auto weakIter = m_weakStrings.find(&key);
+    if (weakIter == m_weakStrings.end()) {
+        return nullptr;
+    }
+
+    WeakAtomicStringItem* item = *weakIter;
+    String* found = item->m_string;
+    ASSERT(found);
+    if (shouldMakeStrong) {
+        // strong entry can be stored where GC does not trace
+        // so the string should not be reclaimed anymore
+        m_weakStrings.erase(weakIter);
+        GC_unregister_disappearing_link((void**)&item->m_string);
+        delete item;
+        found->m_tag = (size_t)POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA | (size_t)found;
+        insert(found);
+    }
+    return found;
+}
+
+void AtomicStringMap::insertWeakly(String* name)
+{
+    ASSERT(AtomicStringMapStd::find(name) == end());
+
+    sweepWeakStringsIfNeeded();
+
+    WeakAtomicStringItem* item = new WeakAtomicStringItem();
+    item->m_string = name;
+    item->m_hashValue = name->hashValue();
+    ASSERT(m_weakStrings.find(item) == m_weakStrings.end());
+    m_weakStrings.insert(item);
+    GC_GENERAL_REGISTER_DISAPPEARING_LINK((void**)&item->m_string, name);
+    name->m_tag = (size_t)POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA | ATOMIC_STRING_WEAK_TAG_IN_DATA | (size_t)name;
+}
 }
@@ -27,7 +27,96 @@
 
 namespace Escargot {
 
-typedef std::unordered_set<String*, std::hash<String*>, std::equal_to<String*>, GCUtil::gc_malloc_ignore_off_page_allocator<String*> > AtomicStringMap;
+// String::m_tag is [pointer of atomic string | POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA | (ATOMIC_STRING_WEAK_TAG_IN_DATA)]
+// if string is already interned. ATOMIC_STRING_WEAK_TAG_IN_DATA means the atomic string is a weak entry
+#define ATOMIC_STRING_WEAK_TAG_IN_DATA 0x4
+#define ATOMIC_STRING_TAG_MASK (POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA | ATOMIC_STRING_WEAK_TAG_IN_DATA)
+
+typedef std::unordered_set<String*, std::hash<String*>, std::equal_to<String*>, GCUtil::gc_malloc_ignore_off_page_allocator<String*> > AtomicStringMapStd;
+// weak entry of AtomicStringMap
+// this is allocated by malloc, so GC does not trace m_string
+// m_string is registered as disappearing link, GC clears it when the string is reclaimed
+struct WeakAtomicStringItem {
+    String* m_string;
+    size_t m_hashValue;
+};
+
+struct WeakAtomicStringItemHash {
+    size_t operator()(WeakAtomicStringItem* const& x) const
+    {
+        return x->m_hashValue;
+    }
+};
+
+struct WeakAtomicStringItemEqual {
+    bool operator()(WeakAtomicStringItem* const& a, WeakAtomicStringItem* const& b) const
+    {
+        if (a == b) {
+            return true;
+        }
+        return a->m_string && b->m_string && a->m_string->equals(b->m_string);
+    }
+};
+
+typedef std::unordered_set<WeakAtomicStringItem*, WeakAtomicStringItemHash, WeakAtomicStringItemEqual, std::allocator<WeakAtomicStringItem*> > WeakAtomicStringSet;
+
+// AtomicStringMap holds two kinds of entries
+// - strong entries: names from parser, static strings, builtins and public API.
+//   these can be stored in memory that GC does not trace(bytecode, atomic vectors...), so they live forever
+// - weak entries: names made at runtime from property keys(e.g. obj[key]).
+//   these are only referenced by traced memory(PropertyName in ObjectStructure, m_tag of other strings...)
+//   and removed from the table after GC reclaims them
+// a weak entry becomes strong if it is requested from strong path later
+class AtomicStringMap : public AtomicStringMapStd {
+    friend class AtomicString;
+
+public:
+    AtomicStringMap()
+        : m_reclaimedCountInLastSweep(0)
+        , m_totalReclaimedCount(0)
+        , m_lastSweptGCNumber(0)
+    {
+        registerGCDisplacements();
+    }
+
+    ~AtomicStringMap();
+
+    // entries reclaimed by GC are removed lazily, on next runtime lookup
+    size_t tableSize() const
+    {
+        return size() + m_weakStrings.size();
+    }
+
+    size_t weakEntryCount() const
+    {
+        return m_weakStrings.size();
+    }
+
+    // count of weak entries removed by the last sweep
+    // sweep runs lazily on the first runtime lookup after GC, so this can cover several GC cycles
+    size_t reclaimedCountInLastSweep() const
+    {
+        return m_reclaimedCountInLastSweep;
+    }
+
+    size_t totalReclaimedCount() const
+    {
+        return m_totalReclaimedCount;
+    }
+
+    // removes weak entries reclaimed by GC. does nothing if there was no GC since last sweep
+    void sweepWeakStringsIfNeeded();
+
+private:
+    static void registerGCDisplacements();
+    String* lookup(String* name, bool shouldMakeStrong);
+    void insertWeakly(String* name);
+
+    WeakAtomicStringSet m_weakStrings;
+    size_t m_reclaimedCountInLastSweep;
+    size_t m_totalReclaimedCount;
+    size_t m_lastSweptGCNumber;
+};
 
 class AtomicString : public gc {
     friend class StaticStrings;
@@ -96,6 +185,9 @@ public:
 
 private:
     void init(AtomicStringMap* ec, String* name);
+    // property names made at runtime are interned weakly. see AtomicStringMap
+    static AtomicString fromPropertyKey(ExecutionState& ec, String* name);
+    void initWeakly(AtomicStringMap* ec, String* name);
     void init(AtomicStringMap* ec, const LChar* str, size_t len)
     {
         init(ec, new Latin1String(str, len));
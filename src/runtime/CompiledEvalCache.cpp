@@ -17,32 +17,21 @@
  *  USA
  */
 
-#ifndef __EscargotSpreadObject__
-#define __EscargotSpreadObject__
-
-#include "runtime/Object.h"
+#include "Escargot.h"
+#include "CompiledEvalCache.h"
 
 namespace Escargot {
 
-class SpreadObject : public Object {
-public:
-    SpreadObject(ExecutionState& state, const Value spreadValue);
-
-    const Value spreadValue()
-    {
-        return m_spreadValue;
-    }
-
-    virtual bool isSpreadObject() const
-    {
-        return true;
+void CompiledEvalCache::insert(const CompiledEvalCacheKey& key, Script* script)
+{
+    ASSERT(canCache(key.m_source));
+    ASSERT(m_scripts.find(key) == m_scripts.end());
+    if (m_scripts.size() >= COMPILED_EVAL_CACHE_SIZE_MAX) {
+        m_scripts.erase(m_insertionOrder.front());
+        m_insertionOrder.pop_front();
     }
 
-    void* operator new(size_t size);
-
-private:
-    const SmallValue m_spreadValue;
-};
+    m_scripts.insert(std::make_pair(key, script));
+    m_insertionOrder.push_back(key);
+}
 }
-
-#endif
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2019-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotCompiledEvalCache__
+#define __EscargotCompiledEvalCache__
+
+#include "runtime/String.h"
+
+namespace Escargot {
+
+class Script;
+class InterpretedCodeBlock;
+
+#ifndef COMPILED_EVAL_CACHE_SIZE_MAX
+#define COMPILED_EVAL_CACHE_SIZE_MAX 64
+#endif
+
+#ifndef COMPILED_EVAL_CACHE_SOURCE_LENGTH_MAX
+#define COMPILED_EVAL_CACHE_SOURCE_LENGTH_MAX 1024
+#endif
+
+struct CompiledEvalCacheKey {
+    CompiledEvalCacheKey(String* source, InterpretedCodeBlock* parentCodeBlock, bool strictFromOutside, bool isEvalCodeInFunction, bool isFunctionConstructorSource)
+        : m_source(source)
+        , m_parentCodeBlock(parentCodeBlock)
+        , m_strictFromOutside(strictFromOutside)
+        , m_isEvalCodeInFunction(isEvalCodeInFunction)
+        , m_isFunctionConstructorSource(isFunctionConstructorSource)
+    {
+    }
+
+    bool operator==(const CompiledEvalCacheKey& otherKey) const
+    {
+        return m_parentCodeBlock == otherKey.m_parentCodeBlock && m_strictFromOutside == otherKey.m_strictFromOutside
+            && m_isEvalCodeInFunction == otherKey.m_isEvalCodeInFunction && m_isFunctionConstructorSource == otherKey.m_isFunctionConstructorSource
+            && m_source->equals(otherKey.m_source);
+    }
+
+    String* m_source;
+    // code block which calls direct eval. identifiers of eval code are resolved with its layout
+    // nullptr for indirect eval and Function constructor
+    InterpretedCodeBlock* m_parentCodeBlock;
+    bool m_strictFromOutside : 1;
+    bool m_isEvalCodeInFunction : 1;
+    bool m_isFunctionConstructorSource : 1;
+};
+}
+
+namespace std {
+
+template <>
+struct hash<Escargot::CompiledEvalCacheKey> {
+    size_t operator()(Escargot::CompiledEvalCacheKey const& x) const
+    {
+        return x.m_source->hashValue() ^ std::hash<void*>()(x.m_parentCodeBlock);
+    }
+};
+
+template <>
+struct equal_to<Escargot::CompiledEvalCacheKey> {
+    bool operator()(Escargot::CompiledEvalCacheKey const& a, Escargot::CompiledEvalCacheKey const& b) const
+    {
+        return a == b;
+    }
+};
+}
+
+namespace Escargot {
+
+// parsed scripts of eval and Function constructor, so the same source is not parsed again
+// bytecode of top code block is generated on first execution and reused by later executions
+// cache is bounded by COMPILED_EVAL_CACHE_SIZE_MAX entries, and oldest entry is evicted first
+// cache is cleared when bytecode of functions is flushed (see FunctionObject::generateBytecodeBlock)
+class CompiledEvalCache {
+public:
+    static bool canCache(String* source)
+    {
+        return source->length() <= COMPILED_EVAL_CACHE_SOURCE_LENGTH_MAX;
+    }
+
+    CompiledEvalCache()
+        : m_hitCount(0)
+        , m_missCount(0)
+    {
+    }
+
+    Script* find(const CompiledEvalCacheKey& key)
+    {
+        auto iter = m_scripts.find(key);
+        if (iter != m_scripts.end()) {
+            m_hitCount++;
+            return iter->second;
+        }
+        m_missCount++;
+        return nullptr;
+    }
+
+    void insert(const CompiledEvalCacheKey& key, Script* script);
+
+    void clear()
+    {
+        m_scripts.clear();
+        m_insertionOrder.clear();
+    }
+
+    size_t size() const
+    {
+        return m_scripts.size();
+    }
+
+    size_t hitCount() const
+    {
+        return m_hitCount;
+    }
+
+    size_t missCount() const
+    {
+        return m_missCount;
+    }
+
+private:
+    std::unordered_map<CompiledEvalCacheKey, Script*, std::hash<CompiledEvalCacheKey>, std::equal_to<CompiledEvalCacheKey>,
+                       gc_allocator<std::pair<const CompiledEvalCacheKey, Script*>>>
+        m_scripts;
+    std::list<CompiledEvalCacheKey, gc_allocator<CompiledEvalCacheKey>> m_insertionOrder;
+    size_t m_hitCount;
+    size_t m_missCount;
+};
+}
+
+#endif
@@ -21,6 +21,7 @@
 #define __EscargotContext__
 
 #include "runtime/AtomicString.h"
+#include "runtime/CompiledEvalCache.h"
 #include "runtime/Context.h"
 #include "runtime/GlobalObject.h"
 #include "runtime/RegExpObject.h"
@@ -50,6 +51,7 @@ class Context : public gc {
     friend class SandBox;
     friend class ByteCodeInterpreter;
     friend struct OpcodeTable;
+    friend class PromiseReactionJob;
     friend class ContextRef;
 
 public:
@@ -189,6 +191,11 @@ public:
         return m_compiledCodeBlocks;
     }
 
+    CompiledEvalCache& compiledEvalCache()
+    {
+        return m_compiledEvalCache;
+    }
+
     // this is not compatible with ECMAScript
     // but this callback is needed for browser-implementation
     // if there is a Identifier with that value, callback should return non-empty value
@@ -224,6 +231,7 @@ private:
     Vector<CodeBlock*, GCUtil::gc_malloc_ignore_off_page_allocator<CodeBlock*>>& m_compiledCodeBlocks;
     WTF::BumpPointerAllocator* m_bumpPointerAllocator;
     RegExpCacheMap* m_regexpCache;
+    CompiledEvalCache m_compiledEvalCache;
     ObjectStructure* m_defaultStructureForObject;
     ObjectStructure* m_defaultStructureForFunctionObject;
     ObjectStructure* m_defaultStructureForClassFunctionObject;
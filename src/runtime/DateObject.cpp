@@ -308,7 +308,7 @@ time64_t DateObject::applyLocalTimezoneOffset(ExecutionState& state, time64_t t)
 
     t += msBetweenYears;
 #ifdef ENABLE_ICU
-    state.context()->vmInstance()->timezone()->getOffset(t, true, stdOffset, dstOffset, succ);
+    state.context()->vmInstance()->timezoneOffset(t, true, stdOffset, dstOffset, succ);
 #else
     dstOffset = 0;
 #endif
@@ -1139,7 +1139,7 @@ void DateObject::resolveCache(ExecutionState& state)
 #endif
     int32_t stdOffset = 0, dstOffset = 0;
 #ifdef ENABLE_ICU
-    state.context()->vmInstance()->timezone()->getOffset(t, false, stdOffset, dstOffset, succ);
+    state.context()->vmInstance()->timezoneOffset(t, false, stdOffset, dstOffset, succ);
 #endif
 
     m_cachedLocal.isdst = dstOffset == 0 ? 0 : 1;
@@ -1263,10 +1263,7 @@ String* DateObject::toLocaleDateString(ExecutionState& state)
     if (IS_VALID_TIME(m_primitiveValue)) {
 #ifdef ENABLE_ICU
         icu::UnicodeString myString;
-        icu::DateFormat* df = icu::DateFormat::createDateInstance(icu::DateFormat::MEDIUM, state.context()->vmInstance()->locale());
-        df->format(primitiveValue(), myString);
-
-        delete df;
+        state.context()->vmInstance()->localeDateFormat()->format(primitiveValue(), myString);
 
         return new UTF16String(myString);
 #else
@@ -1282,10 +1279,7 @@ String* DateObject::toLocaleTimeString(ExecutionState& state)
     if (IS_VALID_TIME(m_primitiveValue)) {
 #ifdef ENABLE_ICU
         icu::UnicodeString myString;
-        icu::DateFormat* tf = icu::DateFormat::createTimeInstance(icu::DateFormat::MEDIUM, state.context()->vmInstance()->locale());
-        tf->format(primitiveValue(), myString);
-
-        delete tf;
+        state.context()->vmInstance()->localeTimeFormat()->format(primitiveValue(), myString);
 
         return new UTF16String(myString);
 #else
@@ -110,16 +110,21 @@ EnvironmentRecord::BindingSlot GlobalEnvironmentRecord::hasBinding(ExecutionStat
     }
 }
 
-FunctionEnvironmentRecordOnHeap::FunctionEnvironmentRecordOnHeap(FunctionObject* function, size_t argc, Value* argv)
-    : FunctionEnvironmentRecord(function)
-    , m_argc(argc)
-    , m_argv(argv)
-    , m_heapStorage(function->codeBlock()->asInterpretedCodeBlock()->identifierOnHeapCount())
+FunctionEnvironmentRecordOnHeap* FunctionEnvironmentRecordOnHeap::create(FunctionObject* function, size_t argc, Value* argv)
 {
+    size_t heapStorageSize = function->codeBlock()->asInterpretedCodeBlock()->identifierOnHeapCount();
+    void* buffer = GC_MALLOC(sizeof(FunctionEnvironmentRecordOnHeap) + sizeof(SmallValue) * heapStorageSize);
+    FunctionEnvironmentRecordOnHeap* record = new (buffer) FunctionEnvironmentRecordOnHeap(function, argc, argv);
+    SmallValue* storage = record->heapStorage();
+    for (size_t i = 0; i < heapStorageSize; i++) {
+        new (&storage[i]) SmallValue();
+    }
+    return record;
 }
 
 FunctionEnvironmentRecordNotIndexed::FunctionEnvironmentRecordNotIndexed(FunctionObject* function, size_t argc, Value* argv)
     : FunctionEnvironmentRecord(function)
+    , m_hasBindingsChangedByEval(false)
     , m_argc(argc)
     , m_argv(argv)
     , m_heapStorage()
@@ -204,6 +209,24 @@ void FunctionEnvironmentRecordNotIndexed::createBinding(ExecutionState& state, c
         m_recordVector[idx].m_isMutable = isMutable;
     }
 }
+bool FunctionEnvironmentRecordNotIndexed::deleteBinding(ExecutionState& state, const AtomicString& atomicName)
+{
+    size_t len = m_recordVector.size();
+    for (size_t i = 0; i < len; i++) {
+        if (m_recordVector[i].m_name == atomicName) {
+            if (!m_recordVector[i].m_canDelete) {
+                return false;
+            }
+            m_recordVector.erase(i);
+            m_heapStorage.erase(i);
+            // indexes of following bindings are changed
+            m_hasBindingsChangedByEval = true;
+            return true;
+        }
+    }
+    return false;
+}
+
 EnvironmentRecord::GetBindingValueResult FunctionEnvironmentRecordNotIndexed::getBindingValue(ExecutionState& state, const AtomicString& name)
 {
     size_t len = m_recordVector.size();
@@ -157,6 +157,15 @@ public:
         return false;
     }
 
+    // records with the same non-null layout have the same bindings at the same indexes
+    // LoadByName/StoreByName cache layouts of the scope chain instead of records themselves,
+    // so every activation of a function shares one cache
+    // nullptr means bindings of this record are decided at runtime(eval, catch, class scope...)
+    virtual void* bindingLayout()
+    {
+        return nullptr;
+    }
+
     GlobalEnvironmentRecord* asGlobalEnvironmentRecord()
     {
         ASSERT(isGlobalEnvironmentRecord());
@@ -196,6 +205,13 @@ public:
         return true;
     }
 
+    // properties of binding object are looked up by name every time
+    virtual void* bindingLayout()
+    {
+        static char layout;
+        return &layout;
+    }
+
     virtual void createBinding(ExecutionState& state, const AtomicString& name, bool canDelete = false, bool isMutable = true)
     {
         auto desc = m_bindingObject->getOwnProperty(state, name);
@@ -261,6 +277,12 @@ public:
         return true;
     }
 
+    // bindings are properties of global object, and looked up by name
+    virtual void* bindingLayout()
+    {
+        return m_globalObject;
+    }
+
     virtual bool isEvalTarget()
     {
         return true;
@@ -378,6 +400,11 @@ public:
     virtual void setMutableBinding(ExecutionState& state, const AtomicString& name, const Value& V);
     virtual void setMutableBindingByIndex(ExecutionState& state, const size_t idx, const AtomicString& name, const Value& v);
 
+    virtual Value getBindingValue(ExecutionState& state, const size_t idx)
+    {
+        return m_heapStorage[idx];
+    }
+
     virtual bool deleteBinding(ExecutionState& state, const AtomicString& name)
     {
         // Currently 'canDelete' is always false in DeclarativeEnvironmentRecordNotIndexed::createBinding
@@ -454,6 +481,12 @@ public:
         RELEASE_ASSERT_NOT_REACHED();
     }
 
+    // bindings and their indexes come from identifierInfos of code block
+    virtual void* bindingLayout()
+    {
+        return m_functionObject->codeBlock();
+    }
+
     void bindThisValue(ExecutionState& state, Value thisValue)
     {
         ASSERT(m_thisBindingStatus != ThisBindingStatus::Lexical);
@@ -559,7 +592,9 @@ class FunctionEnvironmentRecordOnHeap : public FunctionEnvironmentRecord {
     friend class FunctionObject;
 
 public:
-    FunctionEnvironmentRecordOnHeap(FunctionObject* function, size_t argc, Value* argv);
+    // heap slots are placed right after the record,
+    // so entering a function which has captured variables needs only one allocation for them
+    static FunctionEnvironmentRecordOnHeap* create(FunctionObject* function, size_t argc, Value* argv);
 
     virtual bool isFunctionEnvironmentRecordOnHeap()
     {
@@ -568,12 +603,12 @@ public:
 
     virtual void setHeapValueByIndex(const size_t idx, const Value& v)
     {
-        m_heapStorage[idx] = v;
+        heapStorage()[idx] = v;
     }
 
     virtual Value getHeapValueByIndex(const size_t idx)
     {
-        return m_heapStorage[idx];
+        return heapStorage()[idx];
     }
 
     virtual GetBindingValueResult getBindingValue(ExecutionState& state, const AtomicString& name)
@@ -582,12 +617,17 @@ public:
 
         for (size_t i = 0; i < v.size(); i++) {
             if (v[i].m_name == name) {
-                return GetBindingValueResult(m_heapStorage[v[i].m_indexForIndexedStorage]);
+                return GetBindingValueResult(heapStorage()[v[i].m_indexForIndexedStorage]);
             }
         }
         return GetBindingValueResult();
     }
 
+    virtual Value getBindingValue(ExecutionState& state, const size_t idx)
+    {
+        return heapStorage()[idx];
+    }
+
     virtual BindingSlot hasBinding(ExecutionState& state, const AtomicString& name)
     {
         const auto& v = m_functionObject->codeBlock()->asInterpretedCodeBlock()->identifierInfos();
@@ -602,7 +642,7 @@ public:
 
     virtual void setMutableBindingByIndex(ExecutionState& state, const size_t idx, const AtomicString& name, const Value& v)
     {
-        m_heapStorage[idx] = v;
+        heapStorage()[idx] = v;
     }
 
     virtual void setMutableBinding(ExecutionState& state, const AtomicString& name, const Value& V)
@@ -611,7 +651,7 @@ public:
 
         for (size_t i = 0; i < v.size(); i++) {
             if (v[i].m_name == name) {
-                m_heapStorage[v[i].m_indexForIndexedStorage] = V;
+                heapStorage()[v[i].m_indexForIndexedStorage] = V;
                 return;
             }
         }
@@ -628,10 +668,21 @@ public:
         return m_argv;
     }
 
+    ALWAYS_INLINE SmallValue* heapStorage()
+    {
+        return reinterpret_cast<SmallValue*>(reinterpret_cast<char*>(this) + sizeof(FunctionEnvironmentRecordOnHeap));
+    }
+
 private:
+    FunctionEnvironmentRecordOnHeap(FunctionObject* function, size_t argc, Value* argv)
+        : FunctionEnvironmentRecord(function)
+        , m_argc(argc)
+        , m_argv(argv)
+    {
+    }
+
     size_t m_argc;
     Value* m_argv;
-    SmallValueTightVector m_heapStorage;
 };
 
 class FunctionEnvironmentRecordNotIndexed : public FunctionEnvironmentRecord {
@@ -645,6 +696,18 @@ public:
         return true;
     }
 
+    // bindings made by eval or removed by delete are not decided by code block
+    virtual void* bindingLayout()
+    {
+        return m_hasBindingsChangedByEval ? nullptr : m_functionObject->codeBlock();
+    }
+
+    // eval adds var declarations into this record
+    void didAddBindingsByEval()
+    {
+        m_hasBindingsChangedByEval = true;
+    }
+
     virtual void setHeapValueByIndex(const size_t idx, const Value& v)
     {
         m_heapStorage[idx] = v;
@@ -660,21 +723,7 @@ public:
         return true;
     }
 
-    virtual bool deleteBinding(ExecutionState& state, const AtomicString& atomicName)
-    {
-        size_t len = m_recordVector.size();
-        for (size_t i = 0; i < len; i++) {
-            if (m_recordVector[i].m_name == atomicName) {
-                if (!m_recordVector[i].m_canDelete) {
-                    return false;
-                }
-                m_recordVector.erase(i);
-                m_heapStorage.erase(i);
-                return true;
-            }
-        }
-        return false;
-    }
+    virtual bool deleteBinding(ExecutionState& state, const AtomicString& atomicName);
 
     virtual BindingSlot hasBinding(ExecutionState& state, const AtomicString& atomicName)
     {
@@ -693,6 +742,11 @@ public:
     virtual void setMutableBinding(ExecutionState& state, const AtomicString& name, const Value& V);
     virtual void setMutableBindingByIndex(ExecutionState& state, const size_t idx, const AtomicString& name, const Value& v);
 
+    virtual Value getBindingValue(ExecutionState& state, const size_t idx)
+    {
+        return m_heapStorage[idx];
+    }
+
     virtual size_t argc()
     {
         return m_argc;
@@ -706,6 +760,7 @@ public:
     virtual void initializeBinding(ExecutionState& state, const AtomicString& name, const Value& V);
 
 private:
+    bool m_hasBindingsChangedByEval;
     size_t m_argc;
     Value* m_argv;
     SmallValueTightVector m_heapStorage;
@@ -719,6 +774,12 @@ public:
     {
     }
 
+    // virtual identifier callback is called before looking up bindings of this record
+    virtual void* bindingLayout()
+    {
+        return nullptr;
+    }
+
     virtual GetBindingValueResult getBindingValue(ExecutionState& state, const AtomicString& name);
 };
 }
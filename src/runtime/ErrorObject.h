@@ -25,6 +25,7 @@
 namespace Escargot {
 
 class ByteCodeBlock;
+class CodeBlock;
 class SandBox;
 
 extern const char* errorMessage_NotImplemented; // FIXME to be removed
@@ -128,22 +129,21 @@ public:
         return "Error";
     }
 
-    struct StackTraceGCData {
-        union {
-            ByteCodeBlock* byteCodeBlock;
-            String* infoString;
-        };
-    };
-    struct StackTraceNonGCData {
+    // raw frame of stack trace. source location is computed when stack is read
+    struct StackTraceFrame {
+        CodeBlock* codeBlock;
+        // nullptr for native function, or when position is unknown
+        ByteCodeBlock* byteCodeBlock;
         size_t byteCodePosition;
     };
     struct StackTraceData : public gc {
-        TightVector<StackTraceGCData, GCUtil::gc_malloc_ignore_off_page_allocator<StackTraceGCData>> gcValues;
-        TightVector<StackTraceNonGCData, GCUtil::gc_malloc_atomic_ignore_off_page_allocator<StackTraceNonGCData>> nonGCValues;
+        TightVector<StackTraceFrame, GCUtil::gc_malloc_ignore_off_page_allocator<StackTraceFrame>> frames;
         Value exception;
 
         void buildStackTrace(Context* context, StringBuilder& builder);
         static StackTraceData* create(SandBox* sandBox);
+        // description of frame without source position
+        static String* frameInfoString(CodeBlock* cb);
 
     private:
         StackTraceData() {}
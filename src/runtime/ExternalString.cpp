@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2019-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#include "Escargot.h"
+#include "ExternalString.h"
+
+namespace Escargot {
+
+ExternalString::ExternalString(const void* buffer, ExternalStringReleaseCallback releaseCallback, void* callbackData)
+    : String()
+    , m_externalBuffer(buffer)
+    , m_releaseCallback(releaseCallback)
+    , m_releaseCallbackData(callbackData)
+{
+    if (m_releaseCallback) {
+        GC_REGISTER_FINALIZER_NO_ORDER(this, [](void* obj,
+                                                void*) {
+            ExternalString* self = (ExternalString*)obj;
+            self->m_releaseCallback(const_cast<void*>(self->m_externalBuffer), self->m_releaseCallbackData);
+        },
+                                       nullptr, nullptr, nullptr);
+    }
+}
+
+UTF16StringData ExternalString::toUTF16StringData() const
+{
+    const auto& data = bufferAccessData();
+    if (data.has8BitContent) {
+        UTF16StringData ret;
+        ret.resizeWithUninitializedValues(data.length);
+        for (size_t i = 0; i < data.length; i++) {
+            ret[i] = ((const LChar*)data.buffer)[i];
+        }
+        return ret;
+    }
+    return UTF16StringData((const char16_t*)data.buffer, data.length);
+}
+
+UTF8StringData ExternalString::toUTF8StringData() const
+{
+    return bufferAccessData().toUTF8String<UTF8StringData, UTF8StringDataNonGCStd>();
+}
+
+UTF8StringDataNonGCStd ExternalString::toNonGCUTF8StringData() const
+{
+    return bufferAccessData().toUTF8String<UTF8StringDataNonGCStd>();
+}
+
+void* ExternalLatin1String::operator new(size_t size)
+{
+    static bool typeInited = false;
+    static GC_descr descr;
+    if (!typeInited) {
+        GC_word obj_bitmap[GC_BITMAP_SIZE(ExternalLatin1String)] = { 0 };
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ExternalLatin1String, m_tag));
+        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ExternalLatin1String));
+        typeInited = true;
+    }
+    return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
+}
+
+void* ExternalUTF16String::operator new(size_t size)
+{
+    static bool typeInited = false;
+    static GC_descr descr;
+    if (!typeInited) {
+        GC_word obj_bitmap[GC_BITMAP_SIZE(ExternalUTF16String)] = { 0 };
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ExternalUTF16String, m_tag));
+        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ExternalUTF16String));
+        typeInited = true;
+    }
+    return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
+}
+
+ExternalUTF8String::ExternalUTF8String(const char* buffer, size_t len, ExternalStringReleaseCallback releaseCallback, void* callbackData)
+    : ExternalString(buffer, releaseCallback, callbackData)
+    , m_externalLength(len)
+{
+    if (isAllASCII(buffer, len)) {
+        m_bufferAccessData.has8BitContent = true;
+        m_bufferAccessData.length = len;
+        m_bufferAccessData.buffer = buffer;
+    } else {
+        m_bufferAccessData.has8BitContent = false;
+        m_bufferAccessData.length = 0;
+        m_bufferAccessData.buffer = nullptr;
+        m_bufferAccessData.hasSpecialImpl = true;
+    }
+}
+
+void ExternalUTF8String::bufferAccessDataSpecialImpl()
+{
+    ASSERT(m_bufferAccessData.hasSpecialImpl);
+    UTF16StringData data = utf8StringToUTF16String((const char*)m_externalBuffer, m_externalLength);
+    m_bufferAccessData.length = data.length();
+    m_bufferAccessData.buffer = data.takeBuffer();
+    m_bufferAccessData.hasSpecialImpl = false;
+}
+
+void* ExternalUTF8String::operator new(size_t size)
+{
+    static bool typeInited = false;
+    static GC_descr descr;
+    if (!typeInited) {
+        GC_word obj_bitmap[GC_BITMAP_SIZE(ExternalUTF8String)] = { 0 };
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ExternalUTF8String, m_tag));
+        // transcoded UTF-16 buffer is allocated from GC heap
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ExternalUTF8String, m_bufferAccessData.buffer));
+        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ExternalUTF8String));
+        typeInited = true;
+    }
+    return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
+}
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2019-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#ifndef __EscargotExternalString__
+#define __EscargotExternalString__
+
+#include "runtime/String.h"
+
+namespace Escargot {
+
+// called with the host buffer when the string is collected
+typedef void (*ExternalStringReleaseCallback)(void* buffer, void* callbackData);
+
+// string which wraps host owned memory without copying
+// host buffer should not be changed until release callback is called
+class ExternalString : public String {
+public:
+    virtual size_t length() const
+    {
+        return bufferAccessData().length;
+    }
+
+    virtual UTF16StringData toUTF16StringData() const;
+    virtual UTF8StringData toUTF8StringData() const;
+    virtual UTF8StringDataNonGCStd toNonGCUTF8StringData() const;
+
+    const void* externalBuffer() const
+    {
+        return m_externalBuffer;
+    }
+
+protected:
+    ExternalString(const void* buffer, ExternalStringReleaseCallback releaseCallback, void* callbackData);
+
+    const void* m_externalBuffer;
+    ExternalStringReleaseCallback m_releaseCallback;
+    void* m_releaseCallbackData;
+};
+
+class ExternalLatin1String : public ExternalString {
+public:
+    ExternalLatin1String(const LChar* buffer, size_t len, ExternalStringReleaseCallback releaseCallback, void* callbackData)
+        : ExternalString(buffer, releaseCallback, callbackData)
+    {
+        m_bufferAccessData.has8BitContent = true;
+        m_bufferAccessData.length = len;
+        m_bufferAccessData.buffer = buffer;
+    }
+
+    virtual char16_t charAt(const size_t idx) const
+    {
+        return m_bufferAccessData.uncheckedCharAtFor8Bit(idx);
+    }
+
+    virtual const LChar* characters8() const
+    {
+        return (const LChar*)m_bufferAccessData.buffer;
+    }
+
+    void* operator new(size_t size);
+    void* operator new[](size_t size) = delete;
+};
+
+class ExternalUTF16String : public ExternalString {
+public:
+    ExternalUTF16String(const char16_t* buffer, size_t len, ExternalStringReleaseCallback releaseCallback, void* callbackData)
+        : ExternalString(buffer, releaseCallback, callbackData)
+    {
+        m_bufferAccessData.has8BitContent = false;
+        m_bufferAccessData.length = len;
+        m_bufferAccessData.buffer = buffer;
+    }
+
+    virtual char16_t charAt(const size_t idx) const
+    {
+        return m_bufferAccessData.uncheckedCharAtFor16Bit(idx);
+    }
+
+    virtual const char16_t* characters16() const
+    {
+        return (const char16_t*)m_bufferAccessData.buffer;
+    }
+
+    void* operator new(size_t size);
+    void* operator new[](size_t size) = delete;
+};
+
+// ASCII content is used as 8-bit buffer directly
+// other content is transcoded into UTF-16 at the first access of buffer
+class ExternalUTF8String : public ExternalString {
+public:
+    ExternalUTF8String(const char* buffer, size_t len, ExternalStringReleaseCallback releaseCallback, void* callbackData);
+
+    virtual char16_t charAt(const size_t idx) const
+    {
+        return bufferAccessData().charAt(idx);
+    }
+
+    virtual const LChar* characters8() const
+    {
+        ASSERT(has8BitContent());
+        return (const LChar*)bufferAccessData().buffer;
+    }
+
+    virtual const char16_t* characters16() const
+    {
+        ASSERT(!has8BitContent());
+        return (const char16_t*)bufferAccessData().buffer;
+    }
+
+    void* operator new(size_t size);
+    void* operator new[](size_t size) = delete;
+
+protected:
+    virtual void bufferAccessDataSpecialImpl();
+
+    size_t m_externalLength;
+};
+}
+
+#endif
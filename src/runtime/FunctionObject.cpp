@@ -242,6 +242,8 @@ NEVER_INLINE void FunctionObject::generateBytecodeBlock(ExecutionState& state)
 
         v.clear();
         v.resizeWithUninitializedValues(codeBlocksInCurrentStack.size());
+        // scripts executing now keep their bytecode, because they are referenced from stack
+        state.context()->compiledEvalCache().clear();
 
         for (size_t i = 0; i < codeBlocksInCurrentStack.size(); i++) {
             v[i] = codeBlocksInCurrentStack[i];
@@ -263,7 +265,7 @@ NEVER_INLINE void FunctionObject::generateBytecodeBlock(ExecutionState& state)
     RefPtr<Node> ast = std::get<0>(ret);
 
     ByteCodeGenerator g;
-    m_codeBlock->m_byteCodeBlock = g.generateByteCode(state.context(), m_codeBlock->asInterpretedCodeBlock(), ast.get(), std::get<1>(ret), false, false, false);
+    m_codeBlock->m_byteCodeBlock = g.generateByteCode(state.context(), m_codeBlock->asInterpretedCodeBlock(), ast.get(), std::get<1>(ret), false, false);
 
     v.pushBack(m_codeBlock);
 
@@ -348,6 +350,10 @@ Value FunctionObject::processCall(ExecutionState& state, const Value& receiverSr
     }
 
     if (!m_codeBlock->isInterpretedCodeBlock()) {
+        if (m_codeBlock->hasFastNativeFunctionCode() && !isNewExpression) {
+            return callFastNativeFunction(state, receiverSrc, argc, argv);
+        }
+
         CallNativeFunctionData* code = m_codeBlock->nativeFunctionData();
         FunctionEnvironmentRecordSimple record(this);
         LexicalEnvironment env(&record, outerEnvironment());
@@ -382,9 +388,19 @@ Value FunctionObject::processCall(ExecutionState& state, const Value& receiverSr
 
         ExecutionState newState(ctx, &state, &ec, &receiver);
 
+        // pending sample request is latched at native call boundaries
+        // so time spent in native function is charged to native function, not to the next sampling point of caller
+        if (UNLIKELY(SamplingProfiler::isSampleRequested())) {
+            SamplingProfiler::takeSample(state, nullptr, 0);
+        }
+
         try {
             Value returnValue = code->m_fn(newState, receiver, argc, argv, isNewExpression);
 
+            if (UNLIKELY(SamplingProfiler::isSampleRequested())) {
+                SamplingProfiler::takeSample(newState, nullptr, 0);
+            }
+
             if (UNLIKELY(isSuperCall)) {
                 state.executionContext()->getThisEnvironment()->asDeclarativeEnvironmentRecord()->asFunctionEnvironmentRecord()->bindThisValue(state, returnValue);
                 state.executionContext()->setOnGoingSuperCall(false);
@@ -422,7 +438,7 @@ Value FunctionObject::processCall(ExecutionState& state, const Value& receiverSr
         ec = new (alloca(sizeof(ExecutionContext))) ExecutionContext(ctx, state.executionContext(), new (alloca(sizeof(LexicalEnvironment))) LexicalEnvironment(record, outerEnvironment()), isStrict);
     } else {
         if (LIKELY(m_codeBlock->canUseIndexedVariableStorage())) {
-            record = new FunctionEnvironmentRecordOnHeap(this, argc, argv);
+            record = FunctionEnvironmentRecordOnHeap::create(this, argc, argv);
         } else {
             if (LIKELY(!m_codeBlock->needsVirtualIDOperation())) {
                 record = new FunctionEnvironmentRecordNotIndexed(this, argc, argv);
@@ -430,7 +446,8 @@ Value FunctionObject::processCall(ExecutionState& state, const Value& receiverSr
                 record = new FunctionEnvironmentRecordNotIndexedWithVirtualID(this, argc, argv);
             }
         }
-        ec = new ExecutionContext(ctx, state.executionContext(), new LexicalEnvironment(record, outerEnvironment()), isStrict);
+        // only the record and environment can be captured by closures. nothing keeps ExecutionContext after return
+        ec = new (alloca(sizeof(ExecutionContext))) ExecutionContext(ctx, state.executionContext(), new LexicalEnvironment(record, outerEnvironment()), isStrict);
     }
 
     if (receiverSrc.isObject()) {
@@ -471,7 +488,7 @@ Value FunctionObject::processCall(ExecutionState& state, const Value& receiverSr
     if (UNLIKELY(m_codeBlock->m_isFunctionNameSaveOnHeap)) {
         if (m_codeBlock->canUseIndexedVariableStorage()) {
             ASSERT(record->isFunctionEnvironmentRecordOnHeap());
-            ((FunctionEnvironmentRecordOnHeap*)record)->m_heapStorage[0] = this;
+            ((FunctionEnvironmentRecordOnHeap*)record)->heapStorage()[0] = this;
         } else {
             record->initializeBinding(state, m_codeBlock->functionName(), this);
         }
@@ -481,7 +498,7 @@ Value FunctionObject::processCall(ExecutionState& state, const Value& receiverSr
         if (m_codeBlock->canUseIndexedVariableStorage()) {
             if (UNLIKELY(m_codeBlock->m_isFunctionNameSaveOnHeap)) {
                 ASSERT(record->isFunctionEnvironmentRecordOnHeap());
-                ((FunctionEnvironmentRecordOnHeap*)record)->m_heapStorage[0] = Value();
+                ((FunctionEnvironmentRecordOnHeap*)record)->heapStorage()[0] = Value();
             } else {
                 stackStorage[1] = Value();
             }
@@ -528,7 +545,7 @@ Value FunctionObject::processCall(ExecutionState& state, const Value& receiverSr
                     val = Value();
                 if (info[i].m_isHeapAllocated) {
                     ASSERT(record->isFunctionEnvironmentRecordOnHeap());
-                    ((FunctionEnvironmentRecordOnHeap*)record)->m_heapStorage[info[i].m_index] = val;
+                    ((FunctionEnvironmentRecordOnHeap*)record)->heapStorage()[info[i].m_index] = val;
                 } else {
                     parameterStorageInStack[info[i].m_index] = val;
                 }
@@ -545,7 +562,7 @@ Value FunctionObject::processCall(ExecutionState& state, const Value& receiverSr
                 InterpretedCodeBlock::FunctionParametersInfo lastInfo = const_cast<InterpretedCodeBlock::FunctionParametersInfoVector&>(info).back();
                 if (lastInfo.m_isHeapAllocated) {
                     ASSERT(record->isFunctionEnvironmentRecordOnHeap());
-                    ((FunctionEnvironmentRecordOnHeap*)record)->m_heapStorage[lastInfo.m_index] = newArray;
+                    ((FunctionEnvironmentRecordOnHeap*)record)->heapStorage()[lastInfo.m_index] = newArray;
                 } else {
                     parameterStorageInStack[lastInfo.m_index] = newArray;
                 }
@@ -620,7 +637,7 @@ void FunctionObject::generateArgumentsObject(ExecutionState& state, FunctionEnvi
                     stackStorage[v[i].m_indexForIndexedStorage] = fnRecord->createArgumentsObject(state, state.executionContext());
                 } else {
                     ASSERT(fnRecord->isFunctionEnvironmentRecordOnHeap());
-                    ((FunctionEnvironmentRecordOnHeap*)fnRecord)->m_heapStorage[v[i].m_indexForIndexedStorage] = fnRecord->createArgumentsObject(state, state.executionContext());
+                    ((FunctionEnvironmentRecordOnHeap*)fnRecord)->heapStorage()[v[i].m_indexForIndexedStorage] = fnRecord->createArgumentsObject(state, state.executionContext());
                 }
                 break;
             }
@@ -179,7 +179,11 @@ public:
     ALWAYS_INLINE static Value call(ExecutionState& state, const Value& callee, const Value& receiver, const size_t argc, Value* argv, bool isNewExpression = false)
     {
         if (LIKELY(callee.isObject() && callee.asPointerValue()->hasTag(g_functionObjectTag))) {
-            return callee.asFunction()->processCall(state, receiver, argc, argv, isNewExpression);
+            FunctionObject* fn = callee.asFunction();
+            if (fn->m_codeBlock->hasFastNativeFunctionCode() && !isNewExpression) {
+                return fn->callFastNativeFunction(state, receiver, argc, argv);
+            }
+            return fn->processCall(state, receiver, argc, argv, isNewExpression);
         } else {
             return callSlowCase(state, callee, receiver, argc, argv, isNewExpression);
         }
@@ -217,6 +221,13 @@ private:
         return true;
     }
 
+    // receiver is passed as is. fast native functions are always strict and not constructor
+    ALWAYS_INLINE Value callFastNativeFunction(ExecutionState& state, const Value& receiver, const size_t argc, Value* argv)
+    {
+        ASSERT(m_codeBlock->hasFastNativeFunctionCode());
+        return ((CallFastNativeFunctionData*)m_codeBlock->nativeFunctionData())->m_fastFn(state, this, receiver, argc, argv);
+    }
+
     Value processCall(ExecutionState& state, const Value& receiver, const size_t argc, Value* argv, bool isNewExpression);
     static Value callSlowCase(ExecutionState& state, const Value& callee, const Value& receiver, const size_t argc, Value* argv, bool isNewExpression);
     void generateArgumentsObject(ExecutionState& state, FunctionEnvironmentRecord* fnRecord, Value* stackStorage);
@@ -195,6 +195,32 @@ ObjectGetResult GlobalObject::getOwnProperty(ExecutionState& state, const Object
     return r;
 }
 
+Script* GlobalObject::parseEvalCode(ExecutionState& state, String* source, InterpretedCodeBlock* parentCodeBlock, bool strictFromOutside, bool isEvalCodeInFunction, size_t stackRemainApprox)
+{
+    CompiledEvalCache& cache = state.context()->compiledEvalCache();
+    bool canCache = CompiledEvalCache::canCache(source);
+    CompiledEvalCacheKey key(source, parentCodeBlock, strictFromOutside, isEvalCodeInFunction, false);
+    if (canCache) {
+        Script* script = cache.find(key);
+        if (script) {
+            return script;
+        }
+    }
+
+    ScriptParser parser(state.context());
+    const char* s = "eval input";
+    ScriptParser::ScriptParserResult parserResult = parser.parse(StringView(source, 0, source->length()), String::fromUTF8(s, strlen(s)), parentCodeBlock, strictFromOutside, isEvalCodeInFunction, stackRemainApprox);
+    if (parserResult.m_error) {
+        ErrorObject* err = ErrorObject::createError(state, parserResult.m_error->errorCode, parserResult.m_error->message);
+        state.throwException(err);
+    }
+
+    if (canCache) {
+        cache.insert(key, parserResult.m_script);
+    }
+    return parserResult.m_script;
+}
+
 Value GlobalObject::eval(ExecutionState& state, const Value& arg)
 {
     if (arg.isString()) {
@@ -207,9 +233,6 @@ Value GlobalObject::eval(ExecutionState& state, const Value& arg)
                 return Value();
             }
         }
-        ScriptParser parser(state.context());
-        const char* s = "eval input";
-        ExecutionContext* pec = state.executionContext();
         bool strictFromOutside = false;
 
         volatile int sp;
@@ -219,15 +242,11 @@ Value GlobalObject::eval(ExecutionState& state, const Value& arg)
 #else
         size_t stackRemainApprox = STACK_LIMIT_FROM_BASE - (currentStackBase - state.stackBase());
 #endif
-        ScriptParser::ScriptParserResult parserResult = parser.parse(StringView(arg.asString(), 0, arg.asString()->length()), String::fromUTF8(s, strlen(s)), nullptr, strictFromOutside, false, stackRemainApprox);
-        if (parserResult.m_error) {
-            ErrorObject* err = ErrorObject::createError(state, parserResult.m_error->errorCode, parserResult.m_error->message);
-            state.throwException(err);
-        }
-        bool needNewEnv = parserResult.m_script->topCodeBlock()->isStrict();
+        Script* script = parseEvalCode(state, arg.asString(), nullptr, strictFromOutside, false, stackRemainApprox);
+        bool needNewEnv = script->topCodeBlock()->isStrict();
         // In case of indirect call, use global execution context
         ExecutionState stateForNewGlobal(m_context);
-        return parserResult.m_script->execute(stateForNewGlobal, true, needNewEnv, true);
+        return script->execute(stateForNewGlobal, true, needNewEnv, true);
     }
     return arg;
 }
@@ -244,8 +263,6 @@ Value GlobalObject::evalLocal(ExecutionState& state, const Value& arg, Value thi
                 return Value();
             }
         }
-        ScriptParser parser(state.context());
-        const char* s = "eval input";
         ExecutionContext* pec = state.executionContext();
         bool isDirectCall = true;
         bool isEvalCodeInFunction = false;
@@ -280,13 +297,9 @@ Value GlobalObject::evalLocal(ExecutionState& state, const Value& arg, Value thi
 #else
         size_t stackRemainApprox = STACK_LIMIT_FROM_BASE - (currentStackBase - state.stackBase());
 #endif
-        ScriptParser::ScriptParserResult parserResult = parser.parse(StringView(arg.asString(), 0, arg.asString()->length()), String::fromUTF8(s, strlen(s)), parentCodeBlock, strictFromOutside, isEvalCodeInFunction, stackRemainApprox);
-        if (parserResult.m_error) {
-            ErrorObject* err = ErrorObject::createError(state, parserResult.m_error->errorCode, parserResult.m_error->message);
-            state.throwException(err);
-        }
-        bool needNewEnv = parserResult.m_script->topCodeBlock()->isStrict();
-        return parserResult.m_script->executeLocal(state, thisValue, parentCodeBlock, true, needNewEnv);
+        Script* script = parseEvalCode(state, arg.asString(), parentCodeBlock, strictFromOutside, isEvalCodeInFunction, stackRemainApprox);
+        bool needNewEnv = script->topCodeBlock()->isStrict();
+        return script->executeLocal(state, thisValue, parentCodeBlock, true, needNewEnv);
     }
     return arg;
 }
@@ -27,6 +27,7 @@
 namespace Escargot {
 
 class FunctionObject;
+class Script;
 
 #define RESOLVE_THIS_BINDING_TO_OBJECT(NAME, OBJ, BUILT_IN_METHOD)                                                                                                                                                                    \
     if (thisValue.isUndefinedOrNull()) {                                                                                                                                                                                              \
@@ -42,6 +43,15 @@ class FunctionObject;
 
 Value builtinSpeciesGetter(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression);
 
+#if defined(ENABLE_ICU) && defined(ENABLE_INTL)
+// returns an object initialized as if by new Intl.Collator(locales, options)
+// collator of the object is valid while the object is alive
+Object* createIntlCollator(ExecutionState& state, Value locales, Value options);
+UCollator* intlCollatorOf(Object* collator);
+// returns collator of fn when fn is the compare function of an Intl.Collator, otherwise nullptr
+UCollator* intlCollatorOfCompareFunction(FunctionObject* fn);
+#endif
+
 class GlobalObject : public Object {
 public:
     friend class ByteCodeInterpreter;
@@ -74,6 +84,7 @@ public:
         , m_string(nullptr)
         , m_stringPrototype(nullptr)
         , m_stringIteratorPrototype(nullptr)
+        , m_stringIteratorPrototypeNext(nullptr)
         , m_number(nullptr)
         , m_numberPrototype(nullptr)
         , m_symbol(nullptr)
@@ -81,6 +92,8 @@ public:
         , m_array(nullptr)
         , m_arrayPrototype(nullptr)
         , m_arrayIteratorPrototype(nullptr)
+        , m_arrayPrototypeValues(nullptr)
+        , m_arrayIteratorPrototypeNext(nullptr)
         , m_boolean(nullptr)
         , m_booleanPrototype(nullptr)
         , m_date(nullptr)
@@ -91,6 +104,7 @@ public:
         , m_eval(nullptr)
         , m_throwTypeError(nullptr)
         , m_throwerGetterSetterData(nullptr)
+        , m_errorStackGetterSetterData(nullptr)
         , m_stringProxyObject(nullptr)
         , m_numberProxyObject(nullptr)
         , m_json(nullptr)
@@ -139,9 +153,11 @@ public:
         , m_map(nullptr)
         , m_mapPrototype(nullptr)
         , m_mapIteratorPrototype(nullptr)
+        , m_mapIteratorPrototypeNext(nullptr)
         , m_set(nullptr)
         , m_setPrototype(nullptr)
         , m_setIteratorPrototype(nullptr)
+        , m_setIteratorPrototypeNext(nullptr)
         , m_weakMap(nullptr)
         , m_weakMapPrototype(nullptr)
         , m_weakSet(nullptr)
@@ -333,6 +349,10 @@ public:
     {
         return m_stringIteratorPrototype;
     }
+    FunctionObject* stringIteratorPrototypeNext()
+    {
+        return m_stringIteratorPrototypeNext;
+    }
 
     FunctionObject* number()
     {
@@ -360,10 +380,18 @@ public:
     {
         return m_arrayPrototype;
     }
+    FunctionObject* arrayPrototypeValues()
+    {
+        return m_arrayPrototypeValues;
+    }
     Object* arrayIteratorPrototype()
     {
         return m_arrayIteratorPrototype;
     }
+    FunctionObject* arrayIteratorPrototypeNext()
+    {
+        return m_arrayIteratorPrototypeNext;
+    }
 
     FunctionObject* boolean()
     {
@@ -568,6 +596,10 @@ public:
     {
         return m_mapIteratorPrototype;
     }
+    FunctionObject* mapIteratorPrototypeNext()
+    {
+        return m_mapIteratorPrototypeNext;
+    }
 
     FunctionObject* set()
     {
@@ -583,6 +615,10 @@ public:
     {
         return m_setIteratorPrototype;
     }
+    FunctionObject* setIteratorPrototypeNext()
+    {
+        return m_setIteratorPrototypeNext;
+    }
 
     FunctionObject* weakMap()
     {
@@ -623,6 +659,13 @@ public:
         return m_throwerGetterSetterData;
     }
 
+    // getter of stack property, which is defined on thrown error objects
+    JSGetterSetter* errorStackGetterSetterData()
+    {
+        ASSERT(m_errorStackGetterSetterData);
+        return m_errorStackGetterSetterData;
+    }
+
     StringObject* stringProxyObject()
     {
         return m_stringProxyObject;
@@ -647,6 +690,9 @@ public:
     void* operator new[](size_t size) = delete;
 
 private:
+    // returns parsed script from CompiledEvalCache of context or parses source
+    Script* parseEvalCode(ExecutionState& state, String* source, InterpretedCodeBlock* parentCodeBlock, bool strictFromOutside, bool isEvalCodeInFunction, size_t stackRemainApprox);
+
     Context* m_context;
 
     FunctionObject* m_object;
@@ -677,6 +723,7 @@ private:
     FunctionObject* m_string;
     Object* m_stringPrototype;
     Object* m_stringIteratorPrototype;
+    FunctionObject* m_stringIteratorPrototypeNext;
 
     FunctionObject* m_number;
     Object* m_numberPrototype;
@@ -686,7 +733,9 @@ private:
 
     FunctionObject* m_array;
     Object* m_arrayPrototype;
+    FunctionObject* m_arrayPrototypeValues;
     Object* m_arrayIteratorPrototype;
+    FunctionObject* m_arrayIteratorPrototypeNext;
 
     FunctionObject* m_boolean;
     Object* m_booleanPrototype;
@@ -703,6 +752,7 @@ private:
 
     FunctionObject* m_throwTypeError;
     JSGetterSetter* m_throwerGetterSetterData;
+    JSGetterSetter* m_errorStackGetterSetterData;
 
     StringObject* m_stringProxyObject;
     NumberObject* m_numberProxyObject;
@@ -758,9 +808,11 @@ private:
     FunctionObject* m_map;
     Object* m_mapPrototype;
     Object* m_mapIteratorPrototype;
+    FunctionObject* m_mapIteratorPrototypeNext;
     FunctionObject* m_set;
     Object* m_setPrototype;
     Object* m_setIteratorPrototype;
+    FunctionObject* m_setIteratorPrototypeNext;
     FunctionObject* m_weakMap;
     Object* m_weakMapPrototype;
     FunctionObject* m_weakSet;
@@ -143,16 +143,15 @@ static Value builtinArrayFrom(ExecutionState& state, Value thisValue, size_t arg
             // Let Pk be ! ToString(k).
             ObjectPropertyName pk(state, Value(k));
             // Let next be ? IteratorStep(iterator).
-            Value next = iteratorStep(state, iterator);
+            // Let nextValue be ? IteratorValue(next).
+            Value nextValue;
             // If next is false, then
-            if (next.isFalse()) {
+            if (!iteratorStepValue(state, iterator, nextValue)) {
                 // Perform ? Set(A, "length", k, true).
                 A->setThrowsException(state, ObjectPropertyName(state, state.context()->staticStrings().length), Value(k), A);
                 // Return A.
                 return A;
             }
-            // Let nextValue be ? IteratorValue(next).
-            Value nextValue = iteratorValue(state, next);
             Value mappedValue;
             // If mapping is true, then
             if (mapping) {
@@ -356,6 +355,53 @@ static Value builtinArrayReverse(ExecutionState& state, Value thisValue, size_t
     return O;
 }
 
+#if defined(ENABLE_ICU) && defined(ENABLE_INTL)
+// sort keys of strings compared with the compare function of an Intl.Collator
+// sorted values keep the strings alive while sorting, so addresses of strings are used as keys
+class IntlCollatorSortKeyCache {
+public:
+    explicit IntlCollatorSortKeyCache(UCollator* collator)
+        : m_collator(collator)
+    {
+    }
+
+    bool isEnabled() const
+    {
+        return m_collator;
+    }
+
+    // same result as ucol_strcoll
+    int compare(String* a, String* b)
+    {
+        return strcmp(sortKey(a), sortKey(b));
+    }
+
+private:
+    const char* sortKey(String* str)
+    {
+        auto iter = m_sortKeys.find(str);
+        if (iter != m_sortKeys.end()) {
+            return iter->second.data();
+        }
+
+        auto utf16 = str->toUTF16StringData();
+        uint8_t buffer[256];
+        int32_t length = ucol_getSortKey(m_collator, (const UChar*)utf16.data(), utf16.length(), buffer, sizeof(buffer));
+        std::string key;
+        if ((size_t)length <= sizeof(buffer)) {
+            key.assign((const char*)buffer, length);
+        } else {
+            key.resize(length);
+            ucol_getSortKey(m_collator, (const UChar*)utf16.data(), utf16.length(), (uint8_t*)&key[0], length);
+        }
+        return m_sortKeys.insert(std::make_pair(str, std::move(key))).first->second.data();
+    }
+
+    UCollator* m_collator;
+    std::unordered_map<String*, std::string> m_sortKeys;
+};
+#endif
+
 static Value builtinArraySort(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
 {
     RESOLVE_THIS_BINDING_TO_OBJECT(thisObject, Array, sort);
@@ -365,7 +411,12 @@ static Value builtinArraySort(ExecutionState& state, Value thisValue, size_t arg
     }
     bool defaultSort = (argc == 0) || cmpfn.isUndefined();
 
-    thisObject->sort(state, [defaultSort, &cmpfn, &state](const Value& a, const Value& b) -> bool {
+#if defined(ENABLE_ICU) && defined(ENABLE_INTL)
+    // sort keys are computed once per string instead of once per comparison
+    IntlCollatorSortKeyCache sortKeys(defaultSort ? nullptr : intlCollatorOfCompareFunction(cmpfn.asFunction()));
+#endif
+
+    thisObject->sort(state, [&](const Value& a, const Value& b) -> bool {
         if (a.isEmpty() && b.isUndefined())
             return false;
         if (a.isUndefined() && b.isEmpty())
@@ -380,6 +431,11 @@ static Value builtinArraySort(ExecutionState& state, Value thisValue, size_t arg
             String* valb = b.toString(state);
             return *vala < *valb;
         } else {
+#if defined(ENABLE_ICU) && defined(ENABLE_INTL)
+            if (sortKeys.isEnabled() && a.isString() && b.isString()) {
+                return sortKeys.compare(a.asString(), b.asString()) < 0;
+            }
+#endif
             Value ret = FunctionObject::call(state, cmpfn, Value(), 2, arg);
             return (ret.toNumber(state) < 0);
         } });
@@ -1815,12 +1871,12 @@ void GlobalObject::installArray(ExecutionState& state)
     m_arrayPrototype->defineOwnPropertyThrowsException(state, ObjectPropertyName(state.context()->staticStrings().copyWithin),
                                                        ObjectPropertyDescriptor(new FunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().copyWithin, builtinArrayCopyWithin, 2, nullptr, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
-    FunctionObject* values = new FunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().values, builtinArrayValues, 0, nullptr, NativeFunctionInfo::Strict));
+    m_arrayPrototypeValues = new FunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().values, builtinArrayValues, 0, nullptr, NativeFunctionInfo::Strict));
     m_arrayPrototype->defineOwnPropertyThrowsException(state, ObjectPropertyName(state.context()->staticStrings().values),
-                                                       ObjectPropertyDescriptor(values, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+                                                       ObjectPropertyDescriptor(m_arrayPrototypeValues, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
     m_arrayPrototype->defineOwnPropertyThrowsException(state, ObjectPropertyName(state, state.context()->vmInstance()->globalSymbols().iterator),
-                                                       ObjectPropertyDescriptor(values,
+                                                       ObjectPropertyDescriptor(m_arrayPrototypeValues,
                                                                                 (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
     m_arrayPrototype->defineOwnPropertyThrowsException(state, ObjectPropertyName(state.context()->staticStrings().entries),
@@ -1831,8 +1887,10 @@ void GlobalObject::installArray(ExecutionState& state)
     m_arrayIteratorPrototype = m_iteratorPrototype;
     m_arrayIteratorPrototype = new ArrayIteratorObject(state, nullptr, ArrayIteratorObject::TypeKey);
 
-    m_arrayIteratorPrototype->defineOwnPropertyThrowsException(state, ObjectPropertyName(state.context()->staticStrings().next),
-                                                               ObjectPropertyDescriptor(new FunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().next, builtinArrayIteratorNext, 0, nullptr, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    m_arrayIteratorPrototypeNext = new FunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().next, builtinArrayIteratorNext, 0, nullptr, NativeFunctionInfo::Strict));
+    // not through IteratorObject::defineOwnProperty, because this is not a change of next method
+    m_arrayIteratorPrototype->Object::defineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().next),
+                                                        ObjectPropertyDescriptor(m_arrayIteratorPrototypeNext, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
     m_arrayIteratorPrototype->defineOwnPropertyThrowsException(state, ObjectPropertyName(state, Value(state.context()->vmInstance()->globalSymbols().toStringTag)),
                                                                ObjectPropertyDescriptor(Value(String::fromASCII("Array Iterator")), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::ConfigurablePresent)));
 
@@ -123,6 +123,23 @@ static Value builtinErrorToString(ExecutionState& state, Value thisValue, size_t
     return builder.finalize(&state);
 }
 
+static Value builtinErrorObjectStackInfo(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
+{
+    if (!(LIKELY(thisValue.isPointerValue() && thisValue.asPointerValue()->isErrorObject()))) {
+        ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, "get Error.prototype.stack called on incompatible receiver");
+    }
+
+    ErrorObject* obj = thisValue.asObject()->asErrorObject();
+    if (obj->stackTraceData() == nullptr) {
+        return String::emptyString;
+    }
+
+    auto stackTraceData = obj->stackTraceData();
+    StringBuilder builder;
+    stackTraceData->buildStackTrace(state.context(), builder);
+    return builder.finalize();
+}
+
 void GlobalObject::installError(ExecutionState& state)
 {
     m_error = new FunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().Error, builtinErrorConstructor, 1, [](ExecutionState& state, CodeBlock* codeBlock, size_t argc, Value* argv) -> Object* {
@@ -150,6 +167,9 @@ void GlobalObject::installError(ExecutionState& state)
     m_throwTypeError = new FunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().ThrowTypeError, builtinErrorThrowTypeError, 0, nullptr, NativeFunctionInfo::Strict));
     m_throwerGetterSetterData = new JSGetterSetter(m_throwTypeError, m_throwTypeError);
 
+    auto errorStackGetter = new FunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().stack, builtinErrorObjectStackInfo, 0, nullptr, NativeFunctionInfo::Strict));
+    m_errorStackGetterSetterData = new JSGetterSetter(errorStackGetter, Value(Value::EmptyValue));
+
 #define DEFINE_ERROR(errorname, bname)                                                                                                                                                                                                                                                                                                  \
     m_##errorname##Error = new FunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().bname##Error, builtin##bname##ErrorConstructor, 1, [](ExecutionState& state, CodeBlock* codeBlock, size_t argc, Value* argv) -> Object* {                                                                                      \
                                                   return new bname##ErrorObject(state, String::emptyString);                                                                                                                                                                                                                            \
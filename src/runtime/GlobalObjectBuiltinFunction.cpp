@@ -101,20 +101,33 @@ static Value builtinFunctionConstructor(ExecutionState& state, Value thisValue,
     }
     src.appendString("\n}");
 
-    ScriptParser parser(state.context());
-    auto parserResult = parser.parse(src.finalize(&state), new ASCIIString("Function Constructor input"));
+    String* functionSource = src.finalize(&state);
+    CompiledEvalCache& cache = state.context()->compiledEvalCache();
+    bool canCache = CompiledEvalCache::canCache(functionSource);
+    CompiledEvalCacheKey key(functionSource, nullptr, false, false, true);
+    Script* script = canCache ? cache.find(key) : nullptr;
+
+    if (!script) {
+        ScriptParser parser(state.context());
+        auto parserResult = parser.parse(functionSource, new ASCIIString("Function Constructor input"));
+
+        if (parserResult.m_error) {
+            ErrorObject* err = ErrorObject::createError(state, parserResult.m_error->errorCode, parserResult.m_error->message);
+            state.throwException(err);
+        }
 
-    if (parserResult.m_error) {
-        ErrorObject* err = ErrorObject::createError(state, parserResult.m_error->errorCode, parserResult.m_error->message);
-        state.throwException(err);
-    }
+        script = parserResult.m_script;
+        script->topCodeBlock()->cachedASTNode()->deref();
+        script->topCodeBlock()->clearCachedASTNode();
+        script->topCodeBlock()->childBlocks()[0]->updateSourceElementStart(3, 1);
 
-    parserResult.m_script->topCodeBlock()->cachedASTNode()->deref();
-    parserResult.m_script->topCodeBlock()->clearCachedASTNode();
+        if (canCache) {
+            cache.insert(key, script);
+        }
+    }
 
-    InterpretedCodeBlock* cb = parserResult.m_script->topCodeBlock()->childBlocks()[0];
-    cb->updateSourceElementStart(3, 1);
-    LexicalEnvironment* globalEnvironment = new LexicalEnvironment(new GlobalEnvironmentRecord(state, parserResult.m_script->topCodeBlock(), state.context()->globalObject()), nullptr);
+    InterpretedCodeBlock* cb = script->topCodeBlock()->childBlocks()[0];
+    LexicalEnvironment* globalEnvironment = new LexicalEnvironment(new GlobalEnvironmentRecord(state, script->topCodeBlock(), state.context()->globalObject()), nullptr);
     return new FunctionObject(state, cb, globalEnvironment);
 }
 
@@ -165,8 +178,30 @@ static Value builtinFunctionApply(ExecutionState& state, Value thisValue, size_t
         // do nothing
     } else if (argArray.isObject()) {
         Object* obj = argArray.asObject();
+        // length of buffer allocated by fast paths
+        size_t capacity = 0;
+        // fast path for `fn.apply(thisArg, arguments)`. skip generic length and element lookups
+        if (obj->hasTag(g_argumentsObjectTag)) {
+            ArgumentsObject* argumentsObject = (ArgumentsObject*)obj;
+            arrlen = capacity = argumentsObject->argumentCount();
+            arguments = ALLOCA(sizeof(Value) * arrlen, Value, state);
+            if (LIKELY(argumentsObject->tryToCopyArguments(state, arguments))) {
+                return thisVal->call(state, thisArg, arrlen, arguments);
+            }
+        } else if (obj->isArrayObject() && obj->asArrayObject()->isFastModeArray()) {
+            // fast path for `fn.apply(thisArg, array)`. copy elements of fast mode array at once
+            ArrayObject* arrayObject = obj->asArrayObject();
+            arrlen = capacity = arrayObject->length(state);
+            arguments = ALLOCA(sizeof(Value) * arrlen, Value, state);
+            if (LIKELY(arrayObject->tryToCopyFastModeElements(state, arguments))) {
+                return thisVal->call(state, thisArg, arrlen, arguments);
+            }
+        }
         arrlen = obj->length(state);
-        arguments = ALLOCA(sizeof(Value) * arrlen, Value, state);
+        // reuse buffer of failed fast path. large ALLOCA is GC_MALLOC, not a stack allocation
+        if (arrlen > capacity) {
+            arguments = ALLOCA(sizeof(Value) * arrlen, Value, state);
+        }
         for (size_t i = 0; i < arrlen; i++) {
             auto re = obj->getIndexedProperty(state, Value(i));
             if (re.hasValue()) {
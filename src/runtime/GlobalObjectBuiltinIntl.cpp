@@ -1168,7 +1168,21 @@ static void initializeCollator(ExecutionState& state, Object* collator, Value lo
         CollatorResolvedOptions opt = collatorResolvedOptions(state, internalSlot);
         UErrorCode status = U_ZERO_ERROR;
         String* locale = opt.locale;
-        UCollator* collator = ucol_open(locale->toUTF8StringData().data(), &status);
+        UTF8StringData localeData = locale->toUTF8StringData();
+
+        VMInstance* vmInstance = state.context()->vmInstance();
+        std::string cacheKey(localeData.data(), localeData.length());
+        cacheKey += '|';
+        cacheKey += opt.sensitivity->toNonGCUTF8StringData();
+        cacheKey += opt.numeric ? "|n" : "|";
+        cacheKey += opt.ignorePunctuation ? "|p" : "|";
+        void* sharedCollator = vmInstance->findSharedICUObject(VMInstance::SharedCollator, cacheKey);
+        if (sharedCollator) {
+            internalSlot->setExtraData(sharedCollator);
+            return;
+        }
+
+        UCollator* collator = ucol_open(localeData.data(), &status);
         if (U_FAILURE(status)) {
             return;
         }
@@ -1206,6 +1220,9 @@ static void initializeCollator(ExecutionState& state, Object* collator, Value lo
         }
 
         internalSlot->setExtraData(collator);
+        if (vmInstance->addSharedICUObject(VMInstance::SharedCollator, cacheKey, collator)) {
+            return;
+        }
 
         GC_REGISTER_FINALIZER_NO_ORDER(internalSlot, [](void* obj,
                                                         void*) {
@@ -1293,6 +1310,27 @@ static Value builtinIntlCollatorCompare(ExecutionState& state, Value thisValue,
     return Value(result);
 }
 
+Object* createIntlCollator(ExecutionState& state, Value locales, Value options)
+{
+    Object* collator = new Object(state);
+    initializeCollator(state, collator, locales, options);
+    return collator;
+}
+
+UCollator* intlCollatorOf(Object* collator)
+{
+    return (UCollator*)collator->internalSlot()->extraData();
+}
+
+UCollator* intlCollatorOfCompareFunction(FunctionObject* fn)
+{
+    CodeBlock* cb = fn->codeBlock();
+    if (cb->hasCallNativeFunctionCode() && cb->nativeFunctionData()->m_fn == builtinIntlCollatorCompare && fn->hasInternalSlot()) {
+        return (UCollator*)fn->internalSlot()->extraData();
+    }
+    return nullptr;
+}
+
 static Value builtinIntlCollatorCompareGetter(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
 {
     if (!thisValue.isObject() || !thisValue.asObject()->hasInternalSlot() || !thisValue.asObject()->internalSlot()->hasOwnProperty(state, ObjectPropertyName(state, String::fromASCII("initializedCollator")))) {
@@ -1809,10 +1847,16 @@ static void initializeDateTimeFormat(ExecutionState& state, Object* dateTimeForm
     // Always use ICU date format generator, rather than our own pattern list and matcher.
     // Covers steps 28-36.
     UErrorCode status = U_ZERO_ERROR;
-    UDateTimePatternGenerator* generator = udatpg_open(dataLocale.toString(state)->toUTF8StringData().data(), &status);
-    if (U_FAILURE(status)) {
-        ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, "failed to initialize DateTimeFormat");
-        return;
+    std::string dataLocaleString = dataLocale.toString(state)->toNonGCUTF8StringData();
+    UDateTimePatternGenerator* generator = (UDateTimePatternGenerator*)state.context()->vmInstance()->findSharedICUObject(VMInstance::SharedDateTimePatternGenerator, dataLocaleString);
+    bool isSharedGenerator = generator;
+    if (!isSharedGenerator) {
+        generator = udatpg_open(dataLocaleString.data(), &status);
+        if (U_FAILURE(status)) {
+            ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, "failed to initialize DateTimeFormat");
+            return;
+        }
+        isSharedGenerator = state.context()->vmInstance()->addSharedICUObject(VMInstance::SharedDateTimePatternGenerator, dataLocaleString, generator);
     }
 
     String* skeleton = skeletonBuilder.finalize();
@@ -1826,7 +1870,9 @@ static void initializeDateTimeFormat(ExecutionState& state, Object* dateTimeForm
         patternBuffer.resize(patternLength);
         udatpg_getBestPattern(generator, (UChar*)skeletonUTF16String.data(), skeletonUTF16String.length(), (UChar*)patternBuffer.data(), patternLength, &status);
     }
-    udatpg_close(generator);
+    if (!isSharedGenerator) {
+        udatpg_close(generator);
+    }
     if (U_FAILURE(status)) {
         ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, "failed to initialize DateTimeFormat");
         return;
@@ -1926,22 +1972,38 @@ static void initializeDateTimeFormat(ExecutionState& state, Object* dateTimeForm
     }
 
     status = U_ZERO_ERROR;
-    UTF16StringData timeZoneView = dateTimeFormat->internalSlot()->get(state, ObjectPropertyName(state, String::fromASCII("timeZone"))).value(state, dateTimeFormat->internalSlot()).toString(state)->toUTF16StringData();
+    String* timeZoneString = dateTimeFormat->internalSlot()->get(state, ObjectPropertyName(state, String::fromASCII("timeZone"))).value(state, dateTimeFormat->internalSlot()).toString(state);
+    UTF16StringData timeZoneView = timeZoneString->toUTF16StringData();
     UTF8StringData localeStringView = r->at(String::fromASCII("locale"))->toUTF8StringData();
-    UDateFormat* icuDateFormat = udat_open(UDAT_IGNORE, UDAT_IGNORE, localeStringView.data(), (UChar*)timeZoneView.data(), timeZoneView.length(), (UChar*)patternBuffer.data(), patternBuffer.length(), &status);
-    if (U_FAILURE(status)) {
-        ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, "failed to initialize DateTimeFormat");
-        return;
-    }
 
-    dateTimeFormat->internalSlot()->setExtraData(icuDateFormat);
+    // udat_open is expensive. formats which have same locale, timezone and pattern are shared
+    VMInstance* vmInstance = state.context()->vmInstance();
+    std::string cacheKey(localeStringView.data(), localeStringView.length());
+    cacheKey += '|';
+    cacheKey += timeZoneString->toNonGCUTF8StringData();
+    cacheKey += '|';
+    cacheKey.append((const char*)patternBuffer.data(), patternBuffer.length() * sizeof(char16_t));
+    UDateFormat* icuDateFormat = (UDateFormat*)vmInstance->findSharedICUObject(VMInstance::SharedDateFormat, cacheKey);
+    if (icuDateFormat) {
+        dateTimeFormat->internalSlot()->setExtraData(icuDateFormat);
+    } else {
+        icuDateFormat = udat_open(UDAT_IGNORE, UDAT_IGNORE, localeStringView.data(), (UChar*)timeZoneView.data(), timeZoneView.length(), (UChar*)patternBuffer.data(), patternBuffer.length(), &status);
+        if (U_FAILURE(status)) {
+            ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, "failed to initialize DateTimeFormat");
+            return;
+        }
 
-    GC_REGISTER_FINALIZER_NO_ORDER(dateTimeFormat->internalSlot(), [](void* obj,
-                                                                      void*) {
-        Object* self = (Object*)obj;
-        udat_close((UDateFormat*)self->extraData());
-    },
-                                   nullptr, nullptr, nullptr);
+        dateTimeFormat->internalSlot()->setExtraData(icuDateFormat);
+
+        if (!vmInstance->addSharedICUObject(VMInstance::SharedDateFormat, cacheKey, icuDateFormat)) {
+            GC_REGISTER_FINALIZER_NO_ORDER(dateTimeFormat->internalSlot(), [](void* obj,
+                                                                              void*) {
+                Object* self = (Object*)obj;
+                udat_close((UDateFormat*)self->extraData());
+            },
+                                           nullptr, nullptr, nullptr);
+        }
+    }
 
     // Set dateTimeFormat.[[boundFormat]] to undefined.
     // Set dateTimeFormat.[[initializedDateTimeFormat]] to true.
@@ -2365,37 +2427,76 @@ static void initializeNumberFormat(ExecutionState& state, Object* numberFormat,
         }
     }
 
+    Object* internalSlot = numberFormat->internalSlot();
+    String* localeOption = internalSlot->get(state, ObjectPropertyName(state, String::fromASCII("locale"))).value(state, internalSlot).toString(state);
+    String* currencyString = nullptr;
+    if (styleOption->equals("currency")) {
+        currencyString = internalSlot->get(state, ObjectPropertyName(state, String::fromASCII("currency"))).value(state, internalSlot).toString(state);
+    }
+
+    bool useSignificantDigits = internalSlot->hasOwnProperty(state, ObjectPropertyName(state, String::fromASCII("minimumSignificantDigits")));
+    double digits[3];
+    if (!useSignificantDigits) {
+        digits[0] = internalSlot->get(state, ObjectPropertyName(state, String::fromASCII("minimumIntegerDigits"))).value(state, internalSlot).toNumber(state);
+        digits[1] = internalSlot->get(state, ObjectPropertyName(state, String::fromASCII("minimumFractionDigits"))).value(state, internalSlot).toNumber(state);
+        digits[2] = internalSlot->get(state, ObjectPropertyName(state, String::fromASCII("maximumFractionDigits"))).value(state, internalSlot).toNumber(state);
+    } else {
+        digits[0] = internalSlot->get(state, ObjectPropertyName(state, String::fromASCII("minimumSignificantDigits"))).value(state, internalSlot).toNumber(state);
+        digits[1] = internalSlot->get(state, ObjectPropertyName(state, String::fromASCII("maximumSignificantDigits"))).value(state, internalSlot).toNumber(state);
+        digits[2] = 0;
+    }
+    bool useGrouping = internalSlot->get(state, ObjectPropertyName(state, String::fromASCII("useGrouping"))).value(state, internalSlot).toBoolean(state);
+
+    // unum_open is expensive. formats which have same locale and options are shared
+    VMInstance* vmInstance = state.context()->vmInstance();
+    UTF8StringData localeData = localeOption->toUTF8StringData();
+    std::string cacheKey(localeData.data(), localeData.length());
+    char optionBuffer[128];
+    snprintf(optionBuffer, sizeof(optionBuffer), "|%d|%d|%g|%g|%g|%d", (int)style, (int)useSignificantDigits, digits[0], digits[1], digits[2], (int)useGrouping);
+    cacheKey += optionBuffer;
+    if (currencyString) {
+        cacheKey += currencyString->toNonGCUTF8StringData();
+    }
+
+    UNumberFormat* unumberFormat = (UNumberFormat*)vmInstance->findSharedICUObject(VMInstance::SharedNumberFormat, cacheKey);
+    if (unumberFormat) {
+        internalSlot->setExtraData(unumberFormat);
+        return;
+    }
+
     UErrorCode status = U_ZERO_ERROR;
-    String* localeOption = numberFormat->internalSlot()->get(state, ObjectPropertyName(state, String::fromASCII("locale"))).value(state, numberFormat->internalSlot()).toString(state);
-    UNumberFormat* unumberFormat = unum_open(style, nullptr, 0, localeOption->toUTF8StringData().data(), nullptr, &status);
+    unumberFormat = unum_open(style, nullptr, 0, localeData.data(), nullptr, &status);
     if (U_FAILURE(status)) {
         ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, "Failed to init NumberFormat");
     }
 
-    if (styleOption->equals("currency")) {
-        String* currencyString = numberFormat->internalSlot()->get(state, ObjectPropertyName(state, String::fromASCII("currency"))).value(state, numberFormat->internalSlot()).toString(state);
+    if (currencyString) {
         unum_setTextAttribute(unumberFormat, UNUM_CURRENCY_CODE, (UChar*)currencyString->toUTF16StringData().data(), 3, &status);
     }
 
-    if (!numberFormat->internalSlot()->hasOwnProperty(state, ObjectPropertyName(state, String::fromASCII("minimumSignificantDigits")))) {
-        unum_setAttribute(unumberFormat, UNUM_MIN_INTEGER_DIGITS, numberFormat->internalSlot()->get(state, ObjectPropertyName(state, String::fromASCII("minimumIntegerDigits"))).value(state, numberFormat->internalSlot()).toNumber(state));
-        unum_setAttribute(unumberFormat, UNUM_MIN_FRACTION_DIGITS, numberFormat->internalSlot()->get(state, ObjectPropertyName(state, String::fromASCII("minimumFractionDigits"))).value(state, numberFormat->internalSlot()).toNumber(state));
-        unum_setAttribute(unumberFormat, UNUM_MAX_FRACTION_DIGITS, numberFormat->internalSlot()->get(state, ObjectPropertyName(state, String::fromASCII("maximumFractionDigits"))).value(state, numberFormat->internalSlot()).toNumber(state));
+    if (!useSignificantDigits) {
+        unum_setAttribute(unumberFormat, UNUM_MIN_INTEGER_DIGITS, digits[0]);
+        unum_setAttribute(unumberFormat, UNUM_MIN_FRACTION_DIGITS, digits[1]);
+        unum_setAttribute(unumberFormat, UNUM_MAX_FRACTION_DIGITS, digits[2]);
     } else {
         unum_setAttribute(unumberFormat, UNUM_SIGNIFICANT_DIGITS_USED, true);
-        unum_setAttribute(unumberFormat, UNUM_MIN_SIGNIFICANT_DIGITS, numberFormat->internalSlot()->get(state, ObjectPropertyName(state, String::fromASCII("minimumSignificantDigits"))).value(state, numberFormat->internalSlot()).toNumber(state));
-        unum_setAttribute(unumberFormat, UNUM_MAX_SIGNIFICANT_DIGITS, numberFormat->internalSlot()->get(state, ObjectPropertyName(state, String::fromASCII("maximumSignificantDigits"))).value(state, numberFormat->internalSlot()).toNumber(state));
+        unum_setAttribute(unumberFormat, UNUM_MIN_SIGNIFICANT_DIGITS, digits[0]);
+        unum_setAttribute(unumberFormat, UNUM_MAX_SIGNIFICANT_DIGITS, digits[1]);
     }
-    unum_setAttribute(unumberFormat, UNUM_GROUPING_USED, numberFormat->internalSlot()->get(state, ObjectPropertyName(state, String::fromASCII("useGrouping"))).value(state, numberFormat->internalSlot()).toBoolean(state));
+    unum_setAttribute(unumberFormat, UNUM_GROUPING_USED, useGrouping);
     unum_setAttribute(unumberFormat, UNUM_ROUNDING_MODE, UNUM_ROUND_HALFUP);
     if (U_FAILURE(status)) {
+        unum_close(unumberFormat);
         ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, "Failed to init NumberFormat");
     }
 
-    numberFormat->internalSlot()->setExtraData(unumberFormat);
+    internalSlot->setExtraData(unumberFormat);
+    if (vmInstance->addSharedICUObject(VMInstance::SharedNumberFormat, cacheKey, unumberFormat)) {
+        return;
+    }
 
-    GC_REGISTER_FINALIZER_NO_ORDER(numberFormat->internalSlot(), [](void* obj,
-                                                                    void*) {
+    GC_REGISTER_FINALIZER_NO_ORDER(internalSlot, [](void* obj,
+                                                    void*) {
         Object* self = (Object*)obj;
         unum_close((UNumberFormat*)self->extraData());
     },
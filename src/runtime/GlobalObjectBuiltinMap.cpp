@@ -63,13 +63,12 @@ Value builtinMapConstructor(ExecutionState& state, Value thisValue, size_t argc,
     // Repeat
     while (true) {
         // Let next be ? IteratorStep(iter).
-        Value next = iteratorStep(state, iter);
         // If next is false(done is true), return map.
-        if (next.isFalse()) {
+        // Let nextItem be ? IteratorValue(next).
+        Value nextItem;
+        if (!iteratorStepValue(state, iter, nextItem)) {
             return map;
         }
-        // Let nextItem be ? IteratorValue(next).
-        Value nextItem = iteratorValue(state, next);
 
         // If Type(nextItem) is not Object, then
         if (!nextItem.isObject()) {
@@ -260,8 +259,10 @@ void GlobalObject::installMap(ExecutionState& state)
     m_mapIteratorPrototype = m_iteratorPrototype;
     m_mapIteratorPrototype = new MapIteratorObject(state, nullptr, MapIteratorObject::TypeKey);
 
-    m_mapIteratorPrototype->defineOwnPropertyThrowsException(state, ObjectPropertyName(state.context()->staticStrings().next),
-                                                             ObjectPropertyDescriptor(new FunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().next, builtinMapIteratorNext, 0, nullptr, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    m_mapIteratorPrototypeNext = new FunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().next, builtinMapIteratorNext, 0, nullptr, NativeFunctionInfo::Strict));
+    // not through IteratorObject::defineOwnProperty, because this is not a change of next method
+    m_mapIteratorPrototype->Object::defineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().next),
+                                                      ObjectPropertyDescriptor(m_mapIteratorPrototypeNext, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
     m_mapIteratorPrototype->defineOwnPropertyThrowsException(state, ObjectPropertyName(state, Value(state.context()->vmInstance()->globalSymbols().toStringTag)),
                                                              ObjectPropertyDescriptor(Value(String::fromASCII("Map Iterator")), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::ConfigurablePresent)));
@@ -342,13 +342,11 @@ static Value builtinPromiseThen(ExecutionState& state, Value thisValue, size_t a
         break;
     }
     case PromiseObject::PromiseState::FulFilled: {
-        Job* job = new PromiseReactionJob(state.context(), PromiseReaction(onFulfilled, capability), promise->promiseResult());
-        state.context()->jobQueue()->enqueueJob(state, job);
+        state.context()->jobQueue()->enqueuePromiseReactionJob(state, PromiseReaction(onFulfilled, capability), promise->promiseResult());
         break;
     }
     case PromiseObject::PromiseState::Rejected: {
-        Job* job = new PromiseReactionJob(state.context(), PromiseReaction(onRejected, capability), promise->promiseResult());
-        state.context()->jobQueue()->enqueueJob(state, job);
+        state.context()->jobQueue()->enqueuePromiseReactionJob(state, PromiseReaction(onRejected, capability), promise->promiseResult());
         break;
     }
     default:
@@ -65,13 +65,12 @@ Value builtinSetConstructor(ExecutionState& state, Value thisValue, size_t argc,
     // Repeat
     while (true) {
         // Let next be ? IteratorStep(iter).
-        Value next = iteratorStep(state, iter);
         // If next is false, return set.
-        if (next.isFalse()) {
+        // Let nextValue be ? IteratorValue(next).
+        Value nextValue;
+        if (!iteratorStepValue(state, iter, nextValue)) {
             return set;
         }
-        // Let nextValue be ? IteratorValue(next).
-        Value nextValue = iteratorValue(state, next);
 
         // Let status be Call(adder, set, « nextValue.[[Value]] »).
         // TODO If status is an abrupt completion, return ? IteratorClose(iter, status).
@@ -232,8 +231,10 @@ void GlobalObject::installSet(ExecutionState& state)
     m_setIteratorPrototype = m_iteratorPrototype;
     m_setIteratorPrototype = new SetIteratorObject(state, nullptr, SetIteratorObject::TypeKey);
 
-    m_setIteratorPrototype->defineOwnPropertyThrowsException(state, ObjectPropertyName(state.context()->staticStrings().next),
-                                                             ObjectPropertyDescriptor(new FunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().next, builtinSetIteratorNext, 0, nullptr, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    m_setIteratorPrototypeNext = new FunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().next, builtinSetIteratorNext, 0, nullptr, NativeFunctionInfo::Strict));
+    // not through IteratorObject::defineOwnProperty, because this is not a change of next method
+    m_setIteratorPrototype->Object::defineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().next),
+                                                      ObjectPropertyDescriptor(m_setIteratorPrototypeNext, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
     m_setIteratorPrototype->defineOwnPropertyThrowsException(state, ObjectPropertyName(state, Value(state.context()->vmInstance()->globalSymbols().toStringTag)),
                                                              ObjectPropertyDescriptor(Value(String::fromASCII("Set Iterator")), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::ConfigurablePresent)));
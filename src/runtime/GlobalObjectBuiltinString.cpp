@@ -120,10 +120,116 @@ static Value builtinStringLastIndexOf(ExecutionState& state, Value thisValue, si
     return Value(result);
 }
 
+#if defined(ENABLE_ICU)
+// compares ASCII strings with collation weights of each character
+// returns false when there is a non-ASCII character
+static bool compareASCIIStringsWithCollationWeights(const VMInstance::ASCIICollationWeights* weights, const LChar* a, size_t aLength, const LChar* b, size_t bLength, int& result)
+{
+    for (size_t i = 0; i < aLength; i++) {
+        if (a[i] >= 128) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < bLength; i++) {
+        if (b[i] >= 128) {
+            return false;
+        }
+    }
+
+    // primary level
+    size_t i = 0, j = 0;
+    while (true) {
+        while (i < aLength && !weights->m_primary[a[i]]) {
+            i++;
+        }
+        while (j < bLength && !weights->m_primary[b[j]]) {
+            j++;
+        }
+        if (i == aLength || j == bLength) {
+            break;
+        }
+        if (weights->m_primary[a[i]] != weights->m_primary[b[j]]) {
+            result = weights->m_primary[a[i]] < weights->m_primary[b[j]] ? -1 : 1;
+            return true;
+        }
+        i++;
+        j++;
+    }
+    if (i != aLength || j != bLength) {
+        result = i != aLength ? 1 : -1;
+        return true;
+    }
+
+    // tertiary level. secondary weights of ASCII characters are all same
+    i = j = 0;
+    while (true) {
+        while (i < aLength && !weights->m_primary[a[i]]) {
+            i++;
+        }
+        while (j < bLength && !weights->m_primary[b[j]]) {
+            j++;
+        }
+        if (i == aLength || j == bLength) {
+            break;
+        }
+        if (weights->m_tertiary[a[i]] != weights->m_tertiary[b[j]]) {
+            result = weights->m_tertiary[a[i]] < weights->m_tertiary[b[j]] ? -1 : 1;
+            return true;
+        }
+        i++;
+        j++;
+    }
+
+    result = 0;
+    return true;
+}
+#endif
+
 static Value builtinStringLocaleCompare(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
 {
     RESOLVE_THIS_BINDING_TO_STRING(S, String, localeCompare);
     String* That = argv[0].toString(state);
+#if defined(ENABLE_ICU)
+#if defined(ENABLE_INTL)
+    // http://www.ecma-international.org/ecma-402/1.0/#sec-13.1.1
+    if ((argc > 1 && !argv[1].isUndefined()) || (argc > 2 && !argv[2].isUndefined())) {
+        // collator for a locale string without options is cached. only options object can be observed by user
+        bool isCacheable = argv[1].isString() && (argc < 3 || argv[2].isUndefined());
+        VMInstance* vmInstance = state.context()->vmInstance();
+        Object* collatorObject = isCacheable ? vmInstance->localeCompareCollatorObject(argv[1].asString()) : nullptr;
+        if (!collatorObject) {
+            collatorObject = createIntlCollator(state, argv[1], argc > 2 ? argv[2] : Value());
+            if (isCacheable) {
+                vmInstance->setLocaleCompareCollatorObject(argv[1].asString(), collatorObject);
+            }
+        }
+        UCollator* collator = intlCollatorOf(collatorObject);
+        auto utf16S = S->toUTF16StringData();
+        auto utf16That = That->toUTF16StringData();
+        if (collator) {
+            return Value((int)ucol_strcoll(collator, (const UChar*)utf16S.data(), utf16S.length(), (const UChar*)utf16That.data(), utf16That.length()));
+        }
+        return Value(stringCompare(*S, *That));
+    }
+#endif
+    VMInstance* vmInstance = state.context()->vmInstance();
+    const VMInstance::ASCIICollationWeights* weights = vmInstance->localeCompareASCIIWeights();
+    if (weights && S->has8BitContent() && That->has8BitContent()) {
+        const auto& dataS = S->bufferAccessData();
+        const auto& dataThat = That->bufferAccessData();
+        int result;
+        if (compareASCIIStringsWithCollationWeights(weights, (const LChar*)dataS.buffer, dataS.length, (const LChar*)dataThat.buffer, dataThat.length, result)) {
+            return Value(result);
+        }
+    }
+
+    UCollator* collator = vmInstance->localeCompareCollator();
+    if (collator) {
+        auto utf16S = S->toUTF16StringData();
+        auto utf16That = That->toUTF16StringData();
+        return Value((int)ucol_strcoll(collator, (const UChar*)utf16S.data(), utf16S.length(), (const UChar*)utf16That.data(), utf16That.length()));
+    }
+#endif
     return Value(stringCompare(*S, *That));
 }
 
@@ -333,12 +439,10 @@ static Value builtinStringReplace(ExecutionState& state, Value thisValue, size_t
         String* searchString = searchValue.toString(state);
         size_t idx = string->find(searchString);
         if (idx != (size_t)-1) {
-            std::vector<RegexMatchResult::RegexMatchResultPiece> piece;
-            RegexMatchResult::RegexMatchResultPiece p;
-            p.m_start = idx;
-            p.m_end = idx + searchString->length();
-            piece.push_back(std::move(p));
-            result.m_matchResults.push_back(std::move(piece));
+            RegexMatchResult::RegexMatchResultPiece piece;
+            piece.m_start = idx;
+            piece.m_end = idx + searchString->length();
+            result.m_matchResults.push_back(&piece, 1);
         }
     }
 
@@ -622,6 +726,23 @@ static Value builtinStringSplit(ExecutionState& state, Value thisValue, size_t a
                 q = p;
             }
         }
+    } else if (P->asString()->length()) {
+        // search next separator directly instead of matching it at every position
+        String* R = P->asString();
+        size_t r = R->length();
+        while (q != s) {
+            q = S->find(R, q);
+            if (q == SIZE_MAX) {
+                break;
+            }
+
+            String* T = S->substring(p, q);
+            A->defineOwnProperty(state, ObjectPropertyName(state, Value(lengthA++)), ObjectPropertyDescriptor(T, ObjectPropertyDescriptor::AllPresent));
+            if (lengthA == lim)
+                return A;
+            p = q + r;
+            q = p;
+        }
     } else {
         String* R = P->asString();
         while (q != s) {
@@ -656,6 +777,14 @@ static Value builtinStringCharCodeAt(ExecutionState& state, Value thisValue, siz
     RESOLVE_THIS_BINDING_TO_STRING(str, String, charCodeAt);
     int position = argv[0].toInteger(state);
     Value ret;
+    if (UNLIKELY(str->isRopeString())) {
+        // RopeString::charAt reads the character without flattening
+        if (position < 0 || position >= (int)str->length())
+            ret = Value(std::numeric_limits<double>::quiet_NaN());
+        else
+            ret = Value(str->charAt(position));
+        return ret;
+    }
     const auto& data = str->bufferAccessData();
     if (position < 0 || position >= (int)data.length)
         ret = Value(std::numeric_limits<double>::quiet_NaN());
@@ -684,14 +813,18 @@ static Value builtinStringCharAt(ExecutionState& state, Value thisValue, size_t
         return Value(String::emptyString);
     }
 
-    const auto& accessData = str->bufferAccessData();
-
-    if (LIKELY(0 <= position && position < (int64_t)accessData.length)) {
+    if (LIKELY(0 <= position && position < (int64_t)str->length())) {
         char16_t c;
-        if (accessData.has8BitContent) {
-            c = ((LChar*)accessData.buffer)[position];
+        if (UNLIKELY(str->isRopeString())) {
+            // RopeString::charAt reads the character without flattening
+            c = str->charAt(position);
         } else {
-            c = ((char16_t*)accessData.buffer)[position];
+            const auto& accessData = str->bufferAccessData();
+            if (accessData.has8BitContent) {
+                c = ((LChar*)accessData.buffer)[position];
+            } else {
+                c = ((char16_t*)accessData.buffer)[position];
+            }
         }
         if (LIKELY(c < ESCARGOT_ASCII_TABLE_MAX)) {
             return state.context()->staticStrings().asciiTable[c].string();
@@ -907,16 +1040,7 @@ static Value builtinStringStartsWith(ExecutionState& state, Value thisValue, siz
     }
     // If the sequence of elements of S starting at start of length searchLength is the same as the full element sequence of searchStr, return true.
     // Otherwise, return false.
-    const auto& srcData = S->bufferAccessData();
-    const auto& src2Data = searchStr->bufferAccessData();
-
-    for (size_t i = 0; i < src2Data.length; i++) {
-        if (srcData.charAt(i + start) != src2Data.charAt(i)) {
-            return Value(false);
-        }
-    }
-
-    return Value(true);
+    return Value(S->isSubstringAt(searchStr, (size_t)start));
 }
 
 static Value builtinStringEndsWith(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
@@ -954,15 +1078,7 @@ static Value builtinStringEndsWith(ExecutionState& state, Value thisValue, size_
         return Value(false);
     }
     // If the sequence of elements of S starting at start of length searchLength is the same as the full element sequence of searchStr, return true.
-    const auto& srcData = S->bufferAccessData();
-    const auto& src2Data = searchStr->bufferAccessData();
-    for (size_t i = 0; i < searchLength; i++) {
-        if (srcData.charAt(i + start) != src2Data.charAt(i)) {
-            return Value(false);
-        }
-    }
-
-    return Value(true);
+    return Value(S->isSubstringAt(searchStr, (size_t)start));
 }
 
 // ( template, ...substitutions )
@@ -1197,8 +1313,10 @@ void GlobalObject::installString(ExecutionState& state)
     m_stringIteratorPrototype = m_iteratorPrototype;
     m_stringIteratorPrototype = new StringIteratorObject(state, nullptr);
 
-    m_stringIteratorPrototype->defineOwnPropertyThrowsException(state, ObjectPropertyName(state.context()->staticStrings().next),
-                                                                ObjectPropertyDescriptor(new FunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().next, builtinStringIteratorNext, 0, nullptr, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    m_stringIteratorPrototypeNext = new FunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().next, builtinStringIteratorNext, 0, nullptr, NativeFunctionInfo::Strict));
+    // not through IteratorObject::defineOwnProperty, because this is not a change of next method
+    m_stringIteratorPrototype->Object::defineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().next),
+                                                         ObjectPropertyDescriptor(m_stringIteratorPrototypeNext, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
     m_stringIteratorPrototype->defineOwnPropertyThrowsException(state, ObjectPropertyName(state, Value(state.context()->vmInstance()->globalSymbols().toStringTag)),
                                                                 ObjectPropertyDescriptor(Value(String::fromASCII("String Iterator")), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::ConfigurablePresent)));
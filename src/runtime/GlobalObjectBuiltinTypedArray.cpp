@@ -144,18 +144,14 @@ static Value TypedArrayFrom(ExecutionState& state, const Value& constructor, con
         // Let values be a new empty List.
         ValueVector values;
         // Let next be true.
-        Value next(Value::True);
         // Repeat, while next is not false
-        while (!next.isFalse()) {
-            // Let next be IteratorStep(iterator).
-            next = iteratorStep(state, iterator);
-            // If next is not false, then
-            if (!next.isFalse()) {
-                // Let nextValue be IteratorValue(next).
-                Value nextValue = iteratorValue(state, next);
-                // Append nextValue to the end of the List values.
-                values.push_back(nextValue);
-            }
+        //   Let next be IteratorStep(iterator).
+        //   If next is not false, then
+        //     Let nextValue be IteratorValue(next).
+        //     Append nextValue to the end of the List values.
+        Value nextValue;
+        while (iteratorStepValue(state, iterator, nextValue)) {
+            values.push_back(nextValue);
         }
         // Let len be the number of elements in values.
         size_t len = values.size();
@@ -38,22 +38,22 @@ struct GlobalRegExpFunctionObjectBuiltinFunctions {
 
     static Value builtinGlobalRegExpFunctionObjectLastMatchGetter(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
     {
-        return Value(new StringView(state.executionContext()->resolveCallee()->internalSlot()->asGlobalObject()->regexp()->m_status.lastMatch));
+        return Value(state.executionContext()->resolveCallee()->internalSlot()->asGlobalObject()->regexp()->m_status.lastMatchString());
     }
 
     static Value builtinGlobalRegExpFunctionObjectLastParenGetter(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
     {
-        return Value(new StringView(state.executionContext()->resolveCallee()->internalSlot()->asGlobalObject()->regexp()->m_status.lastParen));
+        return Value(state.executionContext()->resolveCallee()->internalSlot()->asGlobalObject()->regexp()->m_status.lastParenString());
     }
 
     static Value builtinGlobalRegExpFunctionObjectLeftContextGetter(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
     {
-        return Value(new StringView(state.executionContext()->resolveCallee()->internalSlot()->asGlobalObject()->regexp()->m_status.leftContext));
+        return Value(state.executionContext()->resolveCallee()->internalSlot()->asGlobalObject()->regexp()->m_status.leftContextString());
     }
 
     static Value builtinGlobalRegExpFunctionObjectRightContextGetter(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
     {
-        return Value(new StringView(state.executionContext()->resolveCallee()->internalSlot()->asGlobalObject()->regexp()->m_status.rightContext));
+        return Value(state.executionContext()->resolveCallee()->internalSlot()->asGlobalObject()->regexp()->m_status.rightContextString());
     }
 
 #define DEFINE_GETTER(number)                                                                                                                                    \
@@ -63,7 +63,7 @@ struct GlobalRegExpFunctionObjectBuiltinFunctions {
         if (status.pairCount < number) {                                                                                                                         \
             return Value(String::emptyString);                                                                                                                   \
         }                                                                                                                                                        \
-        return Value(new StringView(thisValue.asObject()->asGlobalRegExpFunctionObject()->m_status.pairs[number - 1]));                                          \
+        return Value(status.pairString(number - 1));                                                                                                             \
     }
 
     DEFINE_GETTER(1)
@@ -25,22 +25,58 @@
 
 namespace Escargot {
 
+// legacy static properties are not made on every match
+// last successful match is kept as input string and offsets, and strings are made on read
 struct RegExpStatus {
     String* input; // RegExp.input ($_)
-    StringView lastMatch;
-    StringView lastParen;
-    StringView leftContext;
-    StringView rightContext;
+    String* lastMatchInput;
+    RegexMatchResult::RegexMatchResultPiece lastMatch;
+    RegexMatchResult::RegexMatchResultPiece lastParen;
     size_t pairCount;
-    StringView pairs[9];
+    RegexMatchResult::RegexMatchResultPiece pairs[9];
 
     RegExpStatus()
     {
         input = String::emptyString;
-        lastParen = lastMatch = StringView();
-        leftContext = rightContext = StringView();
+        lastMatchInput = String::emptyString;
+        lastMatch.m_start = lastMatch.m_end = 0;
+        lastParen.m_start = lastParen.m_end = std::numeric_limits<unsigned>::max();
         pairCount = 0;
-        pairs[0] = pairs[1] = pairs[2] = pairs[3] = pairs[4] = pairs[5] = pairs[6] = pairs[7] = pairs[8] = StringView();
+    }
+
+    StringView* lastMatchString() const
+    {
+        return new StringView(lastMatchInput, lastMatch.m_start, lastMatch.m_end);
+    }
+
+    StringView* lastParenString() const
+    {
+        return pieceString(lastParen);
+    }
+
+    StringView* leftContextString() const
+    {
+        return new StringView(lastMatchInput, 0, lastMatch.m_start);
+    }
+
+    StringView* rightContextString() const
+    {
+        return new StringView(lastMatchInput, lastMatch.m_end, lastMatchInput->length());
+    }
+
+    StringView* pairString(size_t index) const
+    {
+        ASSERT(index < pairCount && index < 9);
+        return pieceString(pairs[index]);
+    }
+
+private:
+    StringView* pieceString(const RegexMatchResult::RegexMatchResultPiece& piece) const
+    {
+        if (piece.m_start == std::numeric_limits<unsigned>::max()) {
+            return new StringView();
+        }
+        return new StringView(lastMatchInput, piece.m_start, piece.m_end);
     }
 };
 
@@ -20,14 +20,42 @@
 #include "Escargot.h"
 #include "IteratorObject.h"
 #include "Context.h"
+#include "VMInstance.h"
 
 namespace Escargot {
 
+static bool isNextPropertyName(ExecutionState& state, const ObjectPropertyName& P)
+{
+    return !P.isUIntType() && P.propertyName() == PropertyName(state.context()->staticStrings().next);
+}
+
 IteratorObject::IteratorObject(ExecutionState& state)
     : Object(state)
 {
 }
 
+bool IteratorObject::defineOwnProperty(ExecutionState& state, const ObjectPropertyName& P, const ObjectPropertyDescriptor& desc) ESCARGOT_OBJECT_SUBCLASS_MUST_REDEFINE
+{
+    if (UNLIKELY(!state.context()->vmInstance()->didSomeIteratorObjectChangeNextMethod() && isNextPropertyName(state, P))) {
+        state.context()->vmInstance()->someIteratorObjectChangeNextMethod();
+    }
+    return Object::defineOwnProperty(state, P, desc);
+}
+
+bool IteratorObject::deleteOwnProperty(ExecutionState& state, const ObjectPropertyName& P) ESCARGOT_OBJECT_SUBCLASS_MUST_REDEFINE
+{
+    if (UNLIKELY(!state.context()->vmInstance()->didSomeIteratorObjectChangeNextMethod() && isNextPropertyName(state, P))) {
+        state.context()->vmInstance()->someIteratorObjectChangeNextMethod();
+    }
+    return Object::deleteOwnProperty(state, P);
+}
+
+bool IteratorObject::setPrototype(ExecutionState& state, const Value& proto)
+{
+    state.context()->vmInstance()->someIteratorObjectChangeNextMethod();
+    return Object::setPrototype(state, proto);
+}
+
 Value IteratorObject::next(ExecutionState& state)
 {
     auto result = advance(state);
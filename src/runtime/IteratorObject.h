@@ -94,6 +94,18 @@ public:
         RELEASE_ASSERT_NOT_REACHED();
     }
 
+    // these report to VMInstance when next method seen by some iterator object can be changed
+    // built-in iterator prototypes define their next method with Object::defineOwnProperty directly
+    virtual bool defineOwnProperty(ExecutionState& state, const ObjectPropertyName& P, const ObjectPropertyDescriptor& desc) ESCARGOT_OBJECT_SUBCLASS_MUST_REDEFINE override;
+    virtual bool deleteOwnProperty(ExecutionState& state, const ObjectPropertyName& P) ESCARGOT_OBJECT_SUBCLASS_MUST_REDEFINE override;
+    virtual bool setPrototype(ExecutionState& state, const Value& proto) override;
+
+    // writing to prototype object with inline cache does not pass through defineOwnProperty
+    virtual bool isInlineCacheable() override
+    {
+        return !isEverSetAsPrototypeObject();
+    }
+
 protected:
 };
 }
@@ -24,6 +24,7 @@
 #include "runtime/Object.h"
 #include "runtime/FunctionObject.h"
 #include "runtime/ErrorObject.h"
+#include "runtime/IteratorObject.h"
 
 namespace Escargot {
 
@@ -90,6 +91,29 @@ Value iteratorStep(ExecutionState& state, const Value& iterator)
     return done ? Value(Value::False) : result;
 }
 
+bool iteratorStepValue(ExecutionState& state, const Value& iterator, Value& value)
+{
+    if (LIKELY(iterator.isObject() && iterator.asObject()->isIteratorObject())) {
+        // while no iterator object has changed its next method, next method of built-in iterator is the original one
+        // then calling next is observably same with advancing iterator directly
+        if (LIKELY(!state.context()->vmInstance()->didSomeIteratorObjectChangeNextMethod())) {
+            auto result = iterator.asObject()->asIteratorObject()->advance(state);
+            if (result.second) {
+                return false;
+            }
+            value = result.first;
+            return true;
+        }
+    }
+
+    Value next = iteratorStep(state, iterator);
+    if (next.isFalse()) {
+        return false;
+    }
+    value = iteratorValue(state, next);
+    return true;
+}
+
 // https://www.ecma-international.org/ecma-262/6.0/#sec-iteratorclose
 void iteratorClose(ExecutionState& state, const Value& iterator)
 {
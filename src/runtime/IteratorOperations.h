@@ -31,6 +31,9 @@ Value iteratorNext(ExecutionState& state, const Value& iterator, const Value& va
 bool iteratorComplete(ExecutionState& state, const Value& iterResult);
 Value iteratorValue(ExecutionState& state, const Value& iterResult);
 Value iteratorStep(ExecutionState& state, const Value& iterator);
+// IteratorStep followed by IteratorValue. returns false when iterator is done
+// built-in iterators are advanced directly while no iterator object has changed its next method, without allocating result objects
+bool iteratorStepValue(ExecutionState& state, const Value& iterator, Value& value);
 void iteratorClose(ExecutionState& state, const Value& iterator);
 Value createIterResultObject(ExecutionState& state, const Value& value, bool done);
 }
@@ -32,31 +32,40 @@ SandBox::SandBoxResult PromiseReactionJob::run()
     SandBox sandbox(relatedContext());
     ExecutionState state(relatedContext());
     return sandbox.run([&]() -> Value {
-        /* 25.4.2.1.4 Handler is "Identity" case */
-        if (m_reaction.m_handler == (FunctionObject*)1) {
-            Value value[] = { m_argument };
-            return FunctionObject::call(state, m_reaction.m_capability.m_resolveFunction, Value(), 1, value);
-        }
+        return runReaction(state, m_reaction, m_argument);
+    });
+}
 
-        /* 25.4.2.1.5 Handler is "Thrower" case */
-        if (m_reaction.m_handler == (FunctionObject*)2) {
-            Value value[] = { m_argument };
-            return FunctionObject::call(state, m_reaction.m_capability.m_rejectFunction, Value(), 1, value);
-        }
+Value PromiseReactionJob::runReaction(ExecutionState& state, const PromiseReaction& reaction, const Value& argument)
+{
+    /* 25.4.2.1.4 Handler is "Identity" case */
+    if (reaction.m_handler == (FunctionObject*)1) {
+        Value value[] = { argument };
+        return FunctionObject::call(state, reaction.m_capability.m_resolveFunction, Value(), 1, value);
+    }
 
-        SandBox sb(state.context());
-        auto res = sb.run([&]() -> Value {
-            Value arguments[] = { m_argument };
-            Value res = FunctionObject::call(state, m_reaction.m_handler, Value(), 1, arguments);
-            Value value[] = { res };
-            return FunctionObject::call(state, m_reaction.m_capability.m_resolveFunction, Value(), 1, value);
-        });
-        if (!res.error.isEmpty()) {
-            Value reason[] = { res.error };
-            return FunctionObject::call(state, m_reaction.m_capability.m_rejectFunction, Value(), 1, reason);
-        }
-        return res.result;
-    });
+    /* 25.4.2.1.5 Handler is "Thrower" case */
+    if (reaction.m_handler == (FunctionObject*)2) {
+        Value value[] = { argument };
+        return FunctionObject::call(state, reaction.m_capability.m_rejectFunction, Value(), 1, value);
+    }
+
+    Value handlerResult;
+    try {
+        Value arguments[] = { argument };
+        handlerResult = FunctionObject::call(state, reaction.m_handler, Value(), 1, arguments);
+    } catch (const Value& error) {
+        // handler exception is caught here like a catch block does, so SandBox of caller keeps running next reactions
+        SandBox* sb = state.context()->m_sandBoxStack.back();
+        sb->fillStackDataIntoErrorObject(error);
+        sb->clearStackTraceFrames();
+
+        Value reason[] = { error };
+        return FunctionObject::call(state, reaction.m_capability.m_rejectFunction, Value(), 1, reason);
+    }
+
+    Value value[] = { handlerResult };
+    return FunctionObject::call(state, reaction.m_capability.m_resolveFunction, Value(), 1, value);
 }
 
 SandBox::SandBoxResult PromiseResolveThenableJob::run()
@@ -77,6 +77,8 @@ public:
     }
 
     SandBox::SandBoxResult run();
+    // runs reaction in SandBox of caller
+    static Value runReaction(ExecutionState& state, const PromiseReaction& reaction, const Value& argument);
 
 private:
     PromiseReaction m_reaction;
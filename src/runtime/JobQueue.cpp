@@ -33,15 +33,128 @@ JobQueue* JobQueue::create()
     return DefaultJobQueue::create();
 }
 
+size_t JobQueue::enqueuePromiseReactionJob(ExecutionState& state, const PromiseReaction& reaction, const Value& argument)
+{
+    return enqueueJob(state, new PromiseReactionJob(state.context(), reaction, argument));
+}
+
 size_t DefaultJobQueue::enqueueJob(ExecutionState& state, Job* job)
 {
     if (state.context()->vmInstance()->m_jobQueueListener) {
         state.context()->vmInstance()->m_jobQueueListener(state, job);
     } else {
-        m_jobs.push_back(job);
+        QueuedJob queuedJob;
+        queuedJob.m_job = job;
+        queuedJob.m_relatedContext = job->relatedContext();
+        push(queuedJob);
     }
     return 0;
 }
+
+size_t DefaultJobQueue::enqueuePromiseReactionJob(ExecutionState& state, const PromiseReaction& reaction, const Value& argument)
+{
+    if (state.context()->vmInstance()->m_jobQueueListener) {
+        return JobQueue::enqueuePromiseReactionJob(state, reaction, argument);
+    }
+
+    QueuedJob queuedJob;
+    queuedJob.m_relatedContext = state.context();
+    queuedJob.m_reaction = reaction;
+    queuedJob.m_argument = argument;
+    push(queuedJob);
+    return 0;
+}
+
+void DefaultJobQueue::push(const QueuedJob& job)
+{
+    if (UNLIKELY(m_size == m_capacity)) {
+        size_t newCapacity = m_capacity ? m_capacity * 2 : JOB_QUEUE_INITIAL_CAPACITY;
+        ASSERT((newCapacity & (newCapacity - 1)) == 0);
+        QueuedJob* newBuffer = (QueuedJob*)GC_MALLOC(sizeof(QueuedJob) * newCapacity);
+        for (size_t i = 0; i < m_size; i++) {
+            newBuffer[i] = m_buffer[(m_head + i) & (m_capacity - 1)];
+        }
+        if (m_buffer) {
+            GC_FREE(m_buffer);
+        }
+        m_buffer = newBuffer;
+        m_capacity = newCapacity;
+        m_head = 0;
+    }
+
+    m_buffer[(m_head + m_size) & (m_capacity - 1)] = job;
+    m_size++;
+}
+
+DefaultJobQueue::QueuedJob DefaultJobQueue::pop()
+{
+    QueuedJob job = front();
+    // clear slot, so finished job is not kept alive by buffer
+    m_buffer[m_head] = QueuedJob();
+    m_head = (m_head + 1) & (m_capacity - 1);
+    m_size--;
+    return job;
+}
+
+SandBox::SandBoxResult DefaultJobQueue::runNextJob()
+{
+    QueuedJob job = pop();
+    if (job.m_job) {
+        return job.m_job->run();
+    }
+
+    SandBox sandbox(job.m_relatedContext);
+    ExecutionState state(job.m_relatedContext);
+    return sandbox.run([&]() -> Value {
+        return PromiseReactionJob::runReaction(state, job.m_reaction, job.m_argument);
+    });
+}
+
+SandBox::SandBoxResult DefaultJobQueue::drainJobs()
+{
+    while (hasNextJob()) {
+        if (front().m_job) {
+            auto result = runNextJob();
+            if (!result.error.isEmpty() || !hasNextJob()) {
+                return result;
+            }
+            continue;
+        }
+
+        // sandbox is set up once for consecutive reactions, and again only after a reaction throws
+        Context* relatedContext = front().m_relatedContext;
+        SandBox sandbox(relatedContext);
+        ExecutionState state(relatedContext);
+        auto result = sandbox.run([&]() -> Value {
+            Value lastResult;
+            do {
+                QueuedJob job = pop();
+                lastResult = PromiseReactionJob::runReaction(state, job.m_reaction, job.m_argument);
+            } while (hasNextJob() && !front().m_job && front().m_relatedContext == relatedContext);
+            return lastResult;
+        });
+        if (!result.error.isEmpty() || !hasNextJob()) {
+            return result;
+        }
+    }
+    return SandBox::SandBoxResult();
+}
+
+void DefaultJobQueue::removeJobsRelatedWith(Context* context)
+{
+    size_t newSize = 0;
+    for (size_t i = 0; i < m_size; i++) {
+        QueuedJob& job = m_buffer[(m_head + i) & (m_capacity - 1)];
+        if (job.m_relatedContext != context) {
+            m_buffer[(m_head + newSize) & (m_capacity - 1)] = job;
+            newSize++;
+        }
+    }
+    for (size_t i = newSize; i < m_size; i++) {
+        m_buffer[(m_head + i) & (m_capacity - 1)] = QueuedJob();
+    }
+    m_size = newSize;
+}
 }
 
 #endif
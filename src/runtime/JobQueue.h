@@ -28,6 +28,10 @@ namespace Escargot {
 
 class ExecutionState;
 
+#ifndef JOB_QUEUE_INITIAL_CAPACITY
+#define JOB_QUEUE_INITIAL_CAPACITY 64
+#endif
+
 class JobQueue : public gc {
 protected:
     JobQueue() {}
@@ -35,11 +39,22 @@ public:
     virtual ~JobQueue() {}
     static JobQueue* create();
     virtual size_t enqueueJob(ExecutionState& state, Job* job) = 0;
+    virtual size_t enqueuePromiseReactionJob(ExecutionState& state, const PromiseReaction& reaction, const Value& argument);
 };
 
+// jobs are stored into ring buffer
+// promise reactions are stored as records in ring buffer without allocating Job objects,
+// except when new job listener is set, because listener takes Job object
 class DefaultJobQueue : public JobQueue {
 private:
-    DefaultJobQueue() {}
+    DefaultJobQueue()
+        : m_buffer(nullptr)
+        , m_capacity(0)
+        , m_head(0)
+        , m_size(0)
+    {
+    }
+
 public:
     static DefaultJobQueue* create()
     {
@@ -47,23 +62,20 @@ public:
     }
 
     size_t enqueueJob(ExecutionState& state, Job* job);
+    size_t enqueuePromiseReactionJob(ExecutionState& state, const PromiseReaction& reaction, const Value& argument);
+
     bool hasNextJob()
     {
-        return !m_jobs.empty();
+        return m_size;
     }
 
-    Job* nextJob()
-    {
-        ASSERT(!m_jobs.empty());
-        Job* job = m_jobs.front();
-        m_jobs.pop_front();
-        return job;
-    }
+    // runs next job in its own SandBox
+    SandBox::SandBoxResult runNextJob();
+    // runs jobs until queue is empty or a job throws. returns result of last job
+    // consecutive promise reactions of same context run under one SandBox
+    SandBox::SandBoxResult drainJobs();
 
-    std::list<Job*, gc_allocator<Job*>>& impl()
-    {
-        return m_jobs;
-    }
+    void removeJobsRelatedWith(Context* context);
 
     static DefaultJobQueue* get(JobQueue* jobQueue)
     {
@@ -71,7 +83,34 @@ public:
     }
 
 private:
-    std::list<Job*, gc_allocator<Job*>> m_jobs;
+    struct QueuedJob {
+        QueuedJob()
+            : m_job(nullptr)
+            , m_relatedContext(nullptr)
+        {
+        }
+
+        // nullptr for promise reaction record
+        Job* m_job;
+        Context* m_relatedContext;
+        PromiseReaction m_reaction;
+        Value m_argument;
+    };
+
+    QueuedJob& front()
+    {
+        ASSERT(m_size);
+        return m_buffer[m_head];
+    }
+
+    void push(const QueuedJob& job);
+    QueuedJob pop();
+
+    // capacity is power of 2
+    QueuedJob* m_buffer;
+    size_t m_capacity;
+    size_t m_head;
+    size_t m_size;
 };
 }
 #endif // ESCARGOT_ENABLE_PROMISE
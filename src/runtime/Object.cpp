@@ -55,7 +55,7 @@ PropertyName::PropertyName(ExecutionState& state, const Value& valueIn)
         if (c < ESCARGOT_ASCII_TABLE_MAX && (data.length == 1)) {
             m_data = ((size_t)state.context()->staticStrings().asciiTable[c].string()) | PROPERTY_NAME_ATOMIC_STRING_VIAS;
         } else {
-            m_data = ((size_t)AtomicString(state, string).string()) | PROPERTY_NAME_ATOMIC_STRING_VIAS;
+            m_data = ((size_t)AtomicString::fromPropertyKey(state, string).string()) | PROPERTY_NAME_ATOMIC_STRING_VIAS;
         }
     }
 }
@@ -911,25 +911,38 @@ bool Object::nextIndexForward(ExecutionState& state, Object* obj, const double c
     data.cur = &cur;
     data.ret = &ret;
 
+    auto callback = [](ExecutionState& state, Object* self, const ObjectPropertyName& name, const ObjectStructurePropertyDescriptor& desc, void* data) -> bool {
+        uint64_t index;
+        Data* e = (Data*)data;
+        double* ret = e->ret;
+        Value key = name.toPlainValue(state);
+        if ((index = key.toArrayIndex(state)) != Value::InvalidArrayIndexValue) {
+            if (*e->skipUndefined && self->get(state, name).value(state, self).isUndefined()) {
+                return true;
+            }
+            if (index > *e->cur && *ret > index) {
+                *ret = std::min(static_cast<double>(index), *ret);
+                *e->exists = true;
+            }
+        }
+        return true;
+    };
+
     while (ptr.isObject()) {
-        ptr.asObject()->enumeration(state, [](ExecutionState& state, Object* self, const ObjectPropertyName& name, const ObjectStructurePropertyDescriptor& desc, void* data) {
-            uint64_t index;
-            Data* e = (Data*)data;
-            double* ret = e->ret;
-            Value key = name.toPlainValue(state);
-            if ((index = key.toArrayIndex(state)) != Value::InvalidArrayIndexValue) {
-                if (*e->skipUndefined && self->get(state, name).value(state, self).isUndefined()) {
-                    return true;
-                }
-                if (index > *e->cur && *ret > index) {
-                    *ret = std::min(static_cast<double>(index), *ret);
-                    *e->exists = true;
-                }
+        Object* o = ptr.asObject();
+        if (o->isArrayObject() && o->asArrayObject()->m_sparseData != nullptr) {
+            ArrayObject* arr = o->asArrayObject();
+            double index;
+            if (arr->nextSparseIndexForward(cur, ret, skipUndefined, index)) {
+                ret = index;
+                exists = true;
             }
-            return true;
-        },
-                                    &data);
-        ptr = ptr.asObject()->getPrototype(state);
+            // elements in sparse element store are already searched. search ObjectStructure only
+            arr->Object::enumeration(state, callback, &data);
+        } else {
+            o->enumeration(state, callback, &data);
+        }
+        ptr = o->getPrototype(state);
     }
     nextIndex = ret;
     return exists;
@@ -951,25 +964,38 @@ bool Object::nextIndexBackward(ExecutionState& state, Object* obj, const double
     data.cur = &cur;
     data.ret = &ret;
 
+    auto callback = [](ExecutionState& state, Object* self, const ObjectPropertyName& name, const ObjectStructurePropertyDescriptor& desc, void* data) -> bool {
+        uint64_t index;
+        Data* e = (Data*)data;
+        double* ret = e->ret;
+        Value key = name.toPlainValue(state);
+        if ((index = key.toArrayIndex(state)) != Value::InvalidArrayIndexValue) {
+            if (*e->skipUndefined && self->get(state, name).value(state, self).isUndefined()) {
+                return true;
+            }
+            if (index < *e->cur) {
+                *ret = std::max(static_cast<double>(index), *ret);
+                *e->exists = true;
+            }
+        }
+        return true;
+    };
+
     while (ptr.isObject()) {
-        ptr.asObject()->enumeration(state, [](ExecutionState& state, Object* self, const ObjectPropertyName& name, const ObjectStructurePropertyDescriptor& desc, void* data) {
-            uint64_t index;
-            Data* e = (Data*)data;
-            double* ret = e->ret;
-            Value key = name.toPlainValue(state);
-            if ((index = key.toArrayIndex(state)) != Value::InvalidArrayIndexValue) {
-                if (*e->skipUndefined && self->get(state, name).value(state, self).isUndefined()) {
-                    return true;
-                }
-                if (index < *e->cur) {
-                    *ret = std::max(static_cast<double>(index), *ret);
-                    *e->exists = true;
-                }
+        Object* o = ptr.asObject();
+        if (o->isArrayObject() && o->asArrayObject()->m_sparseData != nullptr) {
+            ArrayObject* arr = o->asArrayObject();
+            double index;
+            if (arr->nextSparseIndexBackward(cur, ret, skipUndefined, index)) {
+                ret = index;
+                exists = true;
             }
-            return true;
-        },
-                                    &data);
-        ptr = ptr.asObject()->getPrototype(state);
+            // elements in sparse element store are already searched. search ObjectStructure only
+            arr->Object::enumeration(state, callback, &data);
+        } else {
+            o->enumeration(state, callback, &data);
+        }
+        ptr = o->getPrototype(state);
     }
     nextIndex = ret;
     return exists;
@@ -521,6 +521,7 @@ class Object : public PointerValue {
     friend class VMInstance;
     friend class GlobalObject;
     friend class ByteCodeInterpreter;
+    friend class PropertyHandle;
     friend struct ObjectRareData;
     static Object* createBuiltinObjectPrototype(ExecutionState& state);
 
@@ -27,7 +27,6 @@ class Symbol;
 class Object;
 class FunctionObject;
 class ArrayObject;
-class SpreadObject;
 class StringObject;
 class SymbolObject;
 class NumberObject;
@@ -94,11 +93,6 @@ public:
         return false;
     }
 
-    virtual bool isSpreadObject() const
-    {
-        return false;
-    }
-
     virtual bool isStringObject() const
     {
         return false;
@@ -249,12 +243,6 @@ public:
         return (ArrayObject*)this;
     }
 
-    SpreadObject* asSpreadObject()
-    {
-        ASSERT(isSpreadObject());
-        return (SpreadObject*)this;
-    }
-
     FunctionObject* asFunctionObject()
     {
         ASSERT(isFunctionObject());
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2019-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#include "Escargot.h"
+#include "PropertyHandle.h"
+#include "ObjectStructure.h"
+
+namespace Escargot {
+
+size_t PropertyHandle::findAndCacheOwnProperty(ExecutionState& state, Object* obj)
+{
+    if (UNLIKELY(!obj->isInlineCacheable())) {
+        return SIZE_MAX;
+    }
+
+    // structure with fast access can be changed in place
+    ObjectStructure* structure = obj->structure();
+    if (UNLIKELY(structure->isStructureWithFastAccess())) {
+        return SIZE_MAX;
+    }
+
+    size_t idx = structure->findProperty(state, m_name);
+    if (idx == SIZE_MAX) {
+        return SIZE_MAX;
+    }
+
+    // newest structure is placed first. oldest one is dropped when cache is full
+    size_t count = std::min(m_cacheCount + 1, (size_t)PROPERTY_HANDLE_CACHE_SIZE);
+    for (size_t i = count - 1; i > 0; i--) {
+        m_cache[i] = m_cache[i - 1];
+    }
+    m_cache[0].m_structure = structure;
+    m_cache[0].m_index = idx;
+    m_cacheCount = count;
+
+    return idx;
+}
+
+Value PropertyHandle::getCacheMiss(ExecutionState& state, Object* obj)
+{
+    size_t idx = findAndCacheOwnProperty(state, obj);
+    if (idx != SIZE_MAX) {
+        return obj->getOwnPropertyUtilForObject(state, idx, obj);
+    }
+
+    auto result = obj->get(state, ObjectPropertyName(state, m_name));
+    if (result.hasValue()) {
+        return result.value(state, obj);
+    }
+    return Value();
+}
+
+bool PropertyHandle::setCacheMiss(ExecutionState& state, Object* obj, const Value& value)
+{
+    size_t idx = findAndCacheOwnProperty(state, obj);
+    if (idx != SIZE_MAX) {
+        return obj->setOwnPropertyUtilForObject(state, idx, value, obj);
+    }
+
+    return obj->set(state, ObjectPropertyName(state, m_name), value, obj);
+}
+}
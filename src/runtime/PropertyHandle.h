@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2019-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#ifndef __EscargotPropertyHandle__
+#define __EscargotPropertyHandle__
+
+#include "runtime/Object.h"
+#include "runtime/PropertyName.h"
+
+namespace Escargot {
+
+class ObjectStructure;
+
+#ifndef PROPERTY_HANDLE_CACHE_SIZE
+#define PROPERTY_HANDLE_CACHE_SIZE 4
+#endif
+
+// interned property name with structure cache for host code
+// which accesses same property of many objects
+// cache stores own property index per structure(up to PROPERTY_HANDLE_CACHE_SIZE structures)
+class PropertyHandle : public gc {
+public:
+    explicit PropertyHandle(const PropertyName& name)
+        : m_name(name)
+        , m_cacheCount(0)
+    {
+    }
+
+    const PropertyName& name() const
+    {
+        return m_name;
+    }
+
+    ALWAYS_INLINE Value get(ExecutionState& state, Object* obj)
+    {
+        ObjectStructure* structure = obj->structure();
+        for (size_t i = 0; i < m_cacheCount; i++) {
+            if (m_cache[i].m_structure == structure) {
+                return obj->getOwnPropertyUtilForObject(state, m_cache[i].m_index, obj);
+            }
+        }
+        return getCacheMiss(state, obj);
+    }
+
+    ALWAYS_INLINE bool set(ExecutionState& state, Object* obj, const Value& value)
+    {
+        ObjectStructure* structure = obj->structure();
+        for (size_t i = 0; i < m_cacheCount; i++) {
+            if (m_cache[i].m_structure == structure) {
+                return obj->setOwnPropertyUtilForObject(state, m_cache[i].m_index, value, obj);
+            }
+        }
+        return setCacheMiss(state, obj, value);
+    }
+
+private:
+    NEVER_INLINE Value getCacheMiss(ExecutionState& state, Object* obj);
+    NEVER_INLINE bool setCacheMiss(ExecutionState& state, Object* obj, const Value& value);
+    size_t findAndCacheOwnProperty(ExecutionState& state, Object* obj);
+
+    struct CacheItem {
+        ObjectStructure* m_structure;
+        size_t m_index;
+    };
+
+    PropertyName m_name;
+    size_t m_cacheCount;
+    // handle is allocated as gc object. cached structures are kept alive by this array
+    CacheItem m_cache[PROPERTY_HANDLE_CACHE_SIZE];
+};
+}
+
+#endif
@@ -31,8 +31,10 @@ RegExpObject::RegExpObject(ExecutionState& state, String* source, String* option
     , m_source(NULL)
     , m_optionString(NULL)
     , m_option(None)
+    , m_isLiteralPattern(false)
     , m_yarrPattern(NULL)
     , m_bytecodePattern(NULL)
+    , m_prefilter(NULL)
     , m_lastIndex(Value(0))
     , m_lastExecutedString(NULL)
 {
@@ -45,8 +47,10 @@ RegExpObject::RegExpObject(ExecutionState& state, String* source, unsigned int o
     , m_source(NULL)
     , m_optionString(NULL)
     , m_option(None)
+    , m_isLiteralPattern(false)
     , m_yarrPattern(NULL)
     , m_bytecodePattern(NULL)
+    , m_prefilter(NULL)
     , m_lastIndex(Value(0))
     , m_lastExecutedString(NULL)
 {
@@ -54,13 +58,30 @@ RegExpObject::RegExpObject(ExecutionState& state, String* source, unsigned int o
     initWithOption(state, source, (Option)option);
 }
 
+RegExpObject::RegExpObject(ExecutionState& state, RegExpLiteralCache* literalCache)
+    : Object(state, ESCARGOT_OBJECT_BUILTIN_PROPERTY_NUMBER + 5, true)
+    , m_source(literalCache->m_source)
+    , m_optionString(literalCache->m_optionString)
+    , m_option(literalCache->m_option)
+    , m_isLiteralPattern(literalCache->m_isLiteralPattern)
+    , m_yarrPattern(literalCache->m_yarrPattern)
+    , m_bytecodePattern(literalCache->m_bytecodePattern)
+    , m_prefilter(literalCache->m_prefilter)
+    , m_lastIndex(Value(0))
+    , m_lastExecutedString(NULL)
+{
+    initRegExpObject(state);
+}
+
 RegExpObject::RegExpObject(ExecutionState& state)
     : Object(state, ESCARGOT_OBJECT_BUILTIN_PROPERTY_NUMBER + 5, true)
     , m_source(NULL)
     , m_optionString(NULL)
     , m_option(None)
+    , m_isLiteralPattern(false)
     , m_yarrPattern(NULL)
     , m_bytecodePattern(NULL)
+    , m_prefilter(NULL)
     , m_lastIndex(Value(0))
     , m_lastExecutedString(NULL)
 {
@@ -89,6 +110,7 @@ void* RegExpObject::operator new(size_t size)
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(RegExpObject, m_optionString));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(RegExpObject, m_yarrPattern));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(RegExpObject, m_bytecodePattern));
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(RegExpObject, m_prefilter));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(RegExpObject, m_lastIndex));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(RegExpObject, m_lastExecutedString));
         descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(RegExpObject));
@@ -169,6 +191,8 @@ void RegExpObject::internalInit(ExecutionState& state, String* source)
 
     m_yarrPattern = entry.m_yarrPattern;
     m_bytecodePattern = entry.m_bytecodePattern;
+    m_isLiteralPattern = entry.m_isLiteralPattern;
+    m_prefilter = entry.m_prefilter;
 }
 
 void RegExpObject::init(ExecutionState& state, String* source, String* option)
@@ -183,6 +207,22 @@ void RegExpObject::initWithOption(ExecutionState& state, String* source, Option
     this->internalInit(state, source);
 }
 
+RegExpLiteralCache* RegExpObject::createLiteralCache(ExecutionState& state)
+{
+    // bytecode is compiled here, so objects created from the cache never visit the cache map
+    compileBytecodePatternIfNeeded(state);
+
+    RegExpLiteralCache* literalCache = new RegExpLiteralCache();
+    literalCache->m_source = m_source;
+    literalCache->m_optionString = m_optionString;
+    literalCache->m_option = m_option;
+    literalCache->m_isLiteralPattern = m_isLiteralPattern;
+    literalCache->m_yarrPattern = m_yarrPattern;
+    literalCache->m_bytecodePattern = m_bytecodePattern;
+    literalCache->m_prefilter = m_prefilter;
+    return literalCache;
+}
+
 void RegExpObject::setLastIndex(ExecutionState& state, const Value& v)
 {
     if (UNLIKELY(rareData() && rareData()->m_hasNonWritableLastIndexRegexpObject && (m_option & (Option::Sticky | Option::Global)))) {
@@ -261,17 +301,352 @@ void RegExpObject::setOption(const Option& option)
     m_option = option;
 }
 
-RegExpObject::RegExpCacheEntry& RegExpObject::getCacheEntryAndCompileIfNeeded(ExecutionState& state, String* source, const Option& option)
+// patterns without any syntax character are matched by String::find instead of the yarr interpreter
+// yarr of this tree has no JIT, so this is the only path which does not interpret a pattern.
+// RegExpPrefilter is used for the other patterns, and only skips to candidates of the interpreter
+// ignoreCase changes meaning of every character, and surrogates need care with unicode flag
+static bool isLiteralPattern(String* source, const RegExpObject::Option& option)
 {
-    auto cache = state.context()->regexpCache();
-    auto it = cache->find(RegExpCacheKey(source, option));
-    if (it != cache->end()) {
-        return it->second;
+    if (option & RegExpObject::Option::IgnoreCase) {
+        return false;
+    }
+
+    size_t length = source->length();
+    for (size_t i = 0; i < length; i++) {
+        char16_t c = source->charAt(i);
+        if (c < 128) {
+            if (strchr("\\^$.|?*+()[]{}", c)) {
+                return false;
+            }
+        } else if (c >= 0xD800 && c <= 0xDFFF) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static String* stringFromUTF16(const UTF16StringDataNonGCStd& str)
+{
+    for (size_t i = 0; i < str.length(); i++) {
+        if (str[i] >= 256) {
+            return new UTF16String(str.data(), str.length());
+        }
+    }
+    return new Latin1String(str.data(), str.length());
+}
+
+// returns end of the class or group which starts at start, SIZE_MAX if it is not closed
+static size_t skipClassOrGroup(String* source, size_t start)
+{
+    size_t length = source->length();
+    size_t depth = 0;
+    bool inClass = false;
+    for (size_t i = start; i < length; i++) {
+        char16_t c = source->charAt(i);
+        if (c == '\\') {
+            i++;
+        } else if (inClass) {
+            if (c == ']') {
+                inClass = false;
+                if (!depth) {
+                    return i + 1;
+                }
+            }
+        } else if (c == '[') {
+            inClass = true;
+        } else if (c == '(') {
+            depth++;
+        } else if (c == ')') {
+            if (--depth == 0) {
+                return i + 1;
+            }
+        }
+    }
+    return SIZE_MAX;
+}
+
+// parses quantifier at start. returns false if there is no quantifier
+// isOptional is set when quantified atom can be matched zero times
+static bool parseQuantifier(String* source, size_t start, size_t& end, bool& isOptional)
+{
+    size_t length = source->length();
+    if (start >= length) {
+        return false;
+    }
+
+    char16_t c = source->charAt(start);
+    if (c == '*' || c == '?' || c == '+') {
+        isOptional = c != '+';
+        end = start + 1;
+    } else if (c == '{') {
+        size_t i = start + 1;
+        size_t min = 0;
+        bool hasDigit = false;
+        while (i < length && source->charAt(i) >= '0' && source->charAt(i) <= '9') {
+            min = min * 10 + (source->charAt(i) - '0');
+            hasDigit = true;
+            i++;
+        }
+        while (i < length && (source->charAt(i) == ',' || (source->charAt(i) >= '0' && source->charAt(i) <= '9'))) {
+            i++;
+        }
+        if (!hasDigit || i >= length || source->charAt(i) != '}') {
+            // not a quantifier. annex B allows braces as literal
+            return false;
+        }
+        isOptional = !min;
+        end = i + 1;
+    } else {
+        return false;
+    }
+
+    // lazy quantifier
+    if (end < length && source->charAt(end) == '?') {
+        end++;
+    }
+    return true;
+}
+
+bool RegExpPrefilter::parseFirstCharacterClass(String* source, size_t start, size_t end)
+{
+    // [ ... ]
+    ASSERT(source->charAt(start) == '[' && source->charAt(end - 1) == ']');
+    if (start + 1 >= end - 1 || source->charAt(start + 1) == '^') {
+        return false;
+    }
+
+    for (size_t i = start + 1; i < end - 1; i++) {
+        char16_t c = source->charAt(i);
+        if (c == '\\') {
+            char16_t e = source->charAt(++i);
+            if (e == 'd') {
+                for (char16_t d = '0'; d <= '9'; d++) {
+                    addFirstCharacter(d);
+                }
+                continue;
+            } else if (e < 128 && !isalnum(e)) {
+                c = e;
+            } else {
+                return false;
+            }
+        }
+        if (c >= 256) {
+            return false;
+        }
+
+        if (i + 2 < end - 1 && source->charAt(i + 1) == '-') {
+            char16_t to = source->charAt(i + 2);
+            if (to == '\\' || to >= 256 || to < c) {
+                return false;
+            }
+            for (char16_t r = c; r <= to; r++) {
+                addFirstCharacter(r);
+            }
+            i += 2;
+        } else {
+            addFirstCharacter(c);
+        }
+    }
+    m_hasFirstCharacterSet = true;
+    return true;
+}
+
+RegExpPrefilter* RegExpPrefilter::create(String* source, unsigned option)
+{
+    if (option & RegExpObject::Option::IgnoreCase) {
+        return nullptr;
+    }
+
+    size_t length = source->length();
+    // prefilter is used only when every alternative is in one sequence
+    for (size_t i = 0; i < length; i++) {
+        char16_t c = source->charAt(i);
+        if (c == '\\') {
+            i++;
+        } else if (c == '[' || c == '(') {
+            i = skipClassOrGroup(source, i);
+            if (i == SIZE_MAX) {
+                return nullptr;
+            }
+            i--;
+        } else if (c == '|') {
+            return nullptr;
+        } else if (c >= 0xD800 && c <= 0xDFFF) {
+            // quantifiers apply to a whole surrogate pair with unicode flag
+            return nullptr;
+        }
+    }
+
+    RegExpPrefilter* prefilter = new RegExpPrefilter();
+    UTF16StringDataNonGCStd prefix, run, longestRun;
+    bool isPrefixOpen = true;
+    size_t i = 0;
+    while (i < length) {
+        char16_t c = source->charAt(i);
+        bool isLiteral = false;
+        size_t atomEnd = i + 1;
+        if (c == '\\') {
+            if (i + 1 >= length) {
+                break;
+            }
+            char16_t e = source->charAt(i + 1);
+            if (e < 128 && !isalnum(e)) {
+                isLiteral = true;
+                c = e;
+            } else if (e == 'u' || e == 'x' || e == 'c' || e == 'k' || (e >= '0' && e <= '9')) {
+                // escapes with variable length. stop here
+                break;
+            } else if (i == 0 && e == 'd') {
+                for (char16_t d = '0'; d <= '9'; d++) {
+                    prefilter->addFirstCharacter(d);
+                }
+                prefilter->m_hasFirstCharacterSet = true;
+            }
+            atomEnd = i + 2;
+        } else if (c == '[' || c == '(') {
+            atomEnd = skipClassOrGroup(source, i);
+            if (i == 0 && c == '[' && !prefilter->parseFirstCharacterClass(source, i, atomEnd)) {
+                memset(prefilter->m_firstCharacterSet, 0, sizeof(prefilter->m_firstCharacterSet));
+            }
+        } else if (c == ')' || c == ']' || c == '}' || c == '{' || c == '*' || c == '+' || c == '?') {
+            // annex B literals. stop here
+            break;
+        } else if (c != '^' && c != '$' && c != '.') {
+            isLiteral = true;
+        }
+
+        size_t quantifierEnd;
+        bool isOptional = false;
+        bool isQuantified = parseQuantifier(source, atomEnd, quantifierEnd, isOptional);
+        if (isOptional && i == 0) {
+            prefilter->m_hasFirstCharacterSet = false;
+        }
+
+        if (isLiteral && !isOptional) {
+            run += c;
+            if (isPrefixOpen) {
+                prefix += c;
+            }
+        }
+        if (!isLiteral || isQuantified) {
+            if (run.length() > longestRun.length()) {
+                longestRun = run;
+            }
+            run.clear();
+            isPrefixOpen = false;
+        }
+        i = isQuantified ? quantifierEnd : atomEnd;
+    }
+    if (run.length() > longestRun.length()) {
+        longestRun = run;
+    }
+
+    if (prefix.length()) {
+        prefilter->m_prefix = stringFromUTF16(prefix);
+        prefilter->m_hasFirstCharacterSet = false;
+    }
+    if (longestRun.length() > prefix.length()) {
+        prefilter->m_requiredSubstring = stringFromUTF16(longestRun);
+    }
+
+    if (!prefilter->m_prefix && !prefilter->m_requiredSubstring && !prefilter->m_hasFirstCharacterSet) {
+        return nullptr;
+    }
+    if (prefilter->m_hasFirstCharacterSet) {
+        prefilter->collectScanCharacters();
+    }
+    return prefilter;
+}
+
+void RegExpPrefilter::collectScanCharacters()
+{
+    m_scanCharacterCount = 0;
+    for (char16_t c = 0; c < 256; c++) {
+        if (hasFirstCharacter(c)) {
+            if (m_scanCharacterCount == sizeof(m_scanCharacters)) {
+                m_scanCharacterCount = 0;
+                return;
+            }
+            m_scanCharacters[m_scanCharacterCount++] = c;
+        }
+    }
+}
+
+size_t RegExpPrefilter::findFirstCharacter(String* str, size_t start)
+{
+    const auto& data = str->bufferAccessData();
+    if (data.has8BitContent) {
+        const LChar* buffer = (const LChar*)data.buffer;
+        if (m_scanCharacterCount) {
+            // each scan only looks before the earliest position found so far
+            const void* found = nullptr;
+            size_t end = data.length;
+            for (size_t k = 0; k < m_scanCharacterCount; k++) {
+                const void* position = memchr(buffer + start, m_scanCharacters[k], end - start);
+                if (position) {
+                    found = position;
+                    end = (const LChar*)position - buffer;
+                }
+            }
+            return found ? (const LChar*)found - buffer : SIZE_MAX;
+        }
+        for (size_t i = start; i < data.length; i++) {
+            if (hasFirstCharacter(buffer[i])) {
+                return i;
+            }
+        }
     } else {
-        if (cache->size() > 256) {
-            cache->clear();
+        const char16_t* buffer = (const char16_t*)data.buffer;
+        for (size_t i = start; i < data.length; i++) {
+            if (hasFirstCharacter(buffer[i])) {
+                return i;
+            }
         }
+    }
+    return SIZE_MAX;
+}
+
+RegExpObject::RegExpCacheEntry* RegExpCacheMap::find(const RegExpObject::RegExpCacheKey& key)
+{
+    auto it = m_index.find(key);
+    if (it == m_index.end()) {
+        m_missCount++;
+        return nullptr;
+    }
+
+    m_hitCount++;
+    if (it->second != m_patterns.begin()) {
+        m_patterns.splice(m_patterns.begin(), m_patterns, it->second);
+    }
+    return &it->second->second;
+}
+
+RegExpObject::RegExpCacheEntry& RegExpCacheMap::insert(const RegExpObject::RegExpCacheKey& key, const RegExpObject::RegExpCacheEntry& entry)
+{
+    ASSERT(m_index.find(key) == m_index.end());
+    if (m_index.size() >= REGEXP_CACHE_SIZE_LIMIT) {
+        m_index.erase(m_patterns.back().first);
+        m_patterns.pop_back();
+    }
+
+    m_patterns.push_front(std::make_pair(key, entry));
+    m_index.insert(std::make_pair(key, m_patterns.begin()));
+    return m_patterns.front().second;
+}
+
+void RegExpCacheMap::clear()
+{
+    m_index.clear();
+    m_patterns.clear();
+}
 
+RegExpObject::RegExpCacheEntry& RegExpObject::getCacheEntryAndCompileIfNeeded(ExecutionState& state, String* source, const Option& option)
+{
+    auto cache = state.context()->regexpCache();
+    RegExpCacheEntry* cachedEntry = cache->find(RegExpCacheKey(source, option));
+    if (cachedEntry) {
+        return *cachedEntry;
+    } else {
         const char* yarrError = nullptr;
         JSC::Yarr::YarrPattern* yarrPattern = nullptr;
         try {
@@ -279,10 +654,42 @@ RegExpObject::RegExpCacheEntry& RegExpObject::getCacheEntryAndCompileIfNeeded(Ex
         } catch (const std::bad_alloc& e) {
             ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, "got too complicated RegExp pattern to process");
         }
-        return cache->insert(std::make_pair(RegExpCacheKey(source, option), RegExpCacheEntry(yarrError, yarrPattern))).first->second;
+        RegExpCacheEntry& entry = cache->insert(RegExpCacheKey(source, option), RegExpCacheEntry(yarrError, yarrPattern));
+        if (!yarrError) {
+            entry.m_isLiteralPattern = isLiteralPattern(source, option);
+            if (!entry.m_isLiteralPattern) {
+                entry.m_prefilter = RegExpPrefilter::create(source, option);
+            }
+        }
+        return entry;
     }
 }
 
+bool RegExpObject::compileBytecodePatternIfNeeded(ExecutionState& state)
+{
+    if (m_bytecodePattern) {
+        return true;
+    }
+
+    RegExpCacheEntry& entry = getCacheEntryAndCompileIfNeeded(state, m_source, m_option);
+    if (entry.m_yarrError) {
+        return false;
+    }
+    m_yarrPattern = entry.m_yarrPattern;
+    m_isLiteralPattern = entry.m_isLiteralPattern;
+    m_prefilter = entry.m_prefilter;
+
+    if (entry.m_bytecodePattern) {
+        m_bytecodePattern = entry.m_bytecodePattern;
+    } else {
+        WTF::BumpPointerAllocator* bumpAlloc = state.context()->bumpPointerAllocator();
+        JSC::Yarr::OwnPtr<JSC::Yarr::BytecodePattern> ownedBytecode = JSC::Yarr::byteCompile(*m_yarrPattern, bumpAlloc);
+        m_bytecodePattern = ownedBytecode.leakPtr();
+        entry.m_bytecodePattern = m_bytecodePattern;
+    }
+    return true;
+}
+
 bool RegExpObject::matchNonGlobally(ExecutionState& state, String* str, RegexMatchResult& matchResult, bool testOnly, size_t startIndex)
 {
     Option prevOption = option();
@@ -299,22 +706,9 @@ bool RegExpObject::match(ExecutionState& state, String* str, RegexMatchResult& m
 
     m_lastExecutedString = str;
 
-    if (!m_bytecodePattern) {
-        RegExpCacheEntry& entry = getCacheEntryAndCompileIfNeeded(state, m_source, m_option);
-        if (entry.m_yarrError) {
-            matchResult.m_subPatternNum = 0;
-            return false;
-        }
-        m_yarrPattern = entry.m_yarrPattern;
-
-        if (entry.m_bytecodePattern) {
-            m_bytecodePattern = entry.m_bytecodePattern;
-        } else {
-            WTF::BumpPointerAllocator* bumpAlloc = state.context()->bumpPointerAllocator();
-            JSC::Yarr::OwnPtr<JSC::Yarr::BytecodePattern> ownedBytecode = JSC::Yarr::byteCompile(*m_yarrPattern, bumpAlloc);
-            m_bytecodePattern = ownedBytecode.leakPtr();
-            entry.m_bytecodePattern = m_bytecodePattern;
-        }
+    if (!compileBytecodePatternIfNeeded(state)) {
+        matchResult.m_subPatternNum = 0;
+        return false;
     }
 
     unsigned subPatternNum = m_bytecodePattern->m_body->m_numSubpatterns;
@@ -325,6 +719,13 @@ bool RegExpObject::match(ExecutionState& state, String* str, RegexMatchResult& m
     bool isGlobal = option() & RegExpObject::Option::Global;
     bool gotResult = false;
     bool reachToEnd = false;
+    if (m_prefilter && !m_prefilter->mayMatch(str, start)) {
+        if (option() & (RegExpObject::Option::Global | RegExpObject::Option::Sticky)) {
+            setLastIndex(state, Value(0));
+        }
+        return false;
+    }
+
     unsigned* outputBuf = ALLOCA(sizeof(unsigned) * 2 * (subPatternNum + 1), unsigned int, state);
     outputBuf[1] = start;
     do {
@@ -333,10 +734,25 @@ bool RegExpObject::match(ExecutionState& state, String* str, RegexMatchResult& m
         if (start > length) {
             break;
         }
-        if (LIKELY(str->has8BitContent()))
-            result = JSC::Yarr::interpret(m_bytecodePattern, str->characters8(), length, start, outputBuf);
-        else
-            result = JSC::Yarr::interpret(m_bytecodePattern, (const UChar*)str->characters16(), length, start, outputBuf);
+        if (m_isLiteralPattern) {
+            size_t index = str->find(m_source, start);
+            if (index == SIZE_MAX) {
+                result = JSC::Yarr::offsetNoMatch;
+            } else {
+                outputBuf[0] = index;
+                outputBuf[1] = index + m_source->length();
+                result = index;
+            }
+        } else {
+            size_t candidate = m_prefilter ? m_prefilter->findCandidate(str, start) : start;
+            if (candidate == SIZE_MAX) {
+                result = JSC::Yarr::offsetNoMatch;
+            } else if (LIKELY(str->has8BitContent())) {
+                result = JSC::Yarr::interpret(m_bytecodePattern, str->characters8(), length, candidate, outputBuf);
+            } else {
+                result = JSC::Yarr::interpret(m_bytecodePattern, (const UChar*)str->characters16(), length, candidate, outputBuf);
+            }
+        }
 
         if (result != JSC::Yarr::offsetNoMatch) {
             gotResult = true;
@@ -352,51 +768,29 @@ bool RegExpObject::match(ExecutionState& state, String* str, RegexMatchResult& m
             }
 
             // Details:{3, 10, 3, 10, 3, 6, 7, 10, 1684872, 806200}
+            // only offsets are recorded here. strings of legacy static properties are made on read
+            globalRegExpStatus.lastMatchInput = str;
+            globalRegExpStatus.lastMatch.m_start = outputBuf[0];
+            globalRegExpStatus.lastMatch.m_end = outputBuf[1];
             globalRegExpStatus.pairCount = maxMatchedIndex;
             unsigned pairEnd = std::min(maxMatchedIndex, (unsigned)9);
-            for (unsigned i = 1; i <= pairEnd; i++) {
-                if (outputBuf[i * 2] == std::numeric_limits<unsigned>::max()) {
-                    globalRegExpStatus.pairs[i - 1] = StringView();
-                } else {
-                    globalRegExpStatus.pairs[i - 1] = StringView(str, outputBuf[i * 2], outputBuf[i * 2 + 1]);
-                }
+            memcpy(globalRegExpStatus.pairs, outputBuf + 2, sizeof(unsigned) * 2 * pairEnd);
+            if (!lastParenInvalid && subPatternNum) {
+                globalRegExpStatus.lastParen.m_start = outputBuf[maxMatchedIndex * 2];
+                globalRegExpStatus.lastParen.m_end = outputBuf[maxMatchedIndex * 2 + 1];
+            } else {
+                globalRegExpStatus.lastParen.m_start = globalRegExpStatus.lastParen.m_end = std::numeric_limits<unsigned>::max();
             }
 
             if (UNLIKELY(testOnly)) {
                 // outputBuf[1] should be set to lastIndex
-                if (isGlobal) {
+                if (option() & (RegExpObject::Option::Global | RegExpObject::Option::Sticky)) {
                     setLastIndex(state, Value(outputBuf[1]));
                 }
-                if (!lastParenInvalid && subPatternNum) {
-                    globalRegExpStatus.lastParen = StringView(str, outputBuf[maxMatchedIndex * 2], outputBuf[maxMatchedIndex * 2 + 1]);
-                } else {
-                    globalRegExpStatus.lastParen = StringView();
-                }
-                globalRegExpStatus.lastMatch = StringView(str, outputBuf[0], outputBuf[1]);
-                globalRegExpStatus.leftContext = StringView(str, 0, outputBuf[0]);
-                globalRegExpStatus.rightContext = StringView(str, outputBuf[1], length);
                 return true;
             }
-            std::vector<RegexMatchResult::RegexMatchResultPiece> piece;
-            piece.resize(subPatternNum + 1);
-
-            for (unsigned i = 0; i < subPatternNum + 1; i++) {
-                RegexMatchResult::RegexMatchResultPiece p;
-                p.m_start = outputBuf[i * 2];
-                p.m_end = outputBuf[i * 2 + 1];
-                piece[i] = p;
-            }
-
-            if (!lastParenInvalid && subPatternNum) {
-                globalRegExpStatus.lastParen = StringView(str, piece[maxMatchedIndex].m_start, piece[maxMatchedIndex].m_end);
-            } else {
-                globalRegExpStatus.lastParen = StringView();
-            }
 
-            globalRegExpStatus.leftContext = StringView(str, 0, piece[0].m_start);
-            globalRegExpStatus.rightContext = StringView(str, piece[maxMatchedIndex].m_end, length);
-            globalRegExpStatus.lastMatch = StringView(str, piece[0].m_start, piece[0].m_end);
-            matchResult.m_matchResults.push_back(std::vector<RegexMatchResult::RegexMatchResultPiece>(std::move(piece)));
+            matchResult.m_matchResults.push_back((RegexMatchResult::RegexMatchResultPiece*)outputBuf, subPatternNum + 1);
             if (!isGlobal)
                 break;
             if (start == outputBuf[1]) {
@@ -32,15 +32,193 @@ struct BytecodePattern;
 
 namespace Escargot {
 
+#ifndef REGEX_MATCH_RESULT_INLINE_STORAGE_MAX
+#define REGEX_MATCH_RESULT_INLINE_STORAGE_MAX 32
+#endif
+
 struct RegexMatchResult {
     struct RegexMatchResultPiece {
         unsigned m_start, m_end;
     };
     COMPILE_ASSERT((sizeof(RegexMatchResultPiece)) == (sizeof(unsigned) * 2), sizeof_RegexMatchResultPiece_wrong);
+
+    // pieces of one match. whole match comes first and captures follow
+    class MatchedPieces {
+    public:
+        MatchedPieces(RegexMatchResultPiece* pieces, size_t size)
+            : m_pieces(pieces)
+            , m_size(size)
+        {
+        }
+
+        size_t size() const
+        {
+            return m_size;
+        }
+
+        const RegexMatchResultPiece* data() const
+        {
+            return m_pieces;
+        }
+
+        RegexMatchResultPiece& operator[](const size_t idx) const
+        {
+            ASSERT(idx < m_size);
+            return m_pieces[idx];
+        }
+
+    private:
+        RegexMatchResultPiece* m_pieces;
+        size_t m_size;
+    };
+
+    // pieces of every match are stored in one flat buffer
+    // buffer is inline storage until results outgrow it, so a few matches don't allocate
+    class MatchResultVector {
+    public:
+        MatchResultVector()
+            : m_buffer(m_inlineStorage)
+            , m_capacity(REGEX_MATCH_RESULT_INLINE_STORAGE_MAX)
+            , m_pieceCount(0)
+            , m_piecesPerMatch(0)
+        {
+        }
+
+        ~MatchResultVector()
+        {
+            if (m_buffer != m_inlineStorage) {
+                free(m_buffer);
+            }
+        }
+
+        MatchResultVector(const MatchResultVector& other) = delete;
+        const MatchResultVector& operator=(const MatchResultVector& other) = delete;
+
+        size_t size() const
+        {
+            return m_piecesPerMatch ? m_pieceCount / m_piecesPerMatch : 0;
+        }
+
+        MatchedPieces operator[](const size_t idx) const
+        {
+            ASSERT(idx < size());
+            return MatchedPieces(m_buffer + idx * m_piecesPerMatch, m_piecesPerMatch);
+        }
+
+        void push_back(const RegexMatchResultPiece* pieces, size_t count)
+        {
+            ASSERT(count);
+            ASSERT(!m_piecesPerMatch || m_piecesPerMatch == count);
+            if (UNLIKELY(m_pieceCount + count > m_capacity)) {
+                grow(m_pieceCount + count);
+            }
+            memcpy(m_buffer + m_pieceCount, pieces, sizeof(RegexMatchResultPiece) * count);
+            m_pieceCount += count;
+            m_piecesPerMatch = count;
+        }
+
+        void push_back(const MatchedPieces& pieces)
+        {
+            push_back(pieces.data(), pieces.size());
+        }
+
+        void clear()
+        {
+            m_pieceCount = 0;
+            m_piecesPerMatch = 0;
+        }
+
+    private:
+        void grow(size_t minimumCapacity)
+        {
+            size_t newCapacity = std::max(minimumCapacity, m_capacity * 2);
+            RegexMatchResultPiece* newBuffer = (RegexMatchResultPiece*)malloc(sizeof(RegexMatchResultPiece) * newCapacity);
+            RELEASE_ASSERT(newBuffer);
+            memcpy(newBuffer, m_buffer, sizeof(RegexMatchResultPiece) * m_pieceCount);
+            if (m_buffer != m_inlineStorage) {
+                free(m_buffer);
+            }
+            m_buffer = newBuffer;
+            m_capacity = newCapacity;
+        }
+
+        RegexMatchResultPiece* m_buffer;
+        size_t m_capacity;
+        size_t m_pieceCount;
+        size_t m_piecesPerMatch;
+        RegexMatchResultPiece m_inlineStorage[REGEX_MATCH_RESULT_INLINE_STORAGE_MAX];
+    };
+
     int m_subPatternNum;
-    std::vector<std::vector<RegexMatchResultPiece>> m_matchResults;
+    MatchResultVector m_matchResults;
+};
+
+// literals which every match of a pattern contains, extracted from pattern source
+// matching skips to positions where a match can start without entering Yarr,
+// and input without required literal is rejected without entering Yarr
+class RegExpPrefilter : public gc {
+public:
+    // returns nullptr when nothing useful is found
+    static RegExpPrefilter* create(String* source, unsigned option);
+
+    // returns false when str has no match at or after start
+    bool mayMatch(String* str, size_t start)
+    {
+        return !m_requiredSubstring || str->find(m_requiredSubstring, start) != SIZE_MAX;
+    }
+
+    // returns first position at or after start where a match can start, SIZE_MAX if there is none
+    size_t findCandidate(String* str, size_t start)
+    {
+        if (m_prefix) {
+            return str->find(m_prefix, start);
+        } else if (m_hasFirstCharacterSet) {
+            return findFirstCharacter(str, start);
+        }
+        return start;
+    }
+
+private:
+    RegExpPrefilter()
+        : m_prefix(nullptr)
+        , m_requiredSubstring(nullptr)
+        , m_hasFirstCharacterSet(false)
+        , m_scanCharacterCount(0)
+    {
+        memset(m_firstCharacterSet, 0, sizeof(m_firstCharacterSet));
+    }
+
+    size_t findFirstCharacter(String* str, size_t start);
+    void collectScanCharacters();
+
+    void addFirstCharacter(char16_t c)
+    {
+        ASSERT(c < 256);
+        m_firstCharacterSet[c / 32] |= 1u << (c % 32);
+    }
+
+    bool hasFirstCharacter(char16_t c)
+    {
+        return c < 256 && (m_firstCharacterSet[c / 32] & (1u << (c % 32)));
+    }
+
+    bool parseFirstCharacterClass(String* source, size_t start, size_t end);
+
+    // match starts with m_prefix
+    String* m_prefix;
+    // longest literal which is not a prefix
+    String* m_requiredSubstring;
+    // match starts with one of characters in m_firstCharacterSet. only Latin1 characters are stored
+    bool m_hasFirstCharacterSet;
+    uint32_t m_firstCharacterSet[8];
+    // characters of m_firstCharacterSet when there are only a few. 8-bit strings are scanned for them with memchr
+    // m_scanCharacterCount is 0 when the set is larger, and the set is tested per character instead
+    LChar m_scanCharacters[4];
+    size_t m_scanCharacterCount;
 };
 
+struct RegExpLiteralCache;
+
 class RegExpObject : public Object {
     void initRegExpObject(ExecutionState& state);
 
@@ -65,7 +243,7 @@ public:
 
         bool operator==(const RegExpCacheKey& otherKey) const
         {
-            return (m_body == otherKey.m_body) && (m_multiline == otherKey.m_multiline) && (m_ignoreCase == otherKey.m_ignoreCase);
+            return (m_multiline == otherKey.m_multiline) && (m_ignoreCase == otherKey.m_ignoreCase) && m_body->equals(otherKey.m_body);
         }
         const String* m_body;
         const bool m_multiline : 1;
@@ -77,17 +255,23 @@ public:
             : m_yarrError(yarrError)
             , m_yarrPattern(yarrPattern)
             , m_bytecodePattern(bytecodePattern)
+            , m_isLiteralPattern(false)
+            , m_prefilter(nullptr)
         {
         }
 
         const char* m_yarrError;
         JSC::Yarr::YarrPattern* m_yarrPattern;
         JSC::Yarr::BytecodePattern* m_bytecodePattern;
+        // pattern has no syntax character, so it is matched by String::find without Yarr
+        bool m_isLiteralPattern;
+        RegExpPrefilter* m_prefilter;
     };
 
     explicit RegExpObject(ExecutionState& state);
     RegExpObject(ExecutionState& state, String* source, String* option);
     RegExpObject(ExecutionState& state, String* source, unsigned int option);
+    RegExpObject(ExecutionState& state, RegExpLiteralCache* literalCache);
 
     void init(ExecutionState& state, String* source, String* option);
     void initWithOption(ExecutionState& state, String* source, Option option);
@@ -135,6 +319,8 @@ public:
         return m_lastIndex;
     }
 
+    RegExpLiteralCache* createLiteralCache(ExecutionState& state);
+
     void setLastIndex(ExecutionState& state, const Value& v);
     virtual bool defineOwnProperty(ExecutionState& state, const ObjectPropertyName& P, const ObjectPropertyDescriptor& desc);
 
@@ -167,6 +353,7 @@ private:
     void internalInit(ExecutionState& state, String* source);
 
     static RegExpCacheEntry& getCacheEntryAndCompileIfNeeded(ExecutionState& state, String* source, const Option& option);
+    bool compileBytecodePatternIfNeeded(ExecutionState& state);
 
     void parseOption(ExecutionState& state, const String* optionString);
 
@@ -174,17 +361,27 @@ private:
     String* m_source;
     String* m_optionString;
     Option m_option;
+    bool m_isLiteralPattern;
     JSC::Yarr::YarrPattern* m_yarrPattern;
     JSC::Yarr::BytecodePattern* m_bytecodePattern;
+    RegExpPrefilter* m_prefilter;
 
     SmallValue m_lastIndex;
     const String* m_lastExecutedString;
 };
 
-typedef std::unordered_map<RegExpObject::RegExpCacheKey, RegExpObject::RegExpCacheEntry,
-                           std::hash<RegExpObject::RegExpCacheKey>, std::equal_to<RegExpObject::RegExpCacheKey>,
-                           gc_allocator<std::pair<const RegExpObject::RegExpCacheKey, RegExpObject::RegExpCacheEntry>>>
-    RegExpCacheMap;
+// compiled state of a regexp literal site, shared by every object the site creates
+// this is allocated on first evaluation and kept alive by ByteCodeBlock::m_literalData
+struct RegExpLiteralCache : public gc {
+    String* m_source;
+    String* m_optionString;
+    RegExpObject::Option m_option;
+    bool m_isLiteralPattern;
+    JSC::Yarr::YarrPattern* m_yarrPattern;
+    JSC::Yarr::BytecodePattern* m_bytecodePattern;
+    RegExpPrefilter* m_prefilter;
+};
+
 }
 
 namespace std {
@@ -206,4 +403,55 @@ struct equal_to<Escargot::RegExpObject::RegExpCacheKey> {
 };
 }
 
+namespace Escargot {
+
+#ifndef REGEXP_CACHE_SIZE_LIMIT
+#define REGEXP_CACHE_SIZE_LIMIT 256
+#endif
+
+// compiled patterns keyed on source and flags
+// least recently used pattern is evicted when the cache is full,
+// so entries returned by find or insert are valid until the next insert
+class RegExpCacheMap {
+public:
+    RegExpCacheMap()
+        : m_hitCount(0)
+        , m_missCount(0)
+    {
+    }
+
+    RegExpObject::RegExpCacheEntry* find(const RegExpObject::RegExpCacheKey& key);
+    RegExpObject::RegExpCacheEntry& insert(const RegExpObject::RegExpCacheKey& key, const RegExpObject::RegExpCacheEntry& entry);
+    void clear();
+
+    size_t size() const
+    {
+        return m_index.size();
+    }
+
+    size_t hitCount() const
+    {
+        return m_hitCount;
+    }
+
+    size_t missCount() const
+    {
+        return m_missCount;
+    }
+
+private:
+    typedef std::pair<RegExpObject::RegExpCacheKey, RegExpObject::RegExpCacheEntry> CachedPattern;
+    typedef std::list<CachedPattern, gc_allocator<CachedPattern>> CachedPatternList;
+
+    // most recently used pattern first
+    CachedPatternList m_patterns;
+    std::unordered_map<RegExpObject::RegExpCacheKey, CachedPatternList::iterator,
+                       std::hash<RegExpObject::RegExpCacheKey>, std::equal_to<RegExpObject::RegExpCacheKey>,
+                       gc_allocator<std::pair<const RegExpObject::RegExpCacheKey, CachedPatternList::iterator>>>
+        m_index;
+    size_t m_hitCount;
+    size_t m_missCount;
+};
+}
+
 #endif
@@ -30,6 +30,7 @@ void* RopeString::operator new(size_t size)
     static GC_descr descr;
     if (!typeInited) {
         GC_word obj_bitmap[GC_BITMAP_SIZE(RopeString)] = { 0 };
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(RopeString, m_tag));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(RopeString, m_left));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(RopeString, m_right));
         descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(RopeString));
@@ -48,20 +49,11 @@ String* RopeString::createRopeString(String* lstr, String* rstr, ExecutionState*
         const auto& rData = rstr->bufferAccessData();
         if (LIKELY(lData.has8BitContent && rData.has8BitContent)) {
             Latin1StringData ret;
-            size_t len = lData.length + rData.length;
-            ret.resizeWithUninitializedValues(len);
+            ret.resizeWithUninitializedValues(lData.length + rData.length);
 
             LChar* result = ret.data();
-            const LChar* buffer = (const LChar*)lData.buffer;
-            for (size_t i = 0; i < lData.length; i++) {
-                result[i] = buffer[i];
-            }
-
-            result += lData.length;
-            buffer = (const LChar*)rData.buffer;
-            for (size_t i = 0; i < rData.length; i++) {
-                result[i] = buffer[i];
-            }
+            memcpy(result, lData.buffer, lData.length);
+            memcpy(result + lData.length, rData.buffer, rData.length);
             return new Latin1String(std::move(ret));
         } else {
             StringBuilder builder;
@@ -75,43 +67,203 @@ String* RopeString::createRopeString(String* lstr, String* rstr, ExecutionState*
         ErrorObject::throwBuiltinError(*state, ErrorObject::RangeError, errorMessage_String_InvalidStringLength);
     }
 
+    if (UNLIKELY(std::max(depthOf(lstr), depthOf(rstr)) + 1 > ROPE_STRING_MAX_DEPTH)) {
+        return rebalance(lstr, rstr);
+    }
+
+    return concatWithoutBalancing(lstr, rstr);
+}
+
+RopeString* RopeString::concatWithoutBalancing(String* lstr, String* rstr)
+{
     RopeString* rope = new RopeString();
-    rope->m_contentLength = llen + rlen;
+    rope->m_bufferAccessData.length = lstr->length() + rstr->length();
+    rope->m_bufferAccessData.has8BitContent = lstr->has8BitContent() & rstr->has8BitContent();
     rope->m_left = lstr;
     rope->m_right = rstr;
+    rope->m_depth = std::max(depthOf(lstr), depthOf(rstr)) + 1;
 
-    bool l8bit;
-    if (lstr->isRopeString()) {
-        l8bit = ((RopeString*)lstr)->m_has8BitContent;
-    } else {
-        l8bit = lstr->has8BitContent();
+    return rope;
+}
+
+#define ROPE_STRING_FOREST_SIZE 64
+
+// ropeMinimumLengths()[i] is fibonacci(i + 2)
+static const uint64_t* ropeMinimumLengths()
+{
+    static bool tableInited = false;
+    static uint64_t table[ROPE_STRING_FOREST_SIZE + 1];
+    if (!tableInited) {
+        table[0] = 1;
+        table[1] = 2;
+        for (size_t i = 2; i <= ROPE_STRING_FOREST_SIZE; i++) {
+            table[i] = table[i - 1] + table[i - 2];
+        }
+        tableInited = true;
+    }
+    return table;
+}
+
+bool RopeString::isBalanced(String* str)
+{
+    size_t depth = depthOf(str);
+    if (depth >= ROPE_STRING_FOREST_SIZE) {
+        return false;
     }
+    return str->length() >= ropeMinimumLengths()[depth];
+}
 
-    bool r8bit;
-    if (rstr->isRopeString()) {
-        r8bit = ((RopeString*)rstr)->m_has8BitContent;
-    } else {
-        r8bit = rstr->has8BitContent();
+// forest[i] holds a balanced rope whose length is in [fibonacci(i + 2), fibonacci(i + 3))
+// same as the forest of Boehm, Atkinson and Plass, "Ropes: an Alternative to Strings"
+void RopeString::addBalancedNodeToForest(String* node, String** forest)
+{
+    const uint64_t* minimumLengths = ropeMinimumLengths();
+    size_t length = node->length();
+    String* tooShort = nullptr;
+    size_t i = 0;
+
+    // concatenate every shorter tree first so the order of characters is kept
+    for (; length >= minimumLengths[i + 1]; i++) {
+        ASSERT(i + 1 < ROPE_STRING_FOREST_SIZE);
+        if (forest[i]) {
+            tooShort = tooShort ? concatWithoutBalancing(forest[i], tooShort) : forest[i];
+            forest[i] = nullptr;
+        }
     }
 
-    rope->m_has8BitContent = l8bit & r8bit;
-    /*
-    bool has8 = true;
-    if (!lstr->has8BitContent()) {
-        if (!isAllLatin1((char16_t*)lstr->bufferAccessData().buffer, llen)) {
-            has8 = false;
+    String* insertee = tooShort ? concatWithoutBalancing(tooShort, node) : node;
+    for (;; i++) {
+        if (forest[i]) {
+            insertee = concatWithoutBalancing(forest[i], insertee);
+            forest[i] = nullptr;
+        }
+        if (i == ROPE_STRING_FOREST_SIZE - 1 || insertee->length() < minimumLengths[i + 1]) {
+            forest[i] = insertee;
+            return;
         }
     }
+}
+
+// rebuilds (lstr + rstr) from its balanced subtrees. characters are not copied
+// and the subtrees are shared, so the cost is proportional to the number of unbalanced nodes
+String* RopeString::rebalance(String* lstr, String* rstr)
+{
+    String* forest[ROPE_STRING_FOREST_SIZE] = {};
 
-    if (has8 && !rstr->has8BitContent()) {
-        if (!isAllLatin1((char16_t*)rstr->bufferAccessData().buffer, rlen)) {
-            has8 = false;
+    // depth of both children is ROPE_STRING_MAX_DEPTH at most,
+    // and the left-first traversal keeps at most one pending right child per level
+    String* stack[ROPE_STRING_MAX_DEPTH + 2];
+    size_t stackSize = 0;
+    stack[stackSize++] = rstr;
+    stack[stackSize++] = lstr;
+    while (stackSize) {
+        String* node = stack[--stackSize];
+        if (!node->length()) {
+            continue;
         }
+        if (isBalanced(node)) {
+            addBalancedNodeToForest(node, forest);
+            continue;
+        }
+        RopeString* rope = (RopeString*)node;
+        ASSERT(stackSize + 2 <= ROPE_STRING_MAX_DEPTH + 2);
+        stack[stackSize++] = rope->m_right;
+        stack[stackSize++] = rope->m_left;
     }
 
-    rope->m_has8BitContent = has8;
-    */
-    return rope;
+    String* result = nullptr;
+    for (size_t i = 0; i < ROPE_STRING_FOREST_SIZE; i++) {
+        if (forest[i]) {
+            result = result ? concatWithoutBalancing(forest[i], result) : forest[i];
+        }
+    }
+    ASSERT(result && result->length() == lstr->length() + rstr->length());
+    ASSERT(depthOf(result) <= ROPE_STRING_MAX_DEPTH);
+    return result;
+}
+
+char16_t RopeString::charAt(const size_t idx) const
+{
+    ASSERT(idx < length());
+    if (wasFlattened() || m_walkedNodeCount >= std::min(length(), (size_t)ROPE_STRING_MAX_WALKED_NODE_COUNT)) {
+        return normalString()->charAt(idx);
+    }
+
+    const RopeString* rope = this;
+    size_t index = idx;
+    size_t walked = 0;
+    String* leaf;
+    while (true) {
+        walked++;
+        String* left = rope->m_left;
+        size_t leftLength = left->length();
+        String* next;
+        if (index < leftLength) {
+            next = left;
+        } else {
+            index -= leftLength;
+            next = rope->m_right;
+        }
+
+        if (!next->isRopeString() || ((RopeString*)next)->wasFlattened()) {
+            leaf = next;
+            break;
+        }
+        rope = (RopeString*)next;
+    }
+
+    const_cast<RopeString*>(this)->m_walkedNodeCount = std::min(m_walkedNodeCount + walked, (size_t)ROPE_STRING_MAX_WALKED_NODE_COUNT);
+    return leaf->charAt(index);
+}
+
+bool RopeString::isSubstringAtWithoutFlattening(String* str, size_t pos) const
+{
+    const size_t strLength = str->length();
+    ASSERT(pos + strLength <= length());
+    const auto& strData = str->bufferAccessData();
+
+    // descend from the root to the leaf holding each next character.
+    // depth is kept under ROPE_STRING_MAX_DEPTH, so this needs neither a stack nor allocation
+    size_t compared = 0;
+    while (compared < strLength) {
+        String* node = const_cast<RopeString*>(this);
+        size_t index = pos + compared;
+        while (node->isRopeString() && !((RopeString*)node)->wasFlattened()) {
+            RopeString* rope = (RopeString*)node;
+            size_t leftLength = rope->m_left->length();
+            if (index < leftLength) {
+                node = rope->m_left;
+            } else {
+                index -= leftLength;
+                node = rope->m_right;
+            }
+        }
+
+        const auto& data = node->bufferAccessData();
+        size_t count = std::min(data.length - index, strLength - compared);
+        for (size_t i = 0; i < count; i++) {
+            if (data.charAt(index + i) != strData.charAt(compared + i)) {
+                return false;
+            }
+        }
+        compared += count;
+    }
+
+    return true;
+}
+
+template <typename ResultType, typename SourceType>
+static ALWAYS_INLINE void copyCharacters(ResultType* dst, const SourceType* src, size_t length)
+{
+    for (size_t i = 0; i < length; i++) {
+        dst[i] = src[i];
+    }
+}
+
+template <typename T>
+static ALWAYS_INLINE void copyCharacters(T* dst, const T* src, size_t length)
+{
+    memcpy(dst, src, sizeof(T) * length);
 }
 
 template <typename A, typename B>
@@ -119,11 +271,12 @@ void RopeString::flattenRopeStringWorker()
 {
     A result;
     result.resizeWithUninitializedValues(length());
+    // iterative traversal. right child is popped first and written from the end of result
+    // so deep left-leaning rope does not consume native stack
     std::vector<String*> queue;
     queue.push_back(m_left);
     queue.push_back(m_right);
     size_t pos = result.size();
-    size_t k = 0;
     while (!queue.empty()) {
         String* cur = queue.back();
         queue.pop_back();
@@ -141,20 +294,13 @@ void RopeString::flattenRopeStringWorker()
         const auto& data = sub->bufferAccessData();
 
         pos -= data.length;
-        size_t subLength = data.length;
-
         if (data.has8BitContent) {
-            auto ptr = (const LChar*)data.buffer;
-            for (size_t i = 0; i < subLength; i++) {
-                result[i + pos] = ptr[i];
-            }
+            copyCharacters(result.data() + pos, (const LChar*)data.buffer, data.length);
         } else {
-            auto ptr = (const char16_t*)data.buffer;
-            for (size_t i = 0; i < subLength; i++) {
-                result[i + pos] = ptr[i];
-            }
+            copyCharacters(result.data() + pos, (const char16_t*)data.buffer, data.length);
         }
     }
+    ASSERT(pos == 0);
     m_left = new B(std::move(result));
     m_right = nullptr;
 }
@@ -162,7 +308,7 @@ void RopeString::flattenRopeStringWorker()
 void RopeString::flattenRopeString()
 {
     ASSERT(m_right);
-    if (m_has8BitContent) {
+    if (m_bufferAccessData.has8BitContent) {
         flattenRopeStringWorker<Latin1StringData, Latin1String>();
     } else {
         flattenRopeStringWorker<UTF16StringData, UTF16String>();
@@ -33,8 +33,12 @@ public:
     {
         m_left = String::emptyString;
         m_right = String::emptyString;
-        m_contentLength = 0;
-        m_has8BitContent = true;
+        m_depth = 0;
+        m_walkedNodeCount = 0;
+        // length and has8BitContent of m_bufferAccessData are valid before flattening
+        m_bufferAccessData.has8BitContent = true;
+        m_bufferAccessData.length = 0;
+        m_bufferAccessData.buffer = nullptr;
         m_bufferAccessData.hasSpecialImpl = true;
     }
 
@@ -46,12 +50,10 @@ public:
 
     virtual size_t length() const
     {
-        return m_contentLength;
-    }
-    virtual char16_t charAt(const size_t idx) const
-    {
-        return normalString()->charAt(idx);
+        return m_bufferAccessData.length;
     }
+    // walks the rope without flattening
+    virtual char16_t charAt(const size_t idx) const;
     virtual UTF16StringData toUTF16StringData() const
     {
         return normalString()->toUTF16StringData();
@@ -68,6 +70,14 @@ public:
         return true;
     }
 
+    bool wasFlattened() const
+    {
+        return !m_right;
+    }
+
+    // compares [pos, pos + str->length()) of this rope with str without flattening
+    bool isSubstringAtWithoutFlattening(String* str, size_t pos) const;
+
     virtual const LChar* characters8() const
     {
         return normalString()->characters8();
@@ -97,20 +107,33 @@ protected:
     void flattenRopeStringWorker();
     void flattenRopeString();
 
+    static size_t depthOf(String* str)
+    {
+        if (str->isRopeString() && !((RopeString*)str)->wasFlattened()) {
+            return ((RopeString*)str)->m_depth;
+        }
+        return 0;
+    }
+
+    // a rope is balanced when it is at least as long as fibonacci(depth + 2)
+    static bool isBalanced(String* str);
+    static RopeString* concatWithoutBalancing(String* lstr, String* rstr);
+    static void addBalancedNodeToForest(String* node, String** forest);
+    static String* rebalance(String* lstr, String* rstr);
+
 private:
     String* m_left;
     String* m_right;
     struct {
-        bool m_has8BitContent : 1;
+        // count of rope nodes on the longest path to leaf. kept under ROPE_STRING_MAX_DEPTH by rebalancing
+        size_t m_depth : 16;
+        // charAt walks the rope until the walked nodes cost more than flattening
 #if ESCARGOT_32
-        size_t m_contentLength : 31;
+        size_t m_walkedNodeCount : 16;
 #else
-        size_t m_contentLength : 63;
+        size_t m_walkedNodeCount : 48;
 #endif
     };
-#if !defined(COMPILER_MSVC)
-    static_assert(STRING_MAXIMUM_LENGTH < (std::numeric_limits<size_t>::max() / 2), "");
-#endif
 };
 }
 
@@ -0,0 +1,415 @@
+/*
+ * Copyright (c) 2019-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#include "Escargot.h"
+#include "SamplingProfiler.h"
+#include "runtime/Context.h"
+#include "runtime/VMInstance.h"
+#include "runtime/ExecutionState.h"
+#include "runtime/ExecutionContext.h"
+#include "runtime/Environment.h"
+#include "runtime/EnvironmentRecord.h"
+#include "runtime/FunctionObject.h"
+#include "interpreter/ByteCode.h"
+#include "parser/CodeBlock.h"
+#include "parser/Script.h"
+
+#if defined(OS_POSIX)
+#include <sys/time.h>
+#endif
+
+namespace Escargot {
+
+std::atomic<int> SamplingProfiler::s_sampleRequested(0);
+std::atomic<SamplingProfiler*> SamplingProfiler::s_runningProfiler(nullptr);
+
+SamplingProfiler::SamplingProfiler()
+    : m_samples(nullptr)
+    , m_sampleCount(0)
+    , m_intervalInMicroseconds(0)
+{
+}
+
+SamplingProfiler::~SamplingProfiler()
+{
+    stop();
+    if (m_samples) {
+        GC_FREE(m_samples);
+    }
+}
+
+void SamplingProfiler::signalHandler(int)
+{
+    s_sampleRequested.store(1, std::memory_order_relaxed);
+}
+
+bool SamplingProfiler::start(size_t intervalInMicroseconds)
+{
+#if defined(OS_POSIX)
+    if (!intervalInMicroseconds) {
+        return false;
+    }
+
+    // refuse second profiler. VMInstances on other threads can race here
+    SamplingProfiler* expected = nullptr;
+    if (!s_runningProfiler.compare_exchange_strong(expected, this)) {
+        return false;
+    }
+
+    m_intervalInMicroseconds = intervalInMicroseconds;
+    if (!m_samples) {
+        m_samples = (Sample*)GC_MALLOC_UNCOLLECTABLE(sizeof(Sample) * SAMPLING_PROFILER_RING_BUFFER_SIZE);
+    }
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = signalHandler;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(SIGPROF, &action, &m_oldSignalAction)) {
+        s_runningProfiler.store(nullptr);
+        return false;
+    }
+
+    struct itimerval timer;
+    timer.it_interval.tv_sec = intervalInMicroseconds / 1000000;
+    timer.it_interval.tv_usec = intervalInMicroseconds % 1000000;
+    timer.it_value = timer.it_interval;
+    if (setitimer(ITIMER_PROF, &timer, nullptr)) {
+        sigaction(SIGPROF, &m_oldSignalAction, nullptr);
+        s_runningProfiler.store(nullptr);
+        return false;
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+void SamplingProfiler::stop()
+{
+    if (!isRunning()) {
+        return;
+    }
+
+#if defined(OS_POSIX)
+    struct itimerval timer;
+    memset(&timer, 0, sizeof(timer));
+    setitimer(ITIMER_PROF, &timer, nullptr);
+    sigaction(SIGPROF, &m_oldSignalAction, nullptr);
+#endif
+    s_sampleRequested.store(0, std::memory_order_relaxed);
+    s_runningProfiler.store(nullptr);
+}
+
+void SamplingProfiler::takeSample(ExecutionState& state, ByteCodeBlock* byteCodeBlock, size_t programCounter)
+{
+    // SIGPROF can be delivered to any thread. only the thread running profiled VMInstance consumes the request
+    SamplingProfiler* profiler = state.context()->vmInstance()->samplingProfiler();
+    if (profiler && profiler->isRunning()) {
+        s_sampleRequested.store(0, std::memory_order_relaxed);
+        profiler->recordSample(state, byteCodeBlock, programCounter);
+    }
+}
+
+// returns code block of the function or the global code which owns ec
+// catch and with blocks make new ExecutionContext, so they are folded into the enclosing function with record
+static CodeBlock* codeBlockOfExecutionContext(ExecutionContext* ec, EnvironmentRecord*& record)
+{
+    LexicalEnvironment* env = ec->lexicalEnvironment();
+    while (env) {
+        EnvironmentRecord* r = env->record();
+        if (r->isDeclarativeEnvironmentRecord() && r->asDeclarativeEnvironmentRecord()->isFunctionEnvironmentRecord()) {
+            record = r;
+            return r->asDeclarativeEnvironmentRecord()->asFunctionEnvironmentRecord()->functionObject()->codeBlock();
+        } else if (r->isGlobalEnvironmentRecord()) {
+            record = r;
+            return r->asGlobalEnvironmentRecord()->globalCodeBlock();
+        }
+        env = env->outerEnvironment();
+    }
+    record = nullptr;
+    return nullptr;
+}
+
+void SamplingProfiler::recordSample(ExecutionState& state, ByteCodeBlock* byteCodeBlock, size_t programCounter)
+{
+    // oldest sample is overwritten when ring buffer is full
+    Sample& sample = m_samples[m_sampleCount++ % SAMPLING_PROFILER_RING_BUFFER_SIZE];
+    sample.m_byteCodeBlock = byteCodeBlock;
+    sample.m_byteCodePosition = byteCodeBlock ? programCounter - (size_t)byteCodeBlock->m_code.data() : 0;
+
+    size_t depth = 0;
+    EnvironmentRecord* lastRecord = nullptr;
+    ExecutionContext* ec = state.executionContext();
+    while (ec && depth < SAMPLING_PROFILER_MAX_STACK_DEPTH) {
+        EnvironmentRecord* record;
+        CodeBlock* cb = codeBlockOfExecutionContext(ec, record);
+        if (!record || record != lastRecord) {
+            sample.m_frames[depth++] = cb;
+        }
+        lastRecord = record;
+        ec = ec->parent();
+    }
+    sample.m_depth = depth;
+}
+
+static void symbolizeFrame(CodeBlock* cb, std::string& name, std::string& fileName, bool& isNative)
+{
+    fileName.clear();
+    isNative = false;
+    if (!cb) {
+        name = "(unknown)";
+        return;
+    }
+
+    if (!cb->isInterpretedCodeBlock()) {
+        name = cb->functionName().string()->toNonGCUTF8StringData();
+        isNative = true;
+        return;
+    }
+
+    InterpretedCodeBlock* icb = cb->asInterpretedCodeBlock();
+    if (icb->isGlobalScopeCodeBlock()) {
+        name = "(program)";
+    } else if (cb->functionName().string()->length()) {
+        name = cb->functionName().string()->toNonGCUTF8StringData();
+    } else {
+        name = "(anonymous)";
+    }
+
+    if (icb->script() && icb->script()->fileName()) {
+        fileName = icb->script()->fileName()->toNonGCUTF8StringData();
+    }
+}
+
+// symbolization is done here, out of the sampling path
+template <typename Fn>
+void SamplingProfiler::forEachSymbolizedSample(const Fn& fn)
+{
+    std::vector<SymbolizedFrame> frames;
+    size_t count = std::min(m_sampleCount, (size_t)SAMPLING_PROFILER_RING_BUFFER_SIZE);
+    for (size_t i = 0; i < count; i++) {
+        Sample& sample = m_samples[i];
+        frames.resize(sample.m_depth);
+        for (size_t j = sample.m_depth; j > 0; j--) {
+            CodeBlock* cb = sample.m_frames[j - 1];
+            SymbolizedFrame& frame = frames[sample.m_depth - j];
+            frame.m_line = 0;
+            if (cb && cb->isInterpretedCodeBlock()) {
+                frame.m_line = cb->asInterpretedCodeBlock()->sourceElementStart().line;
+                if (j == 1 && sample.m_byteCodeBlock && sample.m_byteCodeBlock->m_codeBlock == cb) {
+                    ExtendedNodeLOC loc = sample.m_byteCodeBlock->computeNodeLOCFromByteCode(sample.m_byteCodePosition, cb);
+                    if (loc.line != SIZE_MAX) {
+                        frame.m_line = loc.line;
+                    }
+                }
+            }
+            symbolizeFrame(cb, frame.m_name, frame.m_fileName, frame.m_isNative);
+        }
+        fn(frames);
+    }
+
+    if (count) {
+        memset(m_samples, 0, sizeof(Sample) * count);
+    }
+    m_sampleCount = 0;
+}
+
+std::string SamplingProfiler::collapsedStacks()
+{
+    std::map<std::string, size_t> collapsedStacks;
+    std::string stack;
+    forEachSymbolizedSample([&](const std::vector<SymbolizedFrame>& frames) {
+        stack.clear();
+        for (const SymbolizedFrame& frame : frames) {
+            if (stack.length()) {
+                stack += ';';
+            }
+            stack += frame.m_name;
+            if (frame.m_isNative) {
+                stack += " (native)";
+            } else if (frame.m_name != "(unknown)") {
+                stack += " (";
+                stack += frame.m_fileName;
+                stack += ':';
+                stack += std::to_string(frame.m_line);
+                stack += ')';
+            }
+        }
+        collapsedStacks[stack]++;
+    });
+
+    std::string result;
+    for (auto& iter : collapsedStacks) {
+        result += iter.first;
+        result += ' ';
+        result += std::to_string(iter.second);
+        result += '\n';
+    }
+    return result;
+}
+
+// writes messages of protocol buffers. only varint and length-delimited fields are needed for profile.proto
+class ProtobufWriter {
+public:
+    void writeVarint(uint64_t value)
+    {
+        while (value >= 0x80) {
+            m_data += (char)((value & 0x7f) | 0x80);
+            value >>= 7;
+        }
+        m_data += (char)value;
+    }
+
+    void writeVarintField(size_t field, uint64_t value)
+    {
+        writeVarint(field << 3);
+        writeVarint(value);
+    }
+
+    void writeBytesField(size_t field, const std::string& bytes)
+    {
+        writeVarint((field << 3) | 2);
+        writeVarint(bytes.length());
+        m_data += bytes;
+    }
+
+    void writePackedVarintField(size_t field, const std::vector<uint64_t>& values)
+    {
+        ProtobufWriter packed;
+        for (uint64_t value : values) {
+            packed.writeVarint(value);
+        }
+        writeBytesField(field, packed.data());
+    }
+
+    const std::string& data() const
+    {
+        return m_data;
+    }
+
+private:
+    std::string m_data;
+};
+
+// see https://github.com/google/pprof/blob/master/proto/profile.proto
+// each function and each (function, line) pair gets one id, and equal stacks are merged into one sample
+std::string SamplingProfiler::pprofProfile()
+{
+    std::vector<std::string> stringTable;
+    std::map<std::string, uint64_t> stringIndex;
+    auto internString = [&](const std::string& str) -> uint64_t {
+        auto iter = stringIndex.find(str);
+        if (iter != stringIndex.end()) {
+            return iter->second;
+        }
+        uint64_t index = stringTable.size();
+        stringTable.push_back(str);
+        stringIndex[str] = index;
+        return index;
+    };
+    // string_table[0] should be empty string
+    internString(std::string());
+
+    // (name, file name) -> function id
+    std::map<std::pair<uint64_t, uint64_t>, uint64_t> functions;
+    // (function id, line) -> location id
+    std::map<std::pair<uint64_t, uint64_t>, uint64_t> locations;
+    // location ids, innermost first -> count
+    std::map<std::vector<uint64_t>, uint64_t> samples;
+
+    std::string name;
+    std::vector<uint64_t> locationIds;
+    forEachSymbolizedSample([&](const std::vector<SymbolizedFrame>& frames) {
+        locationIds.clear();
+        for (size_t i = frames.size(); i > 0; i--) {
+            const SymbolizedFrame& frame = frames[i - 1];
+            name = frame.m_name;
+            if (frame.m_isNative) {
+                name += " (native)";
+            }
+            auto functionKey = std::make_pair(internString(name), internString(frame.m_fileName));
+            auto functionIter = functions.insert(std::make_pair(functionKey, functions.size() + 1)).first;
+            auto locationKey = std::make_pair(functionIter->second, (uint64_t)frame.m_line);
+            auto locationIter = locations.insert(std::make_pair(locationKey, locations.size() + 1)).first;
+            locationIds.push_back(locationIter->second);
+        }
+        samples[locationIds]++;
+    });
+
+    ProtobufWriter profile;
+    uint64_t samplesType = internString("samples");
+    uint64_t countUnit = internString("count");
+    uint64_t cpuType = internString("cpu");
+    uint64_t nanosecondsUnit = internString("nanoseconds");
+
+    // sample_type = 1. values of each sample are (count, count * period)
+    ProtobufWriter valueType;
+    valueType.writeVarintField(1, samplesType);
+    valueType.writeVarintField(2, countUnit);
+    profile.writeBytesField(1, valueType.data());
+    ProtobufWriter cpuValueType;
+    cpuValueType.writeVarintField(1, cpuType);
+    cpuValueType.writeVarintField(2, nanosecondsUnit);
+    profile.writeBytesField(1, cpuValueType.data());
+
+    // sample = 2
+    uint64_t period = (uint64_t)m_intervalInMicroseconds * 1000;
+    for (auto& iter : samples) {
+        ProtobufWriter sample;
+        sample.writePackedVarintField(1, iter.first);
+        sample.writePackedVarintField(2, { iter.second, iter.second * period });
+        profile.writeBytesField(2, sample.data());
+    }
+
+    // location = 4 { id = 1, line = 4 { function_id = 1, line = 2 } }
+    for (auto& iter : locations) {
+        ProtobufWriter line;
+        line.writeVarintField(1, iter.first.first);
+        line.writeVarintField(2, iter.first.second);
+        ProtobufWriter location;
+        location.writeVarintField(1, iter.second);
+        location.writeBytesField(4, line.data());
+        profile.writeBytesField(4, location.data());
+    }
+
+    // function = 5 { id = 1, name = 2, system_name = 3, filename = 4 }
+    for (auto& iter : functions) {
+        ProtobufWriter function;
+        function.writeVarintField(1, iter.second);
+        function.writeVarintField(2, iter.first.first);
+        function.writeVarintField(3, iter.first.first);
+        function.writeVarintField(4, iter.first.second);
+        profile.writeBytesField(5, function.data());
+    }
+
+    // string_table = 6
+    for (const std::string& str : stringTable) {
+        profile.writeBytesField(6, str);
+    }
+
+    // period_type = 11, period = 12
+    profile.writeBytesField(11, cpuValueType.data());
+    profile.writeVarintField(12, period);
+
+    return profile.data();
+}
+} // namespace Escargot
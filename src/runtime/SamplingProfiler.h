@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2019-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#ifndef __EscargotSamplingProfiler__
+#define __EscargotSamplingProfiler__
+
+#include <signal.h>
+#include <atomic>
+
+namespace Escargot {
+
+class CodeBlock;
+class ByteCodeBlock;
+class ExecutionState;
+
+#ifndef SAMPLING_PROFILER_MAX_STACK_DEPTH
+#define SAMPLING_PROFILER_MAX_STACK_DEPTH 64
+#endif
+
+#ifndef SAMPLING_PROFILER_RING_BUFFER_SIZE
+#define SAMPLING_PROFILER_RING_BUFFER_SIZE 4096
+#endif
+
+// samples JavaScript call stacks with SIGPROF timer
+// signal handler only requests a sample. interpreter takes the sample at next function entry or backward jump,
+// because program counter of interpreter lives in register and cannot be read from signal handler
+// native function calls take pending sample on entry for the caller and on return for the native function itself
+// samples are stored into ring buffer without allocation, so only the latest SAMPLING_PROFILER_RING_BUFFER_SIZE samples are kept
+// symbolization is done only when the profile is dumped
+// only one profiler can be running in a process
+class SamplingProfiler {
+public:
+    SamplingProfiler();
+    ~SamplingProfiler();
+
+    bool start(size_t intervalInMicroseconds);
+    void stop();
+
+    bool isRunning() const
+    {
+        return s_runningProfiler.load() == this;
+    }
+
+    // returns samples in collapsed stack format ("outermost;...;innermost count" per line)
+    std::string collapsedStacks();
+    // returns samples as uncompressed profile.proto of pprof. `pprof` reads it without gzip
+    std::string pprofProfile();
+
+    static ALWAYS_INLINE bool isSampleRequested()
+    {
+        return s_sampleRequested.load(std::memory_order_relaxed);
+    }
+
+    // byteCodeBlock is nullptr when the innermost frame is native function
+    static void takeSample(ExecutionState& state, ByteCodeBlock* byteCodeBlock, size_t programCounter);
+
+private:
+    struct Sample {
+        ByteCodeBlock* m_byteCodeBlock;
+        size_t m_byteCodePosition;
+        size_t m_depth;
+        // innermost frame first
+        CodeBlock* m_frames[SAMPLING_PROFILER_MAX_STACK_DEPTH];
+    };
+
+    struct SymbolizedFrame {
+        // (program), (anonymous), (unknown) or name of function
+        std::string m_name;
+        // empty for native and unknown frames
+        std::string m_fileName;
+        size_t m_line;
+        bool m_isNative;
+    };
+
+    static void signalHandler(int);
+    void recordSample(ExecutionState& state, ByteCodeBlock* byteCodeBlock, size_t programCounter);
+    // calls fn with frames of each sample, outermost first. ring buffer is cleared after
+    template <typename Fn>
+    void forEachSymbolizedSample(const Fn& fn);
+
+    // written by signal handler, so it should be lock-free
+    static_assert(ATOMIC_INT_LOCK_FREE == 2, "sample request flag should be lock-free");
+    static std::atomic<int> s_sampleRequested;
+    static std::atomic<SamplingProfiler*> s_runningProfiler;
+
+    // allocated as uncollectable memory, so code blocks in samples are alive until symbolized
+    Sample* m_samples;
+    // total count of taken samples. m_samples[m_sampleCount % SAMPLING_PROFILER_RING_BUFFER_SIZE] is written next
+    size_t m_sampleCount;
+    size_t m_intervalInMicroseconds;
+#if defined(OS_POSIX)
+    struct sigaction m_oldSignalAction;
+#endif
+};
+} // namespace Escargot
+
+#endif
@@ -20,6 +20,7 @@
 #include "Escargot.h"
 #include "SandBox.h"
 #include "runtime/Context.h"
+#include "runtime/VMInstance.h"
 #include "runtime/Environment.h"
 #include "runtime/EnvironmentRecord.h"
 #include "parser/Script.h"
@@ -44,19 +45,17 @@ SandBox::SandBoxResult SandBox::run(const std::function<Value()>& scriptRunner)
 
         fillStackDataIntoErrorObject(err);
 
-        for (size_t i = 0; i < m_stackTraceData.size(); i++) {
-            if ((size_t)m_stackTraceData[i].second.loc.index == SIZE_MAX && (size_t)m_stackTraceData[i].second.loc.actualCodeBlock != SIZE_MAX) {
-                // this means loc not computed yet.
-                ExtendedNodeLOC loc = m_stackTraceData[i].second.loc.actualCodeBlock->computeNodeLOCFromByteCode(m_context,
-                                                                                                                 m_stackTraceData[i].second.loc.byteCodePosition, m_stackTraceData[i].second.loc.actualCodeBlock->m_codeBlock);
-                StackTraceData traceData;
-                traceData.loc = loc;
-                traceData.fileName = m_stackTraceData[i].second.loc.actualCodeBlock->m_codeBlock->script()->fileName();
-                traceData.source = m_stackTraceData[i].second.loc.actualCodeBlock->m_codeBlock->script()->src();
-                result.stackTraceData.pushBack(traceData);
+        for (size_t i = 0; i < m_stackTraceFrameCount; i++) {
+            const ErrorObject::StackTraceFrame& frame = m_stackTraceFrames[i].frame;
+            StackTraceData traceData;
+            if (frame.byteCodeBlock) {
+                traceData.loc = frame.byteCodeBlock->computeNodeLOCFromByteCode(frame.byteCodePosition, frame.byteCodeBlock->m_codeBlock);
+                traceData.fileName = frame.byteCodeBlock->m_codeBlock->script()->fileName();
+                traceData.source = frame.byteCodeBlock->m_codeBlock->script()->src();
             } else {
-                result.stackTraceData.pushBack(m_stackTraceData[i].second);
+                traceData.fileName = ErrorObject::StackTraceData::frameInfoString(frame.codeBlock);
             }
+            result.stackTraceData.pushBack(traceData);
         }
     }
     return result;
@@ -68,43 +67,62 @@ void SandBox::throwException(ExecutionState& state, Value exception)
     throw exception;
 }
 
-static Value builtinErrorObjectStackInfo(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
+void SandBox::recordStackTraceFrame(ExecutionContext* ec, CodeBlock* cb, ByteCodeBlock* byteCodeBlock, size_t byteCodePosition)
 {
-    if (!(LIKELY(thisValue.isPointerValue() && thisValue.asPointerValue()->isErrorObject()))) {
-        ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, "get Error.prototype.stack called on incompatible receiver");
+    if (UNLIKELY(!m_stackTraceFrameCount)) {
+        // first frame of new exception. limit could be changed after last exception
+        size_t limit = m_context->vmInstance()->stackTraceDepthLimit();
+        if (UNLIKELY(limit != m_stackTraceFrameCapacity)) {
+            m_stackTraceFrameCapacity = limit;
+            m_stackTraceFrames = limit ? (StackTraceFrame*)GC_MALLOC(sizeof(StackTraceFrame) * limit) : nullptr;
+        }
     }
 
-    ErrorObject* obj = thisValue.asObject()->asErrorObject();
-    if (obj->stackTraceData() == nullptr) {
-        return String::emptyString;
+    if (m_stackTraceFrameCount == m_stackTraceFrameCapacity) {
+        return;
     }
 
-    auto stackTraceData = obj->stackTraceData();
-    StringBuilder builder;
-    stackTraceData->buildStackTrace(state.context(), builder);
-    return builder.finalize();
+    for (size_t i = 0; i < m_stackTraceFrameCount; i++) {
+        if (m_stackTraceFrames[i].executionContext == ec) {
+            return;
+        }
+    }
+
+    StackTraceFrame& f = m_stackTraceFrames[m_stackTraceFrameCount++];
+    f.executionContext = ec;
+    f.frame.codeBlock = cb;
+    f.frame.byteCodeBlock = byteCodeBlock;
+    f.frame.byteCodePosition = byteCodePosition;
 }
 
 ErrorObject::StackTraceData* ErrorObject::StackTraceData::create(SandBox* sandBox)
 {
     ErrorObject::StackTraceData* data = new ErrorObject::StackTraceData();
-    data->gcValues.resizeWithUninitializedValues(sandBox->m_stackTraceData.size());
-    data->nonGCValues.resizeWithUninitializedValues(sandBox->m_stackTraceData.size());
+    data->frames.resizeWithUninitializedValues(sandBox->m_stackTraceFrameCount);
     data->exception = sandBox->m_exception;
 
-    for (size_t i = 0; i < sandBox->m_stackTraceData.size(); i++) {
-        if ((size_t)sandBox->m_stackTraceData[i].second.loc.index == SIZE_MAX && (size_t)sandBox->m_stackTraceData[i].second.loc.actualCodeBlock != SIZE_MAX) {
-            data->gcValues[i].byteCodeBlock = sandBox->m_stackTraceData[i].second.loc.actualCodeBlock;
-            data->nonGCValues[i].byteCodePosition = sandBox->m_stackTraceData[i].second.loc.byteCodePosition;
-        } else {
-            data->gcValues[i].infoString = sandBox->m_stackTraceData[i].second.fileName;
-            data->nonGCValues[i].byteCodePosition = SIZE_MAX;
-        }
+    for (size_t i = 0; i < sandBox->m_stackTraceFrameCount; i++) {
+        data->frames[i] = sandBox->m_stackTraceFrames[i].frame;
     }
 
     return data;
 }
 
+String* ErrorObject::StackTraceData::frameInfoString(CodeBlock* cb)
+{
+    if (cb->isInterpretedCodeBlock() && cb->asInterpretedCodeBlock()->script()) {
+        return cb->asInterpretedCodeBlock()->script()->fileName();
+    }
+
+    StringBuilder builder;
+    builder.appendString("function ");
+    builder.appendString(cb->functionName().string());
+    builder.appendString("() { ");
+    builder.appendString("[native function]");
+    builder.appendString(" } ");
+    return builder.finalize();
+}
+
 void ErrorObject::StackTraceData::buildStackTrace(Context* context, StringBuilder& builder)
 {
     if (exception.isObject()) {
@@ -124,20 +142,20 @@ void ErrorObject::StackTraceData::buildStackTrace(Context* context, StringBuilde
             return Value();
         });
     }
-    for (size_t i = 0; i < gcValues.size(); i++) {
+    for (size_t i = 0; i < frames.size(); i++) {
         builder.appendString("at ");
-        if (nonGCValues[i].byteCodePosition == SIZE_MAX) {
-            builder.appendString(gcValues[i].infoString);
+        ByteCodeBlock* byteCodeBlock = frames[i].byteCodeBlock;
+        if (!byteCodeBlock) {
+            builder.appendString(frameInfoString(frames[i].codeBlock));
         } else {
-            ExtendedNodeLOC loc = gcValues[i].byteCodeBlock->computeNodeLOCFromByteCode(context,
-                                                                                        nonGCValues[i].byteCodePosition, gcValues[i].byteCodeBlock->m_codeBlock);
-            builder.appendString(gcValues[i].byteCodeBlock->m_codeBlock->script()->fileName());
+            ExtendedNodeLOC loc = byteCodeBlock->computeNodeLOCFromByteCode(frames[i].byteCodePosition, byteCodeBlock->m_codeBlock);
+            builder.appendString(byteCodeBlock->m_codeBlock->script()->fileName());
             builder.appendChar(':');
             builder.appendString(String::fromDouble(loc.line));
             builder.appendChar(':');
             builder.appendString(String::fromDouble(loc.column));
 
-            String* src = gcValues[i].byteCodeBlock->m_codeBlock->script()->src();
+            String* src = byteCodeBlock->m_codeBlock->script()->src();
             if (src->length()) {
                 const size_t preLineMax = 40;
                 const size_t afterLineMax = 40;
@@ -186,7 +204,7 @@ void ErrorObject::StackTraceData::buildStackTrace(Context* context, StringBuilde
             }
         }
 
-        if (i != gcValues.size() - 1) {
+        if (i != frames.size() - 1) {
             builder.appendChar('\n');
         }
     }
@@ -199,11 +217,9 @@ void SandBox::fillStackDataIntoErrorObject(const Value& e)
         ErrorObject::StackTraceData* data = ErrorObject::StackTraceData::create(this);
         obj->setStackTraceData(data);
 
+        // getter is shared, and stack string is built only when it is read
         ExecutionState state(m_context);
-        JSGetterSetter gs(
-            new FunctionObject(state, NativeFunctionInfo(m_context->staticStrings().stack, builtinErrorObjectStackInfo, 0, nullptr, NativeFunctionInfo::Strict)),
-            Value(Value::EmptyValue));
-        ObjectPropertyDescriptor desc(gs, ObjectPropertyDescriptor::ConfigurablePresent);
+        ObjectPropertyDescriptor desc(*m_context->globalObject()->errorStackGetterSetterData(), ObjectPropertyDescriptor::ConfigurablePresent);
         obj->defineOwnProperty(state, ObjectPropertyName(m_context->staticStrings().stack), desc);
     }
 }
@@ -28,10 +28,14 @@ namespace Escargot {
 class SandBox : public gc {
     friend class ByteCodeInterpreter;
     friend class ErrorObject;
+    friend class PromiseReactionJob;
 
 public:
     explicit SandBox(Context* s)
         : m_context(s)
+        , m_stackTraceFrames(nullptr)
+        , m_stackTraceFrameCapacity(0)
+        , m_stackTraceFrameCount(0)
     {
         m_context->m_sandBoxStack.pushBack(this);
     }
@@ -54,8 +58,6 @@ public:
         }
     };
 
-    typedef Vector<std::pair<ExecutionContext*, StackTraceData>, GCUtil::gc_malloc_allocator<std::pair<ExecutionContext*, StackTraceData>>> StackTraceDataVector;
-
     struct SandBoxResult {
         Value result;
         Value error;
@@ -79,10 +81,25 @@ public:
 
 protected:
     void fillStackDataIntoErrorObject(const Value& e);
+    // records a frame while exception unwinds. nothing is formatted or allocated here except the frame buffer on first use
+    void recordStackTraceFrame(ExecutionContext* ec, CodeBlock* cb, ByteCodeBlock* byteCodeBlock, size_t byteCodePosition);
+    void clearStackTraceFrames()
+    {
+        m_stackTraceFrameCount = 0;
+    }
 
 private:
+    struct StackTraceFrame {
+        // frames of one function are recorded once, though exception passes several interpreter loops of it
+        ExecutionContext* executionContext;
+        ErrorObject::StackTraceFrame frame;
+    };
+
     Context* m_context;
-    StackTraceDataVector m_stackTraceData;
+    // fixed size buffer of raw frames, sized with stack trace depth limit of VMInstance
+    StackTraceFrame* m_stackTraceFrames;
+    size_t m_stackTraceFrameCapacity;
+    size_t m_stackTraceFrameCount;
     Value m_exception; // To avoid accidential GC of exception value
 };
 }
@@ -653,6 +653,222 @@ uint64_t String::tryToUseAsIndex() const
     return number;
 }
 
+// word-at-a-time hash in the style of wyhash
+// every block of 8 characters is folded into one 64bit word and mixed by a 64x64->128 multiply
+// 16bit strings that contain only latin1 characters must hash to the same value as 8bit strings,
+// so blocks are built from character values instead of raw bytes
+static const uint64_t s_hashSecret0 = 0xa0761d6478bd642fULL;
+static const uint64_t s_hashSecret1 = 0xe7037ed1a0b428dbULL;
+static const uint64_t s_hashSecret2 = 0x8ebc6af09c88c6e3ULL;
+static const uint64_t s_hashSecret3 = 0x589965cc75374cc3ULL;
+
+static ALWAYS_INLINE uint64_t hashMix(uint64_t a, uint64_t b)
+{
+#if defined(__SIZEOF_INT128__)
+    __uint128_t r = (__uint128_t)a * b;
+    return (uint64_t)r ^ (uint64_t)(r >> 64);
+#else
+    uint64_t ha = a >> 32, hb = b >> 32, la = (uint32_t)a, lb = (uint32_t)b;
+    uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    uint64_t t = rl + (rm0 << 32);
+    uint64_t c = t < rl;
+    uint64_t lo = t + (rm1 << 32);
+    c += lo < t;
+    uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+    return lo ^ hi;
+#endif
+}
+
+static ALWAYS_INLINE uint64_t hashReadBlock(const LChar* src, size_t count, bool& isLatin1)
+{
+    uint64_t word = 0;
+#ifdef ESCARGOT_LITTLE_ENDIAN
+    // gcc does not combine the byte loads below into one load, so full blocks are read with memcpy
+    if (LIKELY(count == 8)) {
+        memcpy(&word, src, 8);
+        isLatin1 = true;
+        return word;
+    }
+#endif
+    for (size_t i = 0; i < count; i++) {
+        word |= (uint64_t)src[i] << (i * 8);
+    }
+    isLatin1 = true;
+    return word;
+}
+
+static ALWAYS_INLINE uint64_t hashReadBlock(const char16_t* src, size_t count, bool& isLatin1)
+{
+    char16_t merged = 0;
+    for (size_t i = 0; i < count; i++) {
+        merged |= src[i];
+    }
+
+    uint64_t word = 0;
+    if (LIKELY(merged < 256)) {
+        for (size_t i = 0; i < count; i++) {
+            word |= (uint64_t)src[i] << (i * 8);
+        }
+        isLatin1 = true;
+    } else {
+        for (size_t i = 0; i < count; i++) {
+            word = (word * s_hashSecret3) ^ src[i];
+        }
+        isLatin1 = false;
+    }
+    return word;
+}
+
+template <typename T>
+static uint64_t stringHash(const T* src, size_t length)
+{
+    uint64_t hash = s_hashSecret0 ^ hashMix(length ^ s_hashSecret0, s_hashSecret1);
+    bool isLatin1;
+    while (length >= 8) {
+        uint64_t word = hashReadBlock(src, 8, isLatin1);
+        hash = hashMix(word ^ (isLatin1 ? s_hashSecret1 : s_hashSecret3), hash ^ s_hashSecret2);
+        src += 8;
+        length -= 8;
+    }
+    if (length) {
+        uint64_t word = hashReadBlock(src, length, isLatin1);
+        hash = hashMix(word ^ (isLatin1 ? s_hashSecret1 : s_hashSecret3), hash ^ s_hashSecret2 ^ length);
+    }
+    return hashMix(hash ^ s_hashSecret2, s_hashSecret0);
+}
+
+size_t String::computeHashValue()
+{
+    const auto& data = bufferAccessData();
+    uint64_t hash;
+    if (LIKELY(data.has8BitContent)) {
+        hash = stringHash((const LChar*)data.buffer, data.length);
+    } else {
+        hash = stringHash((const char16_t*)data.buffer, data.length);
+    }
+
+    uint32_t result = (uint32_t)(hash ^ (hash >> 32));
+    // string hash never collides with aligned pointer value(PropertyName uses pointer as hash of Symbol)
+    // this also keeps 0 as "not computed" mark
+    if (UNLIKELY((result % sizeof(size_t)) == 0)) {
+        result++;
+    }
+
+    m_bufferAccessData.cachedHashValue = result;
+    return result;
+}
+
+template <typename T1, typename T2>
+static ALWAYS_INLINE bool equalsCharacters(const T1* a, const T2* b, size_t length)
+{
+    for (size_t i = 0; i < length; i++) {
+        if (a[i] != b[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static ALWAYS_INLINE bool equalsCharacters(const LChar* a, const LChar* b, size_t length)
+{
+    return memcmp(a, b, length) == 0;
+}
+
+static ALWAYS_INLINE bool equalsCharacters(const char16_t* a, const char16_t* b, size_t length)
+{
+    return memcmp(a, b, length * sizeof(char16_t)) == 0;
+}
+
+// returns index of ch in [start, end) or SIZE_MAX
+static ALWAYS_INLINE size_t findCharacter(const LChar* buffer, size_t start, size_t end, char16_t ch)
+{
+    if (ch > 0xFF) {
+        return SIZE_MAX;
+    }
+    const void* found = memchr(buffer + start, ch, end - start);
+    if (found) {
+        return (const LChar*)found - buffer;
+    }
+    return SIZE_MAX;
+}
+
+static ALWAYS_INLINE size_t findCharacter(const char16_t* buffer, size_t start, size_t end, char16_t ch)
+{
+    for (size_t i = start; i < end; i++) {
+        if (buffer[i] == ch) {
+            return i;
+        }
+    }
+    return SIZE_MAX;
+}
+
+// under this size, building skip table of Horspool costs more than it saves
+#define STRING_FIND_HORSPOOL_MIN_NEEDLE_LENGTH 8
+#define STRING_FIND_HORSPOOL_MIN_HAYSTACK_LENGTH 256
+
+template <typename HaystackType, typename NeedleType>
+static size_t findInBuffer(const HaystackType* haystack, size_t haystackLength, const NeedleType* needle, size_t needleLength, size_t pos)
+{
+    ASSERT(needleLength);
+    ASSERT(pos + needleLength <= haystackLength);
+
+    const size_t lastStart = haystackLength - needleLength;
+    if (needleLength < STRING_FIND_HORSPOOL_MIN_NEEDLE_LENGTH || haystackLength - pos < STRING_FIND_HORSPOOL_MIN_HAYSTACK_LENGTH) {
+        // scan first character(memchr for 8bit), then compare rest
+        const char16_t first = needle[0];
+        while (pos <= lastStart) {
+            pos = findCharacter(haystack, pos, lastStart + 1, first);
+            if (pos == SIZE_MAX) {
+                return SIZE_MAX;
+            }
+            if (equalsCharacters(haystack + pos + 1, needle + 1, needleLength - 1)) {
+                return pos;
+            }
+            pos++;
+        }
+        return SIZE_MAX;
+    }
+
+    // Boyer-Moore-Horspool
+    // skip table is indexed by low byte of character,
+    // so characters sharing low byte share the (smallest) shift which is still safe
+    const size_t last = needleLength - 1;
+    size_t skip[256];
+    for (size_t i = 0; i < 256; i++) {
+        skip[i] = needleLength;
+    }
+    for (size_t i = 0; i < last; i++) {
+        skip[needle[i] & 0xFF] = last - i;
+    }
+
+    const NeedleType lastChar = needle[last];
+    while (pos <= lastStart) {
+        HaystackType ch = haystack[pos + last];
+        if (ch == lastChar && equalsCharacters(haystack + pos, needle, last)) {
+            return pos;
+        }
+        pos += skip[ch & 0xFF];
+    }
+    return SIZE_MAX;
+}
+
+template <typename HaystackType, typename NeedleType>
+static size_t reverseFindInBuffer(const HaystackType* haystack, const NeedleType* needle, size_t needleLength, size_t pos)
+{
+    ASSERT(needleLength);
+    const NeedleType first = needle[0];
+    while (true) {
+        if (haystack[pos] == first && equalsCharacters(haystack + pos + 1, needle + 1, needleLength - 1)) {
+            return pos;
+        }
+        if (pos == 0) {
+            break;
+        }
+        pos--;
+    }
+    return SIZE_MAX;
+}
+
 size_t String::find(String* str, size_t pos)
 {
     const size_t srcStrLen = str->length();
@@ -661,40 +877,23 @@ size_t String::find(String* str, size_t pos)
     if (srcStrLen == 0)
         return pos <= size ? pos : SIZE_MAX;
 
-    if (srcStrLen <= size) {
-        char32_t src0 = str->charAt(0);
-        const auto& data = bufferAccessData();
-        if (data.has8BitContent) {
-            for (; pos <= size - srcStrLen; ++pos) {
-                if (((const LChar*)data.buffer)[pos] == src0) {
-                    bool same = true;
-                    for (size_t k = 1; k < srcStrLen; k++) {
-                        if (((const LChar*)data.buffer)[pos + k] != str->charAt(k)) {
-                            same = false;
-                            break;
-                        }
-                    }
-                    if (same)
-                        return pos;
-                }
-            }
-        } else {
-            for (; pos <= size - srcStrLen; ++pos) {
-                if (((const char16_t*)data.buffer)[pos] == src0) {
-                    bool same = true;
-                    for (size_t k = 1; k < srcStrLen; k++) {
-                        if (((const char16_t*)data.buffer)[pos + k] != str->charAt(k)) {
-                            same = false;
-                            break;
-                        }
-                    }
-                    if (same)
-                        return pos;
-                }
-            }
+    if (srcStrLen > size || pos > size - srcStrLen) {
+        return SIZE_MAX;
+    }
+
+    const auto& data = bufferAccessData();
+    const auto& srcData = str->bufferAccessData();
+    if (data.has8BitContent) {
+        if (srcData.has8BitContent) {
+            return findInBuffer((const LChar*)data.buffer, size, (const LChar*)srcData.buffer, srcStrLen, pos);
         }
+        return findInBuffer((const LChar*)data.buffer, size, (const char16_t*)srcData.buffer, srcStrLen, pos);
+    } else {
+        if (srcData.has8BitContent) {
+            return findInBuffer((const char16_t*)data.buffer, size, (const LChar*)srcData.buffer, srcStrLen, pos);
+        }
+        return findInBuffer((const char16_t*)data.buffer, size, (const char16_t*)srcData.buffer, srcStrLen, pos);
     }
-    return SIZE_MAX;
 }
 
 size_t String::rfind(String* str, size_t pos)
@@ -703,23 +902,52 @@ size_t String::rfind(String* str, size_t pos)
     const size_t size = length();
     if (srcStrLen == 0)
         return pos <= size ? pos : -1;
-    if (srcStrLen <= size) {
-        do {
-            bool same = true;
-            if (pos >= size) {
-                continue;
-            }
-            for (size_t k = 0; k < srcStrLen; k++) {
-                if (charAt(pos + k) != str->charAt(k)) {
-                    same = false;
-                    break;
-                }
-            }
-            if (same)
-                return pos;
-        } while (pos-- > 0);
+    if (srcStrLen > size) {
+        return SIZE_MAX;
+    }
+
+    pos = std::min(pos, size - srcStrLen);
+    const auto& data = bufferAccessData();
+    const auto& srcData = str->bufferAccessData();
+    if (data.has8BitContent) {
+        if (srcData.has8BitContent) {
+            return reverseFindInBuffer((const LChar*)data.buffer, (const LChar*)srcData.buffer, srcStrLen, pos);
+        }
+        return reverseFindInBuffer((const LChar*)data.buffer, (const char16_t*)srcData.buffer, srcStrLen, pos);
+    } else {
+        if (srcData.has8BitContent) {
+            return reverseFindInBuffer((const char16_t*)data.buffer, (const LChar*)srcData.buffer, srcStrLen, pos);
+        }
+        return reverseFindInBuffer((const char16_t*)data.buffer, (const char16_t*)srcData.buffer, srcStrLen, pos);
+    }
+}
+
+bool String::isSubstringAt(String* str, size_t pos)
+{
+    const size_t srcStrLen = str->length();
+    const size_t size = length();
+    if (srcStrLen > size || pos > size - srcStrLen) {
+        return false;
+    }
+
+    if (UNLIKELY(m_bufferAccessData.hasSpecialImpl) && isRopeString()) {
+        // checking prefix or suffix of long rope should not flatten whole rope
+        return ((RopeString*)this)->isSubstringAtWithoutFlattening(str, pos);
+    }
+
+    const auto& data = bufferAccessData();
+    const auto& srcData = str->bufferAccessData();
+    if (data.has8BitContent) {
+        if (srcData.has8BitContent) {
+            return equalsCharacters((const LChar*)data.buffer + pos, (const LChar*)srcData.buffer, srcStrLen);
+        }
+        return equalsCharacters((const LChar*)data.buffer + pos, (const char16_t*)srcData.buffer, srcStrLen);
+    } else {
+        if (srcData.has8BitContent) {
+            return equalsCharacters((const char16_t*)data.buffer + pos, (const LChar*)srcData.buffer, srcStrLen);
+        }
+        return equalsCharacters((const char16_t*)data.buffer + pos, (const char16_t*)srcData.buffer, srcStrLen);
     }
-    return SIZE_MAX;
 }
 
 String* String::substring(size_t from, size_t to)
@@ -771,6 +999,7 @@ void* ASCIIString::operator new(size_t size)
     static GC_descr descr;
     if (!typeInited) {
         GC_word obj_bitmap[GC_BITMAP_SIZE(ASCIIString)] = { 0 };
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ASCIIString, m_tag));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ASCIIString, m_bufferAccessData.buffer));
         descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ASCIIString));
         typeInited = true;
@@ -784,6 +1013,7 @@ void* Latin1String::operator new(size_t size)
     static GC_descr descr;
     if (!typeInited) {
         GC_word obj_bitmap[GC_BITMAP_SIZE(Latin1String)] = { 0 };
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(Latin1String, m_tag));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(Latin1String, m_bufferAccessData.buffer));
         descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(Latin1String));
         typeInited = true;
@@ -797,6 +1027,7 @@ void* UTF16String::operator new(size_t size)
     static GC_descr descr;
     if (!typeInited) {
         GC_word obj_bitmap[GC_BITMAP_SIZE(UTF16String)] = { 0 };
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(UTF16String, m_tag));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(UTF16String, m_bufferAccessData.buffer));
         descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(UTF16String));
         typeInited = true;
@@ -68,6 +68,9 @@ class StringView;
 struct StringBufferAccessData {
     bool has8BitContent;
     bool hasSpecialImpl;
+    // 0 means not computed yet. this field lives in the padding after the flags,
+    // so caching the hash does not grow String on 64-bit targets
+    uint32_t cachedHashValue;
     size_t length;
     const void* buffer;
 
@@ -150,12 +153,14 @@ struct StringBufferAccessData {
 
 class String : public PointerValue {
     friend class AtomicString;
+    friend class AtomicStringMap;
 
 public:
     String()
     {
         m_tag = POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA;
         m_bufferAccessData.hasSpecialImpl = false;
+        m_bufferAccessData.cachedHashValue = 0;
     }
 
     virtual bool isString() const
@@ -170,7 +175,8 @@ public:
 
     bool has8BitContent() const
     {
-        return bufferAccessData().has8BitContent;
+        // RopeString keeps this flag valid before flattening
+        return m_bufferAccessData.has8BitContent;
     }
 
     static String* fromASCII(const char* s);
@@ -221,36 +227,21 @@ public:
 
     size_t find(String* str, size_t pos = 0);
     size_t rfind(String* str, size_t pos);
+    // returns true if [pos, pos + str->length()) of this string is same as str
+    bool isSubstringAt(String* str, size_t pos);
 
     String* substring(size_t from, size_t to);
 
-    template <typename T>
-    static inline size_t stringHash(T* src, size_t length)
-    {
-        size_t hash = static_cast<size_t>(0xc70f6907UL);
-        for (; length; --length)
-            hash = (hash * 131) + *src++;
-        return hash;
-    }
-
-    size_t hashValue() const
+    // hash value is computed once and cached in m_bufferAccessData
+    // RopeString shares the cached value of its flattened string
+    // StringView starts with empty cache because its content differs from the original string
+    ALWAYS_INLINE size_t hashValue() const
     {
         const auto& data = bufferAccessData();
-        size_t len = data.length;
-        size_t hash;
-        if (LIKELY(data.has8BitContent)) {
-            auto ptr = (const LChar*)data.buffer;
-            hash = stringHash(ptr, len);
-        } else {
-            auto ptr = (const char16_t*)data.buffer;
-            hash = stringHash(ptr, len);
+        if (LIKELY(data.cachedHashValue)) {
+            return data.cachedHashValue;
         }
-
-        if (UNLIKELY((hash % sizeof(size_t)) == 0)) {
-            hash++;
-        }
-
-        return hash;
+        return const_cast<String*>(this)->computeHashValue();
     }
 
     bool operator==(const String& src) const
@@ -302,9 +293,12 @@ public:
     size_t advanceStringIndex(size_t index, bool unicode);
 
 private:
-    size_t m_tag;
+    NEVER_INLINE size_t computeHashValue();
 
 protected:
+    // subclasses mark m_tag in their GC descriptor
+    // because it can be the only reference to a weak atomic string. see AtomicStringMap
+    size_t m_tag;
     StringBufferAccessData m_bufferAccessData;
     static int stringCompare(size_t l1, size_t l2, const String* c1, const String* c2);
 
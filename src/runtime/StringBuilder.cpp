@@ -24,6 +24,9 @@
 
 namespace Escargot {
 
+// minimum capacity of buffer mode
+#define STRING_BUILDER_BUFFER_MIN_CAPACITY 64
+
 void StringBuilder::appendPiece(String* str, size_t s, size_t e)
 {
     if (e - s > 0) {
@@ -43,7 +46,6 @@ void StringBuilder::appendPiece(String* str, size_t s, size_t e)
             }
 
             if (!has8) {
-                m_has8BitContent = false;
                 piece.m_type = StringBuilderPiece::Type::UTF16StringStringPiece;
             } else {
                 piece.m_type = StringBuilderPiece::Type::UTF16StringStringButLatin1ContentPiece;
@@ -53,11 +55,7 @@ void StringBuilder::appendPiece(String* str, size_t s, size_t e)
             piece.m_type = StringBuilderPiece::Type::Latin1StringPiece;
         }
 
-        m_contentLength += e - s;
-        if (m_piecesInlineStorageUsage < STRING_BUILDER_INLINE_STORAGE_MAX) {
-            m_piecesInlineStorage[m_piecesInlineStorageUsage++] = piece;
-        } else
-            m_pieces.push_back(piece);
+        appendPiece(piece);
     }
 }
 
@@ -69,11 +67,7 @@ void StringBuilder::appendPiece(const char* str)
     piece.m_raw = str;
     piece.m_type = StringBuilderPiece::Type::ConstChar;
     if (piece.m_end) {
-        m_contentLength += piece.m_end;
-        if (m_piecesInlineStorageUsage < STRING_BUILDER_INLINE_STORAGE_MAX) {
-            m_piecesInlineStorage[m_piecesInlineStorageUsage++] = piece;
-        } else
-            m_pieces.push_back(piece);
+        appendPiece(piece);
     }
 }
 
@@ -84,16 +78,132 @@ void StringBuilder::appendPiece(char16_t ch)
     piece.m_end = 1;
     piece.m_ch = ch;
     piece.m_type = StringBuilderPiece::Type::Char;
+    appendPiece(piece);
+}
 
-    if (ch > 255) {
-        m_has8BitContent = false;
+void StringBuilder::appendPiece(const StringBuilderPiece& piece)
+{
+    size_t length = piece.m_end - piece.m_start;
+    if (LIKELY(!m_isBufferMode)) {
+        if (m_piecesInlineStorageUsage < STRING_BUILDER_INLINE_STORAGE_MAX) {
+            if ((piece.m_type == StringBuilderPiece::Char && piece.m_ch > 255) || piece.m_type == StringBuilderPiece::UTF16StringStringPiece) {
+                m_has8BitContent = false;
+            }
+            m_contentLength += length;
+            m_piecesInlineStorage[m_piecesInlineStorageUsage++] = piece;
+            return;
+        }
+        convertIntoBufferMode(length);
     }
 
-    m_contentLength += 1;
-    if (m_piecesInlineStorageUsage < STRING_BUILDER_INLINE_STORAGE_MAX) {
-        m_piecesInlineStorage[m_piecesInlineStorageUsage++] = piece;
-    } else
-        m_pieces.push_back(piece);
+    appendPieceToBuffer(piece);
+}
+
+void StringBuilder::ensureBufferCapacity(size_t requiredLength)
+{
+    if (requiredLength <= m_bufferCapacity) {
+        return;
+    }
+
+    // grow geometrically so appending n characters costs O(n) in total
+    size_t newCapacity = std::max(requiredLength, std::max(m_bufferCapacity * 2, (size_t)STRING_BUILDER_BUFFER_MIN_CAPACITY));
+    if (m_has8BitContent) {
+        LChar* newBuffer = GCUtil::gc_malloc_atomic_ignore_off_page_allocator<LChar>().allocate(newCapacity + 1);
+        if (m_contentLength) {
+            memcpy(newBuffer, m_buffer, m_contentLength);
+        }
+        m_buffer = newBuffer;
+    } else {
+        char16_t* newBuffer = GCUtil::gc_malloc_atomic_ignore_off_page_allocator<char16_t>().allocate(newCapacity + 1);
+        if (m_contentLength) {
+            memcpy(newBuffer, m_buffer, m_contentLength * sizeof(char16_t));
+        }
+        m_buffer = newBuffer;
+    }
+    m_bufferCapacity = newCapacity;
+}
+
+void StringBuilder::widenBuffer()
+{
+    ASSERT(m_has8BitContent);
+    size_t newCapacity = std::max(m_bufferCapacity, (size_t)STRING_BUILDER_BUFFER_MIN_CAPACITY);
+    char16_t* newBuffer = GCUtil::gc_malloc_atomic_ignore_off_page_allocator<char16_t>().allocate(newCapacity + 1);
+    const LChar* src = (const LChar*)m_buffer;
+    for (size_t i = 0; i < m_contentLength; i++) {
+        newBuffer[i] = src[i];
+    }
+    m_buffer = newBuffer;
+    m_bufferCapacity = newCapacity;
+    m_has8BitContent = false;
+}
+
+void StringBuilder::convertIntoBufferMode(size_t lengthToAppend)
+{
+    ASSERT(!m_isBufferMode);
+    size_t pieceCount = m_piecesInlineStorageUsage;
+    size_t contentLength = m_contentLength;
+
+    m_isBufferMode = true;
+    m_piecesInlineStorageUsage = 0;
+    m_contentLength = 0;
+    ensureBufferCapacity(contentLength + lengthToAppend);
+
+    for (size_t i = 0; i < pieceCount; i++) {
+        appendPieceToBuffer(m_piecesInlineStorage[i]);
+    }
+    ASSERT(m_contentLength == contentLength);
+}
+
+void StringBuilder::appendPieceToBuffer(const StringBuilderPiece& piece)
+{
+    ASSERT(m_isBufferMode);
+    if (m_has8BitContent && ((piece.m_type == StringBuilderPiece::Char && piece.m_ch > 255) || piece.m_type == StringBuilderPiece::UTF16StringStringPiece)) {
+        widenBuffer();
+    }
+
+    size_t length = piece.m_end - piece.m_start;
+    ensureBufferCapacity(m_contentLength + length);
+
+    if (m_has8BitContent) {
+        LChar* dst = ((LChar*)m_buffer) + m_contentLength;
+        if (piece.m_type == StringBuilderPiece::Char) {
+            *dst = (LChar)piece.m_ch;
+        } else if (piece.m_type == StringBuilderPiece::ConstChar) {
+            memcpy(dst, piece.m_raw, length);
+        } else {
+            const auto& accessData = piece.m_string->bufferAccessData();
+            if (accessData.has8BitContent) {
+                memcpy(dst, ((const LChar*)accessData.buffer) + piece.m_start, length);
+            } else {
+                const char16_t* src = ((const char16_t*)accessData.buffer) + piece.m_start;
+                for (size_t i = 0; i < length; i++) {
+                    dst[i] = (LChar)src[i];
+                }
+            }
+        }
+    } else {
+        char16_t* dst = ((char16_t*)m_buffer) + m_contentLength;
+        if (piece.m_type == StringBuilderPiece::Char) {
+            *dst = piece.m_ch;
+        } else if (piece.m_type == StringBuilderPiece::ConstChar) {
+            const char* src = piece.m_raw;
+            for (size_t i = 0; i < length; i++) {
+                dst[i] = (LChar)src[i];
+            }
+        } else {
+            const auto& accessData = piece.m_string->bufferAccessData();
+            if (accessData.has8BitContent) {
+                const LChar* src = ((const LChar*)accessData.buffer) + piece.m_start;
+                for (size_t i = 0; i < length; i++) {
+                    dst[i] = src[i];
+                }
+            } else {
+                memcpy(dst, ((const char16_t*)accessData.buffer) + piece.m_start, length * sizeof(char16_t));
+            }
+        }
+    }
+
+    m_contentLength += length;
 }
 
 String* StringBuilder::finalize(ExecutionState* state)
@@ -107,6 +217,29 @@ String* StringBuilder::finalize(ExecutionState* state)
         ErrorObject::throwBuiltinError(*state, ErrorObject::RangeError, errorMessage_String_InvalidStringLength);
     }
 
+    if (m_isBufferMode) {
+        String* ret;
+        if (m_has8BitContent) {
+            ret = new Latin1String(Latin1StringData::adoptBuffer((LChar*)m_buffer, m_contentLength));
+        } else {
+            ret = new UTF16String(UTF16StringData::adoptBuffer((char16_t*)m_buffer, m_contentLength));
+        }
+
+        // buffer is owned by ret now
+        // builder continues with ret as its only piece
+        StringBuilderPiece piece;
+        piece.m_string = ret;
+        piece.m_start = 0;
+        piece.m_end = m_contentLength;
+        piece.m_type = m_has8BitContent ? StringBuilderPiece::Type::Latin1StringPiece : StringBuilderPiece::Type::UTF16StringStringPiece;
+        m_piecesInlineStorage[0] = piece;
+        m_piecesInlineStorageUsage = 1;
+        m_buffer = nullptr;
+        m_bufferCapacity = 0;
+        m_isBufferMode = false;
+        return ret;
+    }
+
     if (m_has8BitContent) {
         Latin1StringData ret;
         ret.resizeWithUninitializedValues(m_contentLength);
@@ -139,33 +272,6 @@ String* StringBuilder::finalize(ExecutionState* state)
             }
         }
 
-        for (size_t i = 0; i < m_pieces.size(); i++) {
-            const StringBuilderPiece& piece = m_pieces[i];
-            if (piece.m_type == StringBuilderPiece::Char) {
-                ret[currentLength++] = (LChar)piece.m_ch;
-            } else if (piece.m_type == StringBuilderPiece::ConstChar) {
-                const char* data = piece.m_raw;
-                size_t l = piece.m_end;
-                memcpy(&ret[currentLength], data, l);
-                currentLength += l;
-            } else {
-                String* data = piece.m_string;
-                size_t s = piece.m_start;
-                size_t e = piece.m_end;
-                size_t l = e - s;
-                const auto& accessData = data->bufferAccessData();
-                if (accessData.has8BitContent) {
-                    memcpy(&ret[currentLength], ((LChar*)accessData.buffer) + s, l);
-                    currentLength += l;
-                } else {
-                    char16_t* b = ((char16_t*)accessData.buffer);
-                    for (size_t k = s; k < e; k++) {
-                        ret[currentLength++] = b[k];
-                    }
-                }
-            }
-        }
-
         return new Latin1String(std::move(ret));
     } else {
         UTF16StringData ret;
@@ -203,37 +309,6 @@ String* StringBuilder::finalize(ExecutionState* state)
             }
         }
 
-        for (size_t i = 0; i < m_pieces.size(); i++) {
-            const StringBuilderPiece& piece = m_pieces[i];
-            if (piece.m_type == StringBuilderPiece::Char) {
-                ret[currentLength++] = piece.m_ch;
-            } else if (piece.m_type == StringBuilderPiece::ConstChar) {
-                const char* data = piece.m_raw;
-                size_t l = piece.m_end;
-                for (size_t j = 0; j < l; j++) {
-                    ret[currentLength++] = data[j];
-                }
-            } else {
-                String* data = piece.m_string;
-                size_t s = piece.m_start;
-                size_t e = piece.m_end;
-                size_t l = e - s;
-                if (data->has8BitContent()) {
-                    auto ptr = data->characters8();
-                    ptr += s;
-                    for (size_t j = 0; j < l; j++) {
-                        ret[currentLength++] = ptr[j];
-                    }
-                } else {
-                    auto ptr = data->characters16();
-                    ptr += s;
-                    for (size_t j = 0; j < l; j++) {
-                        ret[currentLength++] = ptr[j];
-                    }
-                }
-            }
-        }
-
         return new UTF16String(std::move(ret));
     }
 }
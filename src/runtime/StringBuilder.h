@@ -27,6 +27,10 @@ namespace Escargot {
 
 class ExecutionState;
 
+// StringBuilder keeps appended strings as pieces first
+// when pieces overflow inline storage, it switches into buffer mode
+// and copies every content into one growable buffer(8bit first, widened into 16bit when needed)
+// finalize() of buffer mode gives the buffer to the new String without copying
 class StringBuilder {
     MAKE_STACK_ALLOCATED();
     struct StringBuilderPiece {
@@ -49,13 +53,22 @@ class StringBuilder {
     void appendPiece(char16_t ch);
     void appendPiece(const char* str);
     void appendPiece(String* str, size_t s, size_t e);
+    void appendPiece(const StringBuilderPiece& piece);
+
+    void convertIntoBufferMode(size_t lengthToAppend);
+    void appendPieceToBuffer(const StringBuilderPiece& piece);
+    void ensureBufferCapacity(size_t requiredLength);
+    void widenBuffer();
 
 public:
     StringBuilder()
     {
         m_has8BitContent = true;
+        m_isBufferMode = false;
         m_contentLength = 0;
         m_piecesInlineStorageUsage = 0;
+        m_buffer = nullptr;
+        m_bufferCapacity = 0;
     }
 
     size_t contentLength() { return m_contentLength; }
@@ -88,10 +101,13 @@ public:
 
 private:
     bool m_has8BitContent : 1;
+    bool m_isBufferMode : 1;
     size_t m_piecesInlineStorageUsage;
     size_t m_contentLength;
     StringBuilderPiece m_piecesInlineStorage[STRING_BUILDER_INLINE_STORAGE_MAX];
-    Vector<StringBuilderPiece, gc_allocator_ignore_off_page<StringBuilderPiece>, 200> m_pieces;
+    // LChar* or char16_t* by m_has8BitContent. allocated with capacity + 1 for null terminator
+    void* m_buffer;
+    size_t m_bufferCapacity;
 };
 }
 
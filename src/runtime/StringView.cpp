@@ -28,6 +28,7 @@ void* StringView::operator new(size_t size)
     static GC_descr descr;
     if (!typeInited) {
         GC_word obj_bitmap[GC_BITMAP_SIZE(StringView)] = { 0 };
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(StringView, m_tag));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(StringView, m_string));
         descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(StringView));
         typeInited = true;
@@ -41,6 +42,7 @@ void* SourceStringView::operator new(size_t size)
     static GC_descr descr;
     if (!typeInited) {
         GC_word obj_bitmap[GC_BITMAP_SIZE(SourceStringView)] = { 0 };
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(SourceStringView, m_tag));
         descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(SourceStringView));
         typeInited = true;
     }
@@ -24,6 +24,11 @@
 #include "StringObject.h"
 #include "JobQueue.h"
 
+#ifdef ENABLE_ICU
+#include <unicode/basictz.h>
+#include <unicode/tztrans.h>
+#endif
+
 namespace Escargot {
 
 extern size_t g_doubleInSmallValueTag;
@@ -183,8 +188,11 @@ static ObjectPropertyNativeGetterSetterData regexpLastIndexGetterSetterData(
 VMInstance::VMInstance(const char* locale, const char* timezone)
     : m_randEngine((unsigned int)time(NULL))
     , m_didSomePrototypeObjectDefineIndexedProperty(false)
+    , m_didSomeIteratorObjectChangeNextMethod(false)
     , m_compiledByteCodeSize(0)
     , m_cachedUTC(nullptr)
+    , m_samplingProfiler(nullptr)
+    , m_stackTraceDepthLimit(STACK_TRACE_DEPTH_LIMIT_DEFAULT)
 {
     if (!String::emptyString) {
         String::emptyString = new (NoGC) ASCIIString("");
@@ -196,6 +204,12 @@ VMInstance::VMInstance(const char* locale, const char* timezone)
 
 #ifdef ENABLE_ICU
     m_timezone = nullptr;
+    m_localeDateFormat = nullptr;
+    m_localeTimeFormat = nullptr;
+    m_localeCompareCollator = nullptr;
+    m_localeCompareASCIIWeights = nullptr;
+    m_localeCompareLocales = nullptr;
+    m_localeCompareCollatorObject = nullptr;
     if (timezone) {
         m_timezoneID = timezone;
     } else if (getenv("TZ")) {
@@ -343,8 +357,234 @@ void VMInstance::clearCaches()
     m_regexpCache.clear();
     m_cachedUTC = nullptr;
     globalSymbolRegistry().clear();
+#ifdef ENABLE_ICU
+    clearLocaleDateFormats();
+    clearLocaleCompareCollator();
+    m_timezoneOffsetCache.invalidate();
+#endif
+}
+
+#ifdef ENABLE_ICU
+// a local time far from DST transitions maps to only one UTC time
+static const int64_t timezoneOffsetCacheMarginForLocalTime = 24 * 60 * 60 * 1000LL;
+
+void VMInstance::timezoneOffset(int64_t t, bool isLocalTime, int32_t& stdOffset, int32_t& dstOffset, UErrorCode& status)
+{
+    ASSERT(m_timezone);
+    TimezoneOffsetCache& cache = m_timezoneOffsetCache;
+    if (LIKELY(cache.m_start <= cache.m_end)) {
+        if (isLocalTime) {
+            int64_t utc = t - (cache.m_stdOffset + cache.m_dstOffset);
+            if (utc - timezoneOffsetCacheMarginForLocalTime >= cache.m_start && utc + timezoneOffsetCacheMarginForLocalTime < cache.m_end) {
+                stdOffset = cache.m_stdOffset;
+                dstOffset = cache.m_dstOffset;
+                return;
+            }
+        } else if (t >= cache.m_start && t < cache.m_end) {
+            stdOffset = cache.m_stdOffset;
+            dstOffset = cache.m_dstOffset;
+            return;
+        }
+    }
+
+    m_timezone->getOffset((UDate)t, isLocalTime, stdOffset, dstOffset, status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    // every TimeZone created by ICU factory functions is a BasicTimeZone
+    icu::BasicTimeZone* tz = static_cast<icu::BasicTimeZone*>(m_timezone);
+    int64_t utc = isLocalTime ? t - (stdOffset + dstOffset) : t;
+    icu::TimeZoneTransition transition;
+    cache.m_start = std::numeric_limits<int64_t>::min();
+    cache.m_end = std::numeric_limits<int64_t>::max();
+    if (tz->getPreviousTransition((UDate)utc, true, transition)) {
+        cache.m_start = (int64_t)transition.getTime();
+    }
+    if (tz->getNextTransition((UDate)utc, false, transition)) {
+        cache.m_end = (int64_t)transition.getTime();
+    }
+    if (UNLIKELY(utc < cache.m_start || utc >= cache.m_end)) {
+        cache.invalidate();
+        return;
+    }
+    cache.m_stdOffset = stdOffset;
+    cache.m_dstOffset = dstOffset;
+}
+
+icu::DateFormat* VMInstance::localeDateFormat()
+{
+    if (!m_localeDateFormat) {
+        m_localeDateFormat = icu::DateFormat::createDateInstance(icu::DateFormat::MEDIUM, m_locale);
+    }
+    return m_localeDateFormat;
+}
+
+icu::DateFormat* VMInstance::localeTimeFormat()
+{
+    if (!m_localeTimeFormat) {
+        m_localeTimeFormat = icu::DateFormat::createTimeInstance(icu::DateFormat::MEDIUM, m_locale);
+    }
+    return m_localeTimeFormat;
+}
+
+void VMInstance::clearLocaleDateFormats()
+{
+    delete m_localeDateFormat;
+    m_localeDateFormat = nullptr;
+    delete m_localeTimeFormat;
+    m_localeTimeFormat = nullptr;
+}
+
+// ASCII characters have no contractions and expansions in root collation,
+// so comparing their weights character by character gives same result as ICU
+static VMInstance::ASCIICollationWeights* computeASCIICollationWeights(UCollator* collator)
+{
+    int32_t rulesLength = 0;
+    ucol_getRules(collator, &rulesLength);
+    if (rulesLength) {
+        return nullptr;
+    }
+
+    UErrorCode status = U_ZERO_ERROR;
+    if (ucol_getAttribute(collator, UCOL_STRENGTH, &status) != UCOL_TERTIARY
+        || ucol_getAttribute(collator, UCOL_ALTERNATE_HANDLING, &status) != UCOL_NON_IGNORABLE
+        || ucol_getAttribute(collator, UCOL_CASE_FIRST, &status) != UCOL_OFF
+        || ucol_getAttribute(collator, UCOL_CASE_LEVEL, &status) != UCOL_OFF
+        || ucol_getAttribute(collator, UCOL_NUMERIC_COLLATION, &status) != UCOL_OFF
+        || U_FAILURE(status)) {
+        return nullptr;
+    }
+
+    UCollator* root = ucol_open("", &status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+
+    UChar order[128];
+    for (size_t i = 0; i < 128; i++) {
+        order[i] = i;
+    }
+    std::sort(order, order + 128, [root](UChar a, UChar b) -> bool {
+        return ucol_strcoll(root, &a, 1, &b, 1) == UCOL_LESS;
+    });
+
+    auto compare = [root](UCollationStrength strength, const UChar* a, int32_t aLength, const UChar* b, int32_t bLength) -> UCollationResult {
+        ucol_setStrength(root, strength);
+        return ucol_strcoll(root, a, aLength, b, bLength);
+    };
+
+    VMInstance::ASCIICollationWeights* weights = new VMInstance::ASCIICollationWeights;
+    uint8_t primary = 0;
+    uint8_t tertiary = 0;
+    UChar prev = 0;
+    for (size_t i = 0; i < 128; i++) {
+        UChar ch = order[i];
+        if (compare(UCOL_TERTIARY, &ch, 1, &ch, 0) == UCOL_EQUAL) {
+            weights->m_primary[ch] = weights->m_tertiary[ch] = 0;
+            continue;
+        }
+        if (compare(UCOL_PRIMARY, &ch, 1, &ch, 0) == UCOL_EQUAL) {
+            // ignorable only in primary level. this does not happen with ASCII in root collation
+            delete weights;
+            weights = nullptr;
+            break;
+        }
+
+        if (!primary || compare(UCOL_PRIMARY, &prev, 1, &ch, 1) != UCOL_EQUAL) {
+            primary++;
+            tertiary = 0;
+        } else if (compare(UCOL_SECONDARY, &prev, 1, &ch, 1) != UCOL_EQUAL) {
+            // secondary weights of ASCII characters are all same in root collation
+            delete weights;
+            weights = nullptr;
+            break;
+        } else if (compare(UCOL_TERTIARY, &prev, 1, &ch, 1) != UCOL_EQUAL) {
+            tertiary++;
+        }
+        weights->m_primary[ch] = primary;
+        weights->m_tertiary[ch] = tertiary;
+        prev = ch;
+    }
+
+    ucol_close(root);
+    return weights;
+}
+
+UCollator* VMInstance::localeCompareCollator()
+{
+    if (!m_localeCompareCollator) {
+        UErrorCode status = U_ZERO_ERROR;
+        UCollator* collator = ucol_open(m_locale.getName(), &status);
+        if (U_FAILURE(status)) {
+            return nullptr;
+        }
+        // same as default options of Intl.Collator
+        ucol_setAttribute(collator, UCOL_NORMALIZATION_MODE, UCOL_ON, &status);
+        if (U_FAILURE(status)) {
+            ucol_close(collator);
+            return nullptr;
+        }
+        m_localeCompareCollator = collator;
+        m_localeCompareASCIIWeights = computeASCIICollationWeights(collator);
+    }
+    return m_localeCompareCollator;
+}
+
+void VMInstance::clearLocaleCompareCollator()
+{
+    if (m_localeCompareCollator) {
+        ucol_close(m_localeCompareCollator);
+        m_localeCompareCollator = nullptr;
+    }
+    delete m_localeCompareASCIIWeights;
+    m_localeCompareASCIIWeights = nullptr;
+    // default locale is used when the locale string is not supported
+    m_localeCompareLocales = nullptr;
+    m_localeCompareCollatorObject = nullptr;
+}
+
+// every combination of locale and options is rarely used in one program
+#define SHARED_ICU_OBJECT_CACHE_SIZE 32
+
+void* VMInstance::findSharedICUObject(SharedICUObjectKind kind, const std::string& key)
+{
+    auto iter = m_sharedICUObjects[kind].find(key);
+    if (iter != m_sharedICUObjects[kind].end()) {
+        return iter->second;
+    }
+    return nullptr;
+}
+
+bool VMInstance::addSharedICUObject(SharedICUObjectKind kind, const std::string& key, void* object)
+{
+    if (m_sharedICUObjects[kind].size() >= SHARED_ICU_OBJECT_CACHE_SIZE) {
+        return false;
+    }
+    m_sharedICUObjects[kind].insert(std::make_pair(key, object));
+    return true;
 }
 
+void VMInstance::clearSharedICUObjects()
+{
+    for (auto& iter : m_sharedICUObjects[SharedCollator]) {
+        ucol_close((UCollator*)iter.second);
+    }
+    for (auto& iter : m_sharedICUObjects[SharedDateFormat]) {
+        udat_close((UDateFormat*)iter.second);
+    }
+    for (auto& iter : m_sharedICUObjects[SharedDateTimePatternGenerator]) {
+        udatpg_close((UDateTimePatternGenerator*)iter.second);
+    }
+    for (auto& iter : m_sharedICUObjects[SharedNumberFormat]) {
+        unum_close((UNumberFormat*)iter.second);
+    }
+    for (size_t i = 0; i < SharedICUObjectKindCount; i++) {
+        m_sharedICUObjects[i].clear();
+    }
+}
+#endif
+
 void VMInstance::somePrototypeObjectDefineIndexedProperty(ExecutionState& state)
 {
     m_didSomePrototypeObjectDefineIndexedProperty = true;
@@ -394,12 +634,9 @@ Value VMInstance::drainJobQueue()
 {
     ASSERT(!m_jobQueueListener);
 
-    DefaultJobQueue* jobQueue = DefaultJobQueue::get(this->jobQueue());
-    while (jobQueue->hasNextJob()) {
-        auto jobResult = jobQueue->nextJob()->run();
-        if (!jobResult.error.isEmpty())
-            return jobResult.error;
-    }
+    auto jobResult = DefaultJobQueue::get(this->jobQueue())->drainJobs();
+    if (!jobResult.error.isEmpty())
+        return jobResult.error;
     return Value(Value::EmptyValue);
 }
 
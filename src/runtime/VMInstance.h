@@ -28,6 +28,7 @@
 #include "runtime/String.h"
 #include "runtime/Symbol.h"
 #include "runtime/ToStringRecursionPreventer.h"
+#include "runtime/SamplingProfiler.h"
 
 namespace Escargot {
 
@@ -72,13 +73,27 @@ public:
     ~VMInstance()
     {
         clearCaches();
+        delete m_samplingProfiler;
 #ifdef ENABLE_ICU
+        clearSharedICUObjects();
         delete m_timezone;
 #endif
     }
 
     void clearCaches();
 
+    // tableSize(), reclaimedCountInLastSweep() of this map show how atomic strings are reclaimed
+    AtomicStringMap& atomicStringMap()
+    {
+        return m_atomicStringMap;
+    }
+
+    // hitCount(), missCount() of this map show how compiled patterns are reused
+    RegExpCacheMap& regexpCache()
+    {
+        return m_regexpCache;
+    }
+
     const GlobalSymbols& globalSymbols()
     {
         return m_globalSymbols;
@@ -98,6 +113,8 @@ public:
     void setLocale(icu::Locale locale)
     {
         m_locale = locale;
+        clearLocaleDateFormats();
+        clearLocaleCompareCollator();
     }
 
     icu::TimeZone* timezone() const
@@ -116,11 +133,66 @@ public:
             tzset();
             m_timezone = (icu::TimeZone::createTimeZone(m_timezoneID));
         }
+        m_timezoneOffsetCache.invalidate();
     }
     void setTimezoneID(icu::UnicodeString id)
     {
         m_timezoneID = id;
     }
+
+    // same as timezone()->getOffset, but offsets are cached with the interval between DST transitions
+    // so repeated local time computations do not call ICU
+    void timezoneOffset(int64_t t, bool isLocalTime, int32_t& stdOffset, int32_t& dstOffset, UErrorCode& status);
+
+    // formatters for Date.prototype.toLocale[Date|Time]String
+    icu::DateFormat* localeDateFormat();
+    icu::DateFormat* localeTimeFormat();
+
+    // collator for String.prototype.localeCompare called without locales and options
+    UCollator* localeCompareCollator();
+
+    // collation weights of ASCII characters under localeCompareCollator
+    // with these, ASCII strings are compared without calling ICU
+    struct ASCIICollationWeights {
+        // 0 means the character is ignorable
+        uint8_t m_primary[128];
+        uint8_t m_tertiary[128];
+    };
+    // returns nullptr when the collator is tailored or has non-default attributes
+    const ASCIICollationWeights* localeCompareASCIIWeights()
+    {
+        localeCompareCollator();
+        return m_localeCompareASCIIWeights;
+    }
+
+    // Intl.Collator object of the last String.prototype.localeCompare called with a locale string and without options
+    // initialization of the collator reads no user object then, so it is same for same locale string
+    Object* localeCompareCollatorObject(String* locales)
+    {
+        if (m_localeCompareLocales && m_localeCompareLocales->equals(locales)) {
+            return m_localeCompareCollatorObject;
+        }
+        return nullptr;
+    }
+
+    void setLocaleCompareCollatorObject(String* locales, Object* collator)
+    {
+        m_localeCompareLocales = locales;
+        m_localeCompareCollatorObject = collator;
+    }
+
+    // ICU objects shared between Intl objects created with same locale and options
+    // shared objects are owned by VMInstance, so users should not close them
+    enum SharedICUObjectKind {
+        SharedCollator,
+        SharedDateFormat,
+        SharedDateTimePatternGenerator,
+        SharedNumberFormat,
+        SharedICUObjectKindCount
+    };
+    void* findSharedICUObject(SharedICUObjectKind kind, const std::string& key);
+    // returns false when there is no room for new object. then caller keeps ownership of object
+    bool addSharedICUObject(SharedICUObjectKind kind, const std::string& key, void* object);
 #endif
     DateObject* cachedUTC() const
     {
@@ -132,6 +204,31 @@ public:
         m_cachedUTC = d;
     }
 
+    // nullptr until profiler is started once
+    SamplingProfiler* samplingProfiler()
+    {
+        return m_samplingProfiler;
+    }
+
+    SamplingProfiler* ensureSamplingProfiler()
+    {
+        if (!m_samplingProfiler) {
+            m_samplingProfiler = new SamplingProfiler();
+        }
+        return m_samplingProfiler;
+    }
+
+    // maximum number of frames captured into stack trace of thrown error
+    size_t stackTraceDepthLimit() const
+    {
+        return m_stackTraceDepthLimit;
+    }
+
+    void setStackTraceDepthLimit(size_t limit)
+    {
+        m_stackTraceDepthLimit = limit;
+    }
+
     // object
     // []
 
@@ -172,6 +269,16 @@ public:
 
     void somePrototypeObjectDefineIndexedProperty(ExecutionState& state);
 
+    bool didSomeIteratorObjectChangeNextMethod()
+    {
+        return m_didSomeIteratorObjectChangeNextMethod;
+    }
+
+    void someIteratorObjectChangeNextMethod()
+    {
+        m_didSomeIteratorObjectChangeNextMethod = true;
+    }
+
     ToStringRecursionPreventer& toStringRecursionPreventer()
     {
         return m_toStringRecursionPreventer;
@@ -228,6 +335,8 @@ private:
 
     // this flag should affect VM-wide array object
     bool m_didSomePrototypeObjectDefineIndexedProperty : 1;
+    // this flag should affect VM-wide built-in iterator object
+    bool m_didSomeIteratorObjectChangeNextMethod : 1;
 
     ObjectStructure* m_defaultStructureForObject;
     ObjectStructure* m_defaultStructureForFunctionObject;
@@ -263,6 +372,39 @@ private:
     icu::UnicodeString m_timezoneID;
 #endif
     DateObject* m_cachedUTC;
+    SamplingProfiler* m_samplingProfiler;
+    size_t m_stackTraceDepthLimit;
+#ifdef ENABLE_ICU
+    struct TimezoneOffsetCache {
+        TimezoneOffsetCache()
+        {
+            invalidate();
+        }
+
+        void invalidate()
+        {
+            m_start = 1;
+            m_end = 0;
+        }
+
+        // offsets are same in [m_start, m_end) of UTC time
+        int64_t m_start;
+        int64_t m_end;
+        int32_t m_stdOffset;
+        int32_t m_dstOffset;
+    } m_timezoneOffsetCache;
+    icu::DateFormat* m_localeDateFormat;
+    icu::DateFormat* m_localeTimeFormat;
+    UCollator* m_localeCompareCollator;
+    ASCIICollationWeights* m_localeCompareASCIIWeights;
+    String* m_localeCompareLocales;
+    Object* m_localeCompareCollatorObject;
+    std::unordered_map<std::string, void*> m_sharedICUObjects[SharedICUObjectKindCount];
+
+    void clearLocaleDateFormats();
+    void clearLocaleCompareCollator();
+    void clearSharedICUObjects();
+#endif
 
 // promise data
 #if ESCARGOT_ENABLE_PROMISE
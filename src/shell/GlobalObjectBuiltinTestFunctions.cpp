@@ -29,13 +29,8 @@ namespace Escargot {
 #ifdef ESCARGOT_ENABLE_PROMISE
 static Value builtinDrainJobQueue(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
 {
-    DefaultJobQueue* jobQueue = DefaultJobQueue::get(state.context()->jobQueue());
-    while (jobQueue->hasNextJob()) {
-        auto jobResult = jobQueue->nextJob()->run();
-        if (!jobResult.error.isEmpty())
-            return Value(false);
-    }
-    return Value(true);
+    auto jobResult = DefaultJobQueue::get(state.context()->jobQueue())->drainJobs();
+    return Value(jobResult.error.isEmpty());
 }
 
 static Value builtinAddPromiseReactions(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
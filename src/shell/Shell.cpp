@@ -60,13 +60,16 @@ NEVER_INLINE bool eval(Escargot::Context* context, Escargot::String* str, Escarg
 #ifdef ESCARGOT_ENABLE_PROMISE
     Escargot::DefaultJobQueue* jobQueue = Escargot::DefaultJobQueue::get(context->jobQueue());
     while (jobQueue->hasNextJob()) {
-        auto jobResult = jobQueue->nextJob()->run();
-        if (shouldPrintScriptResult) {
-            if (jobResult.error.isEmpty()) {
-                printf("%s\n", jobResult.result.toString(state)->toUTF8StringData().data());
-            } else {
-                printf("Uncaught %s:\n", jobResult.msgStr->toUTF8StringData().data());
-            }
+        if (!shouldPrintScriptResult) {
+            // remained jobs run even if a job throws
+            jobQueue->drainJobs();
+            continue;
+        }
+        auto jobResult = jobQueue->runNextJob();
+        if (jobResult.error.isEmpty()) {
+            printf("%s\n", jobResult.result.toString(state)->toUTF8StringData().data());
+        } else {
+            printf("Uncaught %s:\n", jobResult.msgStr->toUTF8StringData().data());
         }
     }
 #endif
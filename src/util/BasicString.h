@@ -239,6 +239,16 @@ public:
         }
     }
 
+    // buffer should be allocated by Allocator with room for (len + 1) elements
+    static BasicString<T, Allocator> adoptBuffer(T* buffer, size_t len)
+    {
+        BasicString<T, Allocator> ret;
+        buffer[len] = 0;
+        ret.m_buffer = buffer;
+        ret.m_size = len;
+        return ret;
+    }
+
     T* takeBuffer()
     {
         T* buf = m_buffer;
@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2017-present Samsung Electronics Co., Ltd
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+// micro benchmarks for the runtime paths which testapi checks only for correctness.
+// usage: benchmark [name]
+// every benchmark prints the fastest of BENCHMARK_RUN_COUNT runs, or only the named one is run
+
+#include <EscargotPublic.h>
+#include <string.h>
+#include <chrono>
+
+#define BENCHMARK_RUN_COUNT 3
+
+static const char* s_filter;
+
+static bool shouldRun(const char* name)
+{
+    return !s_filter || strstr(name, s_filter);
+}
+
+static long long elapsedMicroseconds(std::chrono::steady_clock::time_point start)
+{
+    return (long long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+// runs source in a fresh SandBox and returns the fastest time. result of the script is compared with expected
+static long long runScript(Escargot::ContextRef* ctx, const char* name, const char* source, double expected)
+{
+    Escargot::ScriptRef* scriptRef = ctx->scriptParser()->parse(Escargot::StringRef::fromASCII(source, strlen(source)), Escargot::StringRef::fromASCII(name, strlen(name))).m_script;
+    long long best = -1;
+    for (size_t i = 0; i < BENCHMARK_RUN_COUNT; i++) {
+        Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+        auto start = std::chrono::steady_clock::now();
+        auto sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+            return scriptRef->execute(state);
+        });
+        long long elapsed = elapsedMicroseconds(start);
+        sb->destroy();
+
+        if (!sandBoxResult.result || !sandBoxResult.result->isNumber() || sandBoxResult.result->asNumber() != expected) {
+            printf("%s: unexpected result\n", name);
+            return -1;
+        }
+        if (best < 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return best;
+}
+
+static void runScriptBenchmark(Escargot::ContextRef* ctx, const char* name, const char* source, double expected)
+{
+    if (!shouldRun(name)) {
+        return;
+    }
+    long long elapsed = runScript(ctx, name, source, expected);
+    if (elapsed >= 0) {
+        printf("%s: %lldus\n", name, elapsed);
+    }
+}
+
+// pieces of SunSpider string-fasta and string-base64
+static void benchmarkStringConcatenation(Escargot::VMInstanceRef* vm, Escargot::ContextRef* ctx)
+{
+    // 10MB string from 10 character pieces, then read both ends
+    runScriptBenchmark(ctx, "string-concat-fasta",
+                       "var s = ''; for (var i = 0; i < 1000000; i++) { s += 'ACGTACGTAC'; } s.charCodeAt(0) + s.charCodeAt(s.length - 1) + (s.endsWith('GTAC') ? s.length : 0)",
+                       65 + 67 + 10000000);
+    // encode rope which is still under construction, one character at a time
+    runScriptBenchmark(ctx, "string-concat-base64",
+                       "var chars = 'ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/'; var src = '';"
+                       "for (var i = 0; i < 8192; i++) { src += String.fromCharCode(25 + i % 100); }"
+                       "var out = ''; for (var i = 0; i < src.length; i += 3) { var n = (src.charCodeAt(i) << 16) | (src.charCodeAt(i + 1) << 8) | src.charCodeAt(i + 2);"
+                       "out += chars.charAt((n >> 18) & 63) + chars.charAt((n >> 12) & 63) + chars.charAt((n >> 6) & 63) + chars.charAt(n & 63); } out.length",
+                       10924);
+}
+
+// every key is a new string, so it is hashed once when it is used as property name
+static void benchmarkStringHash(Escargot::VMInstanceRef* vm, Escargot::ContextRef* ctx)
+{
+    runScriptBenchmark(ctx, "string-hash-short-keys",
+                       "var o = {}; for (var i = 0; i < 1000; i++) { o['k' + i] = i; } var s = 0; for (var i = 0; i < 500000; i++) { s += o['k' + (i % 1000)]; } s",
+                       249750000);
+    runScriptBenchmark(ctx, "string-hash-long-keys",
+                       "var p = 'a long property name prefix to make hashing dominate '; var o = {}; for (var i = 0; i < 1000; i++) { o[p + i] = i; }"
+                       "var s = 0; for (var i = 0; i < 500000; i++) { s += o[p + (i % 1000)]; } s",
+                       249750000);
+    // same keys built from 16-bit pieces which contain only latin1 characters
+    runScriptBenchmark(ctx, "string-hash-wide-keys",
+                       "var p = ('\u0100a long property name prefix to make hashing dominate ').substring(1); var o = {}; for (var i = 0; i < 1000; i++) { o[p + i] = i; }"
+                       "var s = 0; for (var i = 0; i < 500000; i++) { s += o[p + (i % 1000)]; } s",
+                       249750000);
+}
+
+// String::find over a 1MB log-style string, counting every match 20 times
+// the log is built once per run, and searching dominates the time
+#define STRING_FIND_LOG_SOURCE "var log = ''; for (var i = 0; i < 18000; i++) { log += 'INFO worker' + (i % 16) + ' GET /item/' + i + ' request handled in ' + (i % 500) + 'ms\\n'; }" \
+                               "function count(n) { var c = 0; for (var r = 0; r < 20; r++) { for (var p = log.indexOf(n); p !== -1; p = log.indexOf(n, p + 1)) { c++; } } return c; }"
+static void benchmarkStringFind(Escargot::VMInstanceRef* vm, Escargot::ContextRef* ctx)
+{
+    // one character needle, scanned with memchr
+    runScriptBenchmark(ctx, "string-find-newline", STRING_FIND_LOG_SOURCE "count('\\n')", 360000);
+    // absent short needle
+    runScriptBenchmark(ctx, "string-find-absent", STRING_FIND_LOG_SOURCE "count('ERROR')", 0);
+    // long needle, searched with Horspool
+    runScriptBenchmark(ctx, "string-find-long", STRING_FIND_LOG_SOURCE "count('request handled in 499ms')", 720);
+}
+
+// PropertyHandleRef::getProperties against plain ObjectRef::get on 1000 objects of one shape
+static void benchmarkPropertyHandle(Escargot::VMInstanceRef* vm, Escargot::ContextRef* ctx)
+{
+    if (!shouldRun("property-handle")) {
+        return;
+    }
+
+    Escargot::ExecutionStateRef* es = Escargot::ExecutionStateRef::create(ctx);
+    const char* script = "var objs = []; for (var i = 0; i < 1000; i++) objs.push({ id: i, type: 'item', payload: i * 2 }); objs";
+    Escargot::ScriptRef* scriptRef = ctx->scriptParser()->parse(Escargot::StringRef::fromASCII(script, strlen(script)), Escargot::StringRef::fromASCII("PropertyHandle.js")).m_script;
+    Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+    auto sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+        return scriptRef->execute(state);
+    });
+    Escargot::ObjectRef* objs = sandBoxResult.result->asObject();
+    sb->destroy();
+
+    Escargot::PropertyHandleRef* handles[3] = {
+        Escargot::PropertyHandleRef::create(ctx, "id"),
+        Escargot::PropertyHandleRef::create(ctx, "type"),
+        Escargot::PropertyHandleRef::create(ctx, "payload"),
+    };
+    Escargot::ValueRef* names[3] = {
+        Escargot::ValueRef::create(Escargot::StringRef::fromASCII("id")),
+        Escargot::ValueRef::create(Escargot::StringRef::fromASCII("type")),
+        Escargot::ValueRef::create(Escargot::StringRef::fromASCII("payload")),
+    };
+    Escargot::ValueRef* results[3];
+
+    const int rounds = 100;
+    long long plainTime = -1, handleTime = -1;
+    double sumPlain = 0, sumHandle = 0;
+    for (size_t run = 0; run < BENCHMARK_RUN_COUNT; run++) {
+        sumPlain = sumHandle = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < rounds; r++) {
+            for (int i = 0; i < 1000; i++) {
+                Escargot::ObjectRef* o = objs->get(es, Escargot::ValueRef::create(i))->asObject();
+                sumPlain += o->get(es, names[0])->toNumber(es) + o->get(es, names[2])->toNumber(es);
+                o->get(es, names[1]);
+            }
+        }
+        long long elapsed = elapsedMicroseconds(start);
+        plainTime = (plainTime < 0 || elapsed < plainTime) ? elapsed : plainTime;
+
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < rounds; r++) {
+            for (int i = 0; i < 1000; i++) {
+                Escargot::ObjectRef* o = objs->get(es, Escargot::ValueRef::create(i))->asObject();
+                Escargot::PropertyHandleRef::getProperties(es, o, 3, handles, results);
+                sumHandle += results[0]->toNumber(es) + results[2]->toNumber(es);
+            }
+        }
+        elapsed = elapsedMicroseconds(start);
+        handleTime = (handleTime < 0 || elapsed < handleTime) ? elapsed : handleTime;
+    }
+
+    if (sumPlain != sumHandle) {
+        printf("property-handle: unexpected result\n");
+    } else {
+        printf("property-handle: ObjectRef::get %lldus, PropertyHandleRef::getProperties %lldus\n", plainTime, handleTime);
+    }
+
+    for (size_t i = 0; i < 3; i++) {
+        handles[i]->destroy();
+    }
+    es->destroy();
+}
+
+// throw/catch through 20 frames with the default stack trace depth limit and with a small one
+static void benchmarkThrowCatch(Escargot::VMInstanceRef* vm, Escargot::ContextRef* ctx)
+{
+    if (!shouldRun("throw-catch")) {
+        return;
+    }
+
+    const char* script = "function thrower(n) { if (n == 0) throw new Error('e'); return thrower(n - 1); }"
+                         "var caught = 0; for (var i = 0; i < 20000; i++) { try { thrower(20); } catch (e) { caught++; } } caught";
+    size_t oldLimit = vm->stackTraceDepthLimit();
+    size_t limits[2] = { oldLimit, 4 };
+    long long elapsed[2];
+    for (size_t i = 0; i < 2; i++) {
+        vm->setStackTraceDepthLimit(limits[i]);
+        elapsed[i] = runScript(ctx, "throw-catch", script, 20000);
+    }
+    vm->setStackTraceDepthLimit(oldLimit);
+
+    if (elapsed[0] >= 0 && elapsed[1] >= 0) {
+        printf("throw-catch: depth limit %zu %lldus, depth limit %zu %lldus\n", limits[0], elapsed[0], limits[1], elapsed[1]);
+    }
+}
+
+// cost of the sampling profiler. the target of the profiler is under 2% at the default 1ms interval
+static void benchmarkSamplingProfiler(Escargot::VMInstanceRef* vm, Escargot::ContextRef* ctx)
+{
+    if (!shouldRun("sampling-profiler")) {
+        return;
+    }
+
+    const char* script = "function hot(n) { var s = 0; var i = 0; do { s += i % 7; } while (++i < n); return s; }"
+                         "var r = 0; for (var j = 0; j < 200; j++) r += hot(100000); r";
+    double expected = 0;
+    for (int i = 0; i < 100000; i++) {
+        expected += i % 7;
+    }
+    expected *= 200;
+
+    size_t intervals[3] = { 0, 1000, 100 };
+    long long elapsed[3];
+    for (size_t i = 0; i < 3; i++) {
+        if (intervals[i]) {
+            vm->startSamplingProfiler(intervals[i]);
+        }
+        elapsed[i] = runScript(ctx, "sampling-profiler", script, expected);
+        if (intervals[i]) {
+            vm->stopSamplingProfiler();
+        }
+    }
+
+    if (elapsed[0] > 0 && elapsed[1] >= 0 && elapsed[2] >= 0) {
+        printf("sampling-profiler: without profiler %lldus, 1000us interval %lldus (%+.1f%%), 100us interval %lldus (%+.1f%%)\n",
+               elapsed[0], elapsed[1], (elapsed[1] - elapsed[0]) * 100.0 / elapsed[0], elapsed[2], (elapsed[2] - elapsed[0]) * 100.0 / elapsed[0]);
+    }
+}
+
+// identifiers of functions which use eval are resolved by name
+static void benchmarkByNameResolution(Escargot::VMInstanceRef* vm, Escargot::ContextRef* ctx)
+{
+    // a few loads in each of many activations. every activation should hit the cache of the first one
+    runScriptBenchmark(ctx, "by-name-resolution-activations",
+                       "function f(n) { eval(''); var a = n, b = 1; return a + b + a * b; } var s = 0; for (var i = 0; i < 200000; i++) { s += f(i); } s",
+                       40000000000.0);
+    // many loads and stores in one activation
+    runScriptBenchmark(ctx, "by-name-resolution-loop",
+                       "function g() { eval(''); var s = 0; for (var i = 0; i < 1000000; i++) { s += i & 7; } return s; } g()",
+                       3500000);
+}
+
+// same eval and Function constructor source in a loop, against sources which miss the compiled eval cache
+static void benchmarkRepeatedEval(Escargot::VMInstanceRef* vm, Escargot::ContextRef* ctx)
+{
+    runScriptBenchmark(ctx, "eval-repeated",
+                       "function f(a, b) { return eval('a + b * 2'); } var s = 0; for (var i = 0; i < 100000; i++) { s += f(i, 1); } s",
+                       5000150000.0);
+    // 1024 sources cycle through the cache, so every eval parses its source
+    runScriptBenchmark(ctx, "eval-distinct",
+                       "var s = 0; for (var i = 0; i < 100000; i++) { s += eval('i + ' + (i & 1023)); } s",
+                       5050981728.0);
+    runScriptBenchmark(ctx, "function-constructor-repeated",
+                       "var s = 0; for (var i = 0; i < 100000; i++) { s += new Function('a', 'return a * 2')(i); } s",
+                       9999900000.0);
+}
+
+// for-of over built-in iterators against indexed loop on the same array
+static void benchmarkIteration(Escargot::VMInstanceRef* vm, Escargot::ContextRef* ctx)
+{
+    runScriptBenchmark(ctx, "iteration-indexed-for",
+                       "var a = []; for (var i = 0; i < 100000; i++) { a.push(i & 7); } var s = 0; for (var j = 0; j < 20; j++) { for (var i = 0; i < a.length; i++) { s += a[i]; } } s",
+                       7000000);
+    runScriptBenchmark(ctx, "iteration-for-of",
+                       "var a = []; for (var i = 0; i < 100000; i++) { a.push(i & 7); } var s = 0; for (var j = 0; j < 20; j++) { for (var v of a) { s += v; } } s",
+                       7000000);
+    runScriptBenchmark(ctx, "iteration-spread",
+                       "var a = []; for (var i = 0; i < 100000; i++) { a.push(i & 7); } var s = 0; for (var j = 0; j < 20; j++) { s += [...a].length; } s",
+                       2000000);
+
+    if (shouldRun("iteration-for-of-changed-next")) {
+        // changing next method of any iterator disables direct advancing for whole VMInstance, so it runs on its own one
+        Escargot::VMInstanceRef* changedVM = Escargot::VMInstanceRef::create();
+        Escargot::ContextRef* changedCtx = Escargot::ContextRef::create(changedVM);
+        runScriptBenchmark(changedCtx, "iteration-for-of-changed-next",
+                           "var a = []; for (var i = 0; i < 100000; i++) { a.push(i & 7); } var it = a[Symbol.iterator](); it.next = it.next;"
+                           "var s = 0; for (var j = 0; j < 20; j++) { for (var v of a) { s += v; } } s",
+                           7000000);
+        changedCtx->destroy();
+        changedVM->destroy();
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc > 1) {
+        s_filter = argv[1];
+    }
+
+    Escargot::Globals::initialize();
+    Escargot::VMInstanceRef* vm = Escargot::VMInstanceRef::create();
+    Escargot::ContextRef* ctx = Escargot::ContextRef::create(vm);
+
+    benchmarkStringConcatenation(vm, ctx);
+    benchmarkStringHash(vm, ctx);
+    benchmarkStringFind(vm, ctx);
+    benchmarkPropertyHandle(vm, ctx);
+    benchmarkThrowCatch(vm, ctx);
+    benchmarkSamplingProfiler(vm, ctx);
+    benchmarkByNameResolution(vm, ctx);
+    benchmarkRepeatedEval(vm, ctx);
+    benchmarkIteration(vm, ctx);
+
+    ctx->destroy();
+    vm->destroy();
+
+    Escargot::Globals::finalize();
+
+    return 0;
+}
@@ -16,6 +16,7 @@
 
 #include <EscargotPublic.h>
 #include <string.h>
+#include <stdlib.h>
 
 #define CHECK(name, cond) \
     printf(name" | %s\n", (cond) ? "pass" : "fail");
@@ -110,6 +111,474 @@ int main(int argc, char* argv[])
         = jsmath->toObject(es)->get(es, Escargot::ValueRef::create(Escargot::StringRef::fromASCII("PI")));
     printf("Math.PI = %f\n", jspi->toNumber(es));
 
+    // external string test
+    {
+        static const char latin1Source[] = "external\xe9";
+        Escargot::StringRef* latin1 = Escargot::StringRef::fromExternalLatin1((const unsigned char*)latin1Source, 9, nullptr, nullptr);
+        CHECK("External Latin1 string 1", latin1->length() == 9 && latin1->charAt(8) == 0xe9);
+        CHECK("External Latin1 string 2", latin1->stringBufferAccessData().buffer == latin1Source);
+
+        static const char asciiSource[] = "external";
+        Escargot::StringRef* ascii = Escargot::StringRef::fromExternalUTF8(asciiSource, 8, nullptr, nullptr);
+        CHECK("External UTF-8 string 1", ascii->equals(Escargot::StringRef::fromASCII("external")));
+        CHECK("External UTF-8 string 2", ascii->stringBufferAccessData().buffer == asciiSource);
+
+        static const char utf8Source[] = "\xea\xb0\x80a";
+        Escargot::StringRef* utf8 = Escargot::StringRef::fromExternalUTF8(utf8Source, 4, nullptr, nullptr);
+        CHECK("External UTF-8 string 3", utf8->length() == 2 && utf8->charAt(0) == 0xac00 && utf8->charAt(1) == 'a');
+
+        static const char16_t utf16Source[] = u"\xac00" u"b";
+        Escargot::StringRef* utf16 = Escargot::StringRef::fromExternalUTF16(utf16Source, 2, nullptr, nullptr);
+        CHECK("External UTF-16 string 1", utf16->length() == 2 && utf16->charAt(0) == 0xac00 && utf16->charAt(1) == 'b');
+    }
+
+    // external string release test
+    {
+        static const char releaseSource[] = "external string released by GC";
+        static const size_t releaseStringCount = 1000;
+        static unsigned releaseCount[releaseStringCount + 1];
+        static bool isReleasedBufferValid;
+        memset(releaseCount, 0, sizeof(releaseCount));
+        isReleasedBufferValid = true;
+        auto onRelease = [](void* buffer, void* callbackData) {
+            isReleasedBufferValid = isReleasedBufferValid && buffer == releaseSource;
+            releaseCount[(size_t)callbackData]++;
+        };
+
+        // index 0 is kept alive from JavaScript, the others become unreachable at once
+        Escargot::StringRef* kept = Escargot::StringRef::fromExternalLatin1((const unsigned char*)releaseSource, sizeof(releaseSource) - 1, onRelease, (void*)0);
+        globalObject->set(es, Escargot::ValueRef::create(Escargot::StringRef::fromASCII("keptExternalString")), Escargot::ValueRef::create(kept));
+        for (size_t i = 1; i <= releaseStringCount; i++) {
+            Escargot::StringRef::fromExternalLatin1((const unsigned char*)releaseSource, sizeof(releaseSource) - 1, onRelease, (void*)i);
+        }
+
+        auto runGC = [&]() {
+            const char* gcScript = "gc(); gc();";
+            Escargot::ScriptRef* scriptRef = ctx->scriptParser()->parse(Escargot::StringRef::fromASCII(gcScript, strlen(gcScript)), Escargot::StringRef::fromASCII("ExternalString.js")).m_script;
+            Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+            sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+                return scriptRef->execute(state);
+            });
+            sb->destroy();
+        };
+        auto countReleased = [&](bool& isReleasedOnce) -> size_t {
+            size_t released = 0;
+            isReleasedOnce = true;
+            for (size_t i = 1; i <= releaseStringCount; i++) {
+                released += releaseCount[i] ? 1 : 0;
+                isReleasedOnce = isReleasedOnce && releaseCount[i] <= 1;
+            }
+            return released;
+        };
+
+        // GC is conservative, so some strings can be kept by stale stack slots
+        runGC();
+        bool isReleasedOnce;
+        size_t released = countReleased(isReleasedOnce);
+        CHECK("External string release 1", released >= releaseStringCount / 2 && isReleasedOnce && isReleasedBufferValid);
+        CHECK("External string release 2", releaseCount[0] == 0 && kept->equals(Escargot::StringRef::fromASCII(releaseSource)));
+
+        // finalizer is unregistered after it runs, so later GCs do not call the callback again
+        runGC();
+        size_t releasedAgain = countReleased(isReleasedOnce);
+        CHECK("External string release 3", releasedAgain >= released && isReleasedOnce && releaseCount[0] == 0);
+        globalObject->set(es, Escargot::ValueRef::create(Escargot::StringRef::fromASCII("keptExternalString")), Escargot::ValueRef::createUndefined());
+    }
+
+    // string hash test
+    {
+        // atomic strings are looked up by hash, so equal 8-bit and 16-bit strings must hash equally
+        static const char latin1Source[] = "string hash key with latin1 \xe9 and a tail";
+        const size_t length = sizeof(latin1Source) - 1;
+        static char16_t utf16Source[sizeof(latin1Source)];
+        for (size_t i = 0; i < length; i++) {
+            utf16Source[i] = (unsigned char)latin1Source[i];
+        }
+
+        bool is16Bit = true;
+        bool isSameAtomicString = true;
+        for (size_t len = 0; len <= length; len++) {
+            Escargot::StringRef* latin1 = Escargot::StringRef::fromExternalLatin1((const unsigned char*)latin1Source, len, nullptr, nullptr);
+            Escargot::StringRef* utf16 = Escargot::StringRef::fromExternalUTF16(utf16Source, len, nullptr, nullptr);
+            is16Bit = is16Bit && !utf16->stringBufferAccessData().has8BitContent;
+            isSameAtomicString = isSameAtomicString && Escargot::AtomicStringRef::create(ctx, latin1)->string() == Escargot::AtomicStringRef::create(ctx, utf16)->string();
+        }
+        CHECK("String hash 1", is16Bit);
+        CHECK("String hash 2", isSameAtomicString);
+
+        // rope of 16-bit and 8-bit pieces
+        globalObject->set(es, Escargot::ValueRef::create(Escargot::StringRef::fromASCII("hashTestWide")), Escargot::ValueRef::create(Escargot::StringRef::fromExternalUTF16(utf16Source, length, nullptr, nullptr)));
+        const char* script = "hashTestWide.substring(0, 20) + hashTestWide.substring(20)";
+        Escargot::ScriptRef* scriptRef = ctx->scriptParser()->parse(Escargot::StringRef::fromASCII(script, strlen(script)), Escargot::StringRef::fromASCII("StringHash.js")).m_script;
+        Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+        auto sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+            return scriptRef->execute(state);
+        });
+        Escargot::StringRef* latin1 = Escargot::StringRef::fromExternalLatin1((const unsigned char*)latin1Source, length, nullptr, nullptr);
+        CHECK("String hash 3", sandBoxResult.result->isString() && Escargot::AtomicStringRef::create(ctx, sandBoxResult.result->asString())->string() == Escargot::AtomicStringRef::create(ctx, latin1)->string());
+        sb->destroy();
+    }
+
+    // string find test
+    {
+        // external strings keep the representation they are made with, so short 16-bit strings can have Latin1 content
+        // every combination of 8-bit and 16-bit haystack and needle is compared with a naive search
+        static char latin1Source[300];
+        static char16_t utf16Source[300];
+        unsigned seed = 7;
+        for (size_t i = 0; i < sizeof(latin1Source); i++) {
+            seed = seed * 1103515245 + 12345;
+            latin1Source[i] = "aab\xe9"[(seed >> 16) % 4];
+            utf16Source[i] = (unsigned char)latin1Source[i];
+        }
+
+        Escargot::ArrayObjectRef* haystacks = Escargot::ArrayObjectRef::create(es);
+        Escargot::ArrayObjectRef* needles = Escargot::ArrayObjectRef::create(es);
+        Escargot::StringRef* utf16Haystack = nullptr;
+        Escargot::StringRef* utf16Needle = nullptr;
+        // haystack lengths around the Horspool threshold(256)
+        for (size_t length = 250, index = 0; length <= 262; length += 4) {
+            utf16Haystack = Escargot::StringRef::fromExternalUTF16(utf16Source, length, nullptr, nullptr);
+            haystacks->set(es, Escargot::ValueRef::create(index++), Escargot::ValueRef::create(Escargot::StringRef::fromExternalLatin1((const unsigned char*)latin1Source, length, nullptr, nullptr)));
+            haystacks->set(es, Escargot::ValueRef::create(index++), Escargot::ValueRef::create(utf16Haystack));
+        }
+        // needle lengths around the Horspool threshold(8), taken from haystack content so every needle is found
+        for (size_t length = 1, index = 0; length <= 16; length++) {
+            size_t at = 100 + length * 7;
+            utf16Needle = Escargot::StringRef::fromExternalUTF16(utf16Source + at, length, nullptr, nullptr);
+            needles->set(es, Escargot::ValueRef::create(index++), Escargot::ValueRef::create(Escargot::StringRef::fromExternalLatin1((const unsigned char*)latin1Source + at, length, nullptr, nullptr)));
+            needles->set(es, Escargot::ValueRef::create(index++), Escargot::ValueRef::create(utf16Needle));
+        }
+        globalObject->set(es, Escargot::ValueRef::create(Escargot::StringRef::fromASCII("findHaystacks")), Escargot::ValueRef::create(haystacks));
+        globalObject->set(es, Escargot::ValueRef::create(Escargot::StringRef::fromASCII("findNeedles")), Escargot::ValueRef::create(needles));
+
+        const char* script = "function naiveIndexOf(h, n, pos) { for (var i = pos; i + n.length <= h.length; i++) { var j = 0; while (j < n.length && h.charCodeAt(i + j) === n.charCodeAt(j)) { j++; } if (j === n.length) { return i; } } return -1; }"
+                             "function naiveLastIndexOf(h, n) { var last = -1; for (var i = naiveIndexOf(h, n, 0); i !== -1; i = naiveIndexOf(h, n, i + 1)) { last = i; } return last; }"
+                             "var mismatch = 0; for (var i = 0; i < findHaystacks.length; i++) { var h = findHaystacks[i]; for (var j = 0; j < findNeedles.length; j++) { var n = findNeedles[j];"
+                             "for (var pos = 0; pos < h.length; pos += 13) { if (h.indexOf(n, pos) !== naiveIndexOf(h, n, pos)) { mismatch++; } }"
+                             "if (h.lastIndexOf(n) !== naiveLastIndexOf(h, n)) { mismatch++; } } } mismatch";
+        Escargot::ScriptRef* scriptRef = ctx->scriptParser()->parse(Escargot::StringRef::fromASCII(script, strlen(script)), Escargot::StringRef::fromASCII("StringFind.js")).m_script;
+        Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+        auto sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+            return scriptRef->execute(state);
+        });
+        CHECK("String find 1", !utf16Haystack->stringBufferAccessData().has8BitContent && !utf16Needle->stringBufferAccessData().has8BitContent);
+        CHECK("String find 2", sandBoxResult.result && sandBoxResult.result->isNumber() && sandBoxResult.result->asNumber() == 0);
+        sb->destroy();
+        globalObject->set(es, Escargot::ValueRef::create(Escargot::StringRef::fromASCII("findHaystacks")), Escargot::ValueRef::createUndefined());
+        globalObject->set(es, Escargot::ValueRef::create(Escargot::StringRef::fromASCII("findNeedles")), Escargot::ValueRef::createUndefined());
+    }
+
+    // weak atomic string test
+    {
+        auto run = [&](const char* script) -> Escargot::ValueRef* {
+            Escargot::ScriptRef* scriptRef = ctx->scriptParser()->parse(Escargot::StringRef::fromASCII(script, strlen(script)), Escargot::StringRef::fromASCII("AtomicString.js")).m_script;
+            Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+            auto sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+                return scriptRef->execute(state);
+            });
+            sb->destroy();
+            return sandBoxResult.result;
+        };
+
+        // every lookup with a new string key interns the key weakly
+        auto before = vm->atomicStringTableStatistics();
+        run("var o = {}; for (var i = 0; i < 20000; i++) { o.hasOwnProperty('weakname' + i); }");
+        auto inserted = vm->atomicStringTableStatistics();
+        // entries only leave the weak set by sweep, or by promotion which does not happen here
+        CHECK("Weak atomic string insert", inserted.weakEntryCount + (inserted.totalReclaimedCount - before.totalReclaimedCount) >= before.weakEntryCount + 20000);
+
+        // GC is conservative, so some keys can be kept by stale stack slots
+        run("gc(); gc();");
+        auto collected = vm->atomicStringTableStatistics();
+        CHECK("Weak atomic string reclaim", collected.totalReclaimedCount - before.totalReclaimedCount >= 10000);
+        CHECK("Weak atomic string reclaim count", collected.reclaimedCountInLastSweep > 0 && collected.reclaimedCountInLastSweep <= collected.totalReclaimedCount - inserted.totalReclaimedCount);
+        CHECK("Weak atomic string weak entry count", collected.weakEntryCount + (collected.totalReclaimedCount - inserted.totalReclaimedCount) == inserted.weakEntryCount);
+
+        // strong path finds the weak entry and promotes it, instead of interning another string
+        Escargot::ValueRef* key = run("var promotedKey = 'promoted' + 'name' + 1; o.hasOwnProperty(promotedKey); promotedKey");
+        auto weak = vm->atomicStringTableStatistics();
+        Escargot::AtomicStringRef* promoted = Escargot::AtomicStringRef::create(ctx, "promotedname1");
+        auto strong = vm->atomicStringTableStatistics();
+        size_t sweptMeanwhile = strong.totalReclaimedCount - weak.totalReclaimedCount;
+        CHECK("Weak atomic string promotion 1", promoted->string() == key->asString());
+        CHECK("Weak atomic string promotion 2", strong.weakEntryCount + sweptMeanwhile == weak.weakEntryCount - 1 && strong.tableSize + sweptMeanwhile == weak.tableSize);
+
+        // promoted entry is strong, so it stays after the last reference from JavaScript is dropped
+        run("promotedKey = undefined; gc(); gc();");
+        vm->atomicStringTableStatistics();
+        CHECK("Weak atomic string promotion 3", Escargot::AtomicStringRef::create(ctx, "promotedname1")->string() == promoted->string());
+    }
+
+    // regexp cache test
+    {
+        auto run = [&](const char* script) -> Escargot::ValueRef* {
+            Escargot::ScriptRef* scriptRef = ctx->scriptParser()->parse(Escargot::StringRef::fromASCII(script, strlen(script)), Escargot::StringRef::fromASCII("RegExpCache.js")).m_script;
+            Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+            auto sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+                return scriptRef->execute(state);
+            });
+            sb->destroy();
+            return sandBoxResult.result;
+        };
+        char script[128];
+        auto compile = [&](size_t index) {
+            snprintf(script, sizeof(script), "regexpCacheTarget.compile('lru%zu');", index);
+            run(script);
+        };
+
+        // compile() looks up exactly one pattern, so the cache only sees the patterns below
+        run("var regexpCacheTarget = /x/; for (var i = 0; i < 1000; i++) { regexpCacheTarget.compile('lru' + i); }");
+        auto filled = vm->regexpCacheStatistics();
+        run("for (var i = 1000; i < 2000; i++) { regexpCacheTarget.compile('lru' + i); }");
+        auto refilled = vm->regexpCacheStatistics();
+        CHECK("RegExp cache size", filled.size > 1 && filled.size < 1000 && refilled.size == filled.size);
+
+        // cache holds the last filled.size patterns; touching the oldest one moves it to the front
+        size_t oldest = 2000 - filled.size;
+        compile(oldest);
+        auto touched = vm->regexpCacheStatistics();
+        CHECK("RegExp cache hit", touched.hitCount == refilled.hitCount + 1 && touched.missCount == refilled.missCount);
+
+        // so the next insertion evicts the second oldest pattern instead
+        compile(2000);
+        compile(oldest);
+        auto kept = vm->regexpCacheStatistics();
+        CHECK("RegExp cache LRU 1", kept.hitCount == touched.hitCount + 1 && kept.missCount == touched.missCount + 1);
+        compile(oldest + 1);
+        auto evicted = vm->regexpCacheStatistics();
+        CHECK("RegExp cache LRU 2", evicted.hitCount == kept.hitCount && evicted.missCount == kept.missCount + 1);
+
+        // literal keeps its compiled pattern after the first evaluation
+        run("function regexpLiteralSite() { return /literal+site/g; } regexpLiteralSite();");
+        auto literal = vm->regexpCacheStatistics();
+        run("for (var i = 0; i < 1000; i++) { regexpLiteralSite().test('literalllsite'); }");
+        auto reused = vm->regexpCacheStatistics();
+        CHECK("RegExp cache literal site", reused.hitCount == literal.hitCount && reused.missCount == literal.missCount);
+    }
+
+    // compiled eval cache test
+    {
+        auto run = [&](const char* script) -> Escargot::ValueRef* {
+            Escargot::ScriptRef* scriptRef = ctx->scriptParser()->parse(Escargot::StringRef::fromASCII(script, strlen(script)), Escargot::StringRef::fromASCII("EvalCache.js")).m_script;
+            Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+            auto sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+                return scriptRef->execute(state);
+            });
+            sb->destroy();
+            return sandBoxResult.result;
+        };
+
+        // same source has an entry per caller code block, and later calls of each caller hit it
+        auto before = ctx->compiledEvalCacheStatistics();
+        Escargot::ValueRef* result = run("var evalA = 1, evalB = 2; function evalInSloppy(evalA) { return eval('evalA + evalB'); } function evalInStrict(evalA) { 'use strict'; return eval('evalA + evalB'); }"
+                                         "var s = 0; for (var i = 0; i < 10; i++) { s += evalInSloppy(i) + evalInStrict(i * 2) + eval('evalA + evalB'); } s");
+        auto repeated = ctx->compiledEvalCacheStatistics();
+        CHECK("Compiled eval cache result", result && result->isNumber() && result->asNumber() == 205);
+        CHECK("Compiled eval cache hit", repeated.missCount == before.missCount + 3 && repeated.hitCount == before.hitCount + 27);
+
+        // generating more bytecode than FUNCTION_OBJECT_BYTECODE_SIZE_MAX flushes function bytecode and the cache
+        // sources of these functions are too long to be cached, so nothing is inserted after the last flush
+        run("var evalFlushBody = ''; for (var i = 0; i < 200; i++) { evalFlushBody += 'x = x * 3 + ' + i + ' & 65535; '; }"
+            "for (var j = 0; j < 2000; j++) { new Function('var x = ' + j + '; ' + evalFlushBody + 'return x;')(); }");
+        auto flushed = ctx->compiledEvalCacheStatistics();
+        CHECK("Compiled eval cache flush 1", flushed.size == 0);
+
+        result = run("evalInSloppy(5)");
+        auto refilled = ctx->compiledEvalCacheStatistics();
+        CHECK("Compiled eval cache flush 2", result && result->isNumber() && result->asNumber() == 7 && refilled.missCount == flushed.missCount + 1 && refilled.size == 1);
+    }
+
+    // fast native function test
+    {
+        Escargot::FunctionObjectRef::FastNativeFunctionInfo info(Escargot::AtomicStringRef::create(ctx, "fastAdd"), [](Escargot::ExecutionStateRef* state, Escargot::ValueRef* thisValue, const Escargot::FunctionObjectRef::FastNativeFunctionArguments& arguments) -> Escargot::ValueRef* {
+            return Escargot::ValueRef::create(arguments[0]->toNumber(state) + arguments[1]->toNumber(state) + (arguments[2]->isUndefined() ? 0 : 100));
+        }, 2);
+        Escargot::FunctionObjectRef* fn = Escargot::FunctionObjectRef::createFastNativeFunction(es, info);
+        globalObject->set(es, Escargot::ValueRef::create(Escargot::StringRef::fromASCII("fastAdd")), Escargot::ValueRef::create(fn));
+
+        const char* script = "fastAdd(1, 2) + fastAdd.call(null, 3, 4)";
+        Escargot::ScriptRef* scriptRef = ctx->scriptParser()->parse(Escargot::StringRef::fromASCII(script, strlen(script)), Escargot::StringRef::fromASCII("FastNative.js")).m_script;
+        Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+        auto sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+            return scriptRef->execute(state);
+        });
+        CHECK("Fast native function 1", sandBoxResult.result->toNumber(es) == 10);
+        sb->destroy();
+    }
+
+    // PropertyHandleRef test
+    {
+        const char* script = "var objs = []; for (var i = 0; i < 100; i++) objs.push({ id: i, type: 'item', payload: i * 2 }); objs";
+        Escargot::ScriptRef* scriptRef = ctx->scriptParser()->parse(Escargot::StringRef::fromASCII(script, strlen(script)), Escargot::StringRef::fromASCII("PropertyHandle.js")).m_script;
+        Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+        auto sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+            return scriptRef->execute(state);
+        });
+        Escargot::ObjectRef* objs = sandBoxResult.result->asObject();
+        sb->destroy();
+
+        Escargot::PropertyHandleRef* handles[3] = {
+            Escargot::PropertyHandleRef::create(ctx, "id"),
+            Escargot::PropertyHandleRef::create(ctx, "type"),
+            Escargot::PropertyHandleRef::create(ctx, "payload"),
+        };
+        Escargot::ValueRef* names[3] = {
+            Escargot::ValueRef::create(Escargot::StringRef::fromASCII("id")),
+            Escargot::ValueRef::create(Escargot::StringRef::fromASCII("type")),
+            Escargot::ValueRef::create(Escargot::StringRef::fromASCII("payload")),
+        };
+
+        Escargot::ObjectRef* first = objs->get(es, Escargot::ValueRef::create(0))->asObject();
+        CHECK("PropertyHandleRef get 1", handles[0]->get(es, first)->toNumber(es) == 0);
+        CHECK("PropertyHandleRef set 1", handles[2]->set(es, first, Escargot::ValueRef::create(7)) && handles[2]->get(es, first)->toNumber(es) == 7);
+        Escargot::ValueRef* results[3];
+        Escargot::PropertyHandleRef::getProperties(es, objs->get(es, Escargot::ValueRef::create(10))->asObject(), 3, handles, results);
+        CHECK("PropertyHandleRef getProperties 1", results[0]->toNumber(es) == 10 && results[2]->toNumber(es) == 20);
+
+        // handles cache the property offset per structure. every object must still agree with ObjectRef::get
+        bool same = true;
+        for (int i = 1; i < 100; i++) {
+            Escargot::ObjectRef* o = objs->get(es, Escargot::ValueRef::create(i))->asObject();
+            Escargot::PropertyHandleRef::getProperties(es, o, 3, handles, results);
+            same = same && results[0]->toNumber(es) == o->get(es, names[0])->toNumber(es);
+            same = same && results[1]->toString(es)->equals(o->get(es, names[1])->toString(es));
+            same = same && results[2]->toNumber(es) == o->get(es, names[2])->toNumber(es);
+        }
+        CHECK("PropertyHandleRef getProperties 2", same);
+
+        for (size_t i = 0; i < 3; i++) {
+            handles[i]->destroy();
+        }
+    }
+
+    // string concatenation test (pieces of SunSpider string-fasta and string-base64). test/cctest/benchmark.cpp times them
+    {
+        const char* scripts[2] = {
+            // 10MB string from 10 character pieces, then read both ends
+            "var s = ''; for (var i = 0; i < 1000000; i++) { s += 'ACGTACGTAC'; } s.charCodeAt(0) + s.charCodeAt(s.length - 1) + (s.endsWith('GTAC') ? s.length : 0)",
+            // encode rope which is still under construction, one character at a time
+            "var chars = 'ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/'; var src = '';"
+            "for (var i = 0; i < 8192; i++) { src += String.fromCharCode(25 + i % 100); }"
+            "var out = ''; for (var i = 0; i < src.length; i += 3) { var n = (src.charCodeAt(i) << 16) | (src.charCodeAt(i + 1) << 8) | src.charCodeAt(i + 2);"
+            "out += chars.charAt((n >> 18) & 63) + chars.charAt((n >> 12) & 63) + chars.charAt((n >> 6) & 63) + chars.charAt(n & 63); } out.length",
+        };
+        double expected[2] = { 65 + 67 + 10000000, 10924 };
+        for (size_t i = 0; i < 2; i++) {
+            Escargot::ScriptRef* scriptRef = ctx->scriptParser()->parse(Escargot::StringRef::fromASCII(scripts[i], strlen(scripts[i])), Escargot::StringRef::fromASCII("StringConcat.js")).m_script;
+            Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+            auto sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+                return scriptRef->execute(state);
+            });
+            sb->destroy();
+            CHECK("String concatenation result", sandBoxResult.result->toNumber(es) == expected[i]);
+        }
+    }
+
+    // sampling profiler test
+    {
+        // do-while loop is closed with conditional jump. time in JSON functions should be charged to native frames
+        const char* script = "function hot(n) { var s = 0; var i = 0; do { s += i % 7; } while (++i < n); return s; }"
+                             "function json(a) { for (var k = 0; k < 200; k++) JSON.parse(JSON.stringify(a)); }"
+                             "var a = []; for (var i = 0; i < 20000; i++) a.push(i);"
+                             "for (var j = 0; j < 200; j++) hot(100000); json(a);";
+        Escargot::ScriptRef* scriptRef = ctx->scriptParser()->parse(Escargot::StringRef::fromASCII(script, strlen(script)), Escargot::StringRef::fromASCII("Profile.js")).m_script;
+        auto runScript = [&]() {
+            Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+            sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+                return scriptRef->execute(state);
+            });
+            sb->destroy();
+        };
+
+        CHECK("Sampling profiler start", vm->startSamplingProfiler(100));
+        CHECK("Sampling profiler start twice", !vm->startSamplingProfiler(100));
+        runScript();
+        std::string stacks = vm->stopSamplingProfiler();
+        CHECK("Sampling profiler stop twice", vm->stopSamplingProfiler().empty());
+
+        // every line is "frame;...;frame count". a timer signal is not guaranteed in one run,
+        // so the script is run again until some samples are taken
+        bool wellFormed = true;
+        size_t sampleCount = 0;
+        bool hasHotFrame = false;
+        bool hasNativeFrame = false;
+        for (size_t attempt = 0; attempt < 10 && !(hasHotFrame && hasNativeFrame); attempt++) {
+            if (attempt) {
+                vm->startSamplingProfiler(100);
+                runScript();
+                stacks = vm->stopSamplingProfiler();
+            }
+            size_t lineStart = 0;
+            while (lineStart < stacks.length()) {
+                size_t lineEnd = stacks.find('\n', lineStart);
+                size_t countStart = stacks.rfind(' ', lineEnd);
+                if (lineEnd == std::string::npos || countStart == std::string::npos || countStart <= lineStart || countStart + 1 == lineEnd
+                    || strspn(stacks.c_str() + countStart + 1, "0123456789") != lineEnd - countStart - 1) {
+                    wellFormed = false;
+                    break;
+                }
+                sampleCount += strtoul(stacks.c_str() + countStart + 1, nullptr, 10);
+                std::string stack = stacks.substr(lineStart, countStart - lineStart);
+                hasHotFrame = hasHotFrame || stack == "(program) (Profile.js:1);hot (Profile.js:1)";
+                hasNativeFrame = hasNativeFrame || stack == "(program) (Profile.js:1);json (Profile.js:1);stringify (native)" || stack == "(program) (Profile.js:1);json (Profile.js:1);parse (native)";
+                lineStart = lineEnd + 1;
+            }
+        }
+        CHECK("Sampling profiler collapsed stacks format", wellFormed);
+        CHECK("Sampling profiler samples", sampleCount > 0);
+        CHECK("Sampling profiler collapsed stacks", hasHotFrame);
+        CHECK("Sampling profiler native frame", hasNativeFrame);
+
+        // profile.proto always begins with sample_type field(1, length-delimited)
+        vm->startSamplingProfiler(100);
+        runScript();
+        std::string pprof = vm->stopSamplingProfiler(Escargot::VMInstanceRef::PProf);
+        CHECK("Sampling profiler pprof", pprof.length() && pprof[0] == 0x0a);
+    }
+
+    // stack trace depth limit test
+    {
+        const char* script = "function deep(n) {\n"
+                             "    if (n == 0)\n"
+                             "        throw new Error('deep');\n"
+                             "    deep(n - 1);\n"
+                             "}\n"
+                             "deep(100);";
+        Escargot::ScriptRef* scriptRef = ctx->scriptParser()->parse(Escargot::StringRef::fromASCII(script, strlen(script)), Escargot::StringRef::fromASCII("StackTrace.js")).m_script;
+        size_t oldLimit = vm->stackTraceDepthLimit();
+        vm->setStackTraceDepthLimit(10);
+        Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+        auto sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+            return scriptRef->execute(state);
+        });
+        sb->destroy();
+        CHECK("Stack trace depth limit", sandBoxResult.error.hasValue() && sandBoxResult.stackTraceData.size() == 10);
+        CHECK("Stack trace innermost frame", sandBoxResult.stackTraceData.size() > 1 && sandBoxResult.stackTraceData[0].loc.line == 3 && sandBoxResult.stackTraceData[0].loc.column == 9);
+        CHECK("Stack trace caller frame", sandBoxResult.stackTraceData.size() > 1 && sandBoxResult.stackTraceData[1].loc.line == 4 && sandBoxResult.stackTraceData[1].loc.column == 5);
+
+        // limit changed after the first throw applies to the next throw of the same SandBox
+        const char* catchScript = "try { deep(100); } catch (e) { }";
+        Escargot::ScriptRef* catchScriptRef = ctx->scriptParser()->parse(Escargot::StringRef::fromASCII(catchScript, strlen(catchScript)), Escargot::StringRef::fromASCII("StackTraceCatch.js")).m_script;
+        sb = Escargot::SandBoxRef::create(ctx);
+        sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+            catchScriptRef->execute(state);
+            vm->setStackTraceDepthLimit(3);
+            return scriptRef->execute(state);
+        });
+        sb->destroy();
+        CHECK("Stack trace depth limit change", sandBoxResult.error.hasValue() && sandBoxResult.stackTraceData.size() == 3);
+
+        vm->setStackTraceDepthLimit(0);
+        sb = Escargot::SandBoxRef::create(ctx);
+        sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+            return scriptRef->execute(state);
+        });
+        sb->destroy();
+        CHECK("Stack trace depth limit zero", sandBoxResult.error.hasValue() && sandBoxResult.stackTraceData.size() == 0);
+        vm->setStackTraceDepthLimit(oldLimit);
+    }
+
     // custom function & NativeDataAccessorProperty & virtal-id test & ExposableObject test
     {
         Escargot::FunctionObjectRef::NativeFunctionInfo info(Escargot::AtomicStringRef::create(ctx, "Custom"), [](Escargot::ExecutionStateRef* state, Escargot::ValueRef* thisValue, size_t argc, Escargot::ValueRef** argv, bool isNewExpression) -> Escargot::ValueRef* {
@@ -0,0 +1,166 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// arrays with large gaps are kept in sparse element store
+
+(function TestLargeIndexWrite() {
+    var a = [];
+    a[4294967294] = "last";
+    a[100000000] = "middle";
+    a[3] = "first";
+
+    assert(a.length === 4294967295);
+    assert(a[3] === "first");
+    assert(a[100000000] === "middle");
+    assert(a[4294967294] === "last");
+    assert(a[4] === undefined);
+    assert(!(4 in a));
+
+    // 2^32 - 1 is not an array index
+    a[4294967295] = "not index";
+    assert(a.length === 4294967295);
+    assert(a[4294967295] === "not index");
+
+    a[100000000] = "overwritten";
+    assert(a[100000000] === "overwritten");
+})();
+
+(function TestLengthTruncation() {
+    var a = [];
+    a[200000000] = 2;
+    a[100000000] = 1;
+    a[5] = 0;
+
+    a.length = 100000001;
+    assert(a.length === 100000001);
+    assert(!(200000000 in a));
+    assert(a[100000000] === 1);
+
+    a.length = 100000000;
+    assert(!(100000000 in a));
+    assert(a[5] === 0);
+
+    a.length = 0;
+    assert(!(5 in a));
+    assert(Object.keys(a).length === 0);
+
+    // non-configurable element stops truncation
+    var b = [];
+    b[100000000] = 1;
+    b[60] = 2;
+    Object.defineProperty(b, 50, { value: "fixed", enumerable: true, configurable: false });
+    b.length = 0;
+    assert(b.length === 51);
+    assert(b[50] === "fixed");
+    assert(!(60 in b));
+    assert(!(100000000 in b));
+    assertThrows(function () {
+        "use strict";
+        b.length = 0;
+    });
+})();
+
+(function TestDelete() {
+    var a = [];
+    a[100000000] = 1;
+    a[10] = 2;
+
+    assert(delete a[100000000]);
+    assert(!(100000000 in a));
+    assert(a.length === 100000001);
+    assert(delete a[100000000]);
+    assert(a[10] === 2);
+
+    Object.defineProperty(a, 20, { value: 3, configurable: false });
+    assert(!delete a[20]);
+    assert(a[20] === 3);
+    assertThrows(function () {
+        "use strict";
+        delete a[20];
+    });
+})();
+
+(function TestKeysOrder() {
+    var a = [];
+    a[100000000] = 1;
+    a[7] = 2;
+    a.foo = 3;
+    a[3] = 4;
+
+    var keys = Object.keys(a);
+    assert(keys.length === 4);
+    assert(keys[0] === "3");
+    assert(keys[1] === "7");
+    assert(keys[2] === "100000000");
+    assert(keys[3] === "foo");
+
+    var forInKeys = [];
+    for (var k in a) {
+        forInKeys.push(k);
+    }
+    assert(forInKeys.join() === "3,7,100000000,foo");
+
+    delete a[7];
+    assert(Object.keys(a).join() === "3,100000000,foo");
+})();
+
+(function TestKeysOrderWithNonDefaultAttributes() {
+    var a = [];
+    a[100000000] = 1;
+    a[30] = 2;
+    a.foo = 3;
+    // elements with non-default attributes are stored apart from the others
+    Object.defineProperty(a, 50, { value: 4, writable: false, enumerable: true, configurable: true });
+    Object.defineProperty(a, 10, { value: 5, writable: true, enumerable: true, configurable: false });
+    Object.defineProperty(a, 40, { value: 6, enumerable: false, writable: true, configurable: true });
+    a[20] = 7;
+
+    assert(Object.keys(a).join() === "10,20,30,50,100000000,foo");
+    assert(Object.getOwnPropertyNames(a).join() === "10,20,30,40,50,100000000,length,foo");
+
+    var forInKeys = [];
+    for (var k in a) {
+        forInKeys.push(k);
+    }
+    assert(forInKeys.join() === "10,20,30,50,100000000,foo");
+})();
+
+(function TestKeysAfterLengthChange() {
+    var a = [];
+    a[100000000] = 1;
+    a[5] = 2;
+    a[10] = 3;
+
+    function forInKeys() {
+        var keys = [];
+        for (var k in a) {
+            keys.push(k);
+        }
+        return keys.join();
+    }
+    assert(forInKeys() === "5,10,100000000");
+    assert(Object.keys(a).join() === "5,10,100000000");
+
+    // elements are removed at once
+    a.length = 8;
+    assert(forInKeys() === "5");
+    assert(Object.keys(a).join() === "5");
+    assert(!(10 in a));
+    assert(a[10] === undefined);
+
+    a.length = 0;
+    assert(forInKeys() === "");
+    assert(a.length === 0);
+})();
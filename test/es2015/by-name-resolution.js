@@ -0,0 +1,125 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// LoadByName/StoreByName cache is shared by every activation with the same scope shape
+
+var shadowed = "global";
+
+(function TestActivationsShareCache() {
+    function f(n, useEval) {
+        var local = n;
+        if (useEval) {
+            eval("var shadowed = 'local' + n");
+        } else {
+            eval("");
+        }
+        var read = function () {
+            return shadowed + ":" + local;
+        };
+        return read();
+    }
+    for (var i = 0; i < 20; i++) {
+        var withEval = (i % 3 == 1);
+        assert(f(i, withEval) === (withEval ? "local" + i : "global") + ":" + i);
+    }
+})();
+
+(function TestEvalShadowsCachedBinding() {
+    function f() {
+        eval("");
+        var result = [];
+        for (var i = 0; i < 3; i++) {
+            result.push(shadowed);
+            if (i == 1) {
+                eval("var shadowed = 'eval'");
+            }
+        }
+        return result.join();
+    }
+    for (var i = 0; i < 5; i++) {
+        assert(f() === "global,global,eval");
+    }
+})();
+
+(function TestDeleteEvalBinding() {
+    function f() {
+        eval("var a = 1; var b = 2; var c = 3");
+        var before = a + b + c;
+        delete a;
+        var after = b + c;
+        var cleared = typeof a;
+        c = 30;
+        return before + "," + after + "," + cleared + "," + c;
+    }
+    for (var i = 0; i < 5; i++) {
+        assert(f() === "6,5,undefined,30");
+    }
+})();
+
+(function TestWithObjectGainsProperty() {
+    function f(o) {
+        var value = "outer";
+        eval("");
+        var result = [];
+        with (o) {
+            for (var i = 0; i < 4; i++) {
+                result.push(value);
+                if (i == 1) {
+                    o.value = "object";
+                }
+            }
+            value = "stored";
+        }
+        return result.join() + "," + value + "," + o.value;
+    }
+    for (var i = 0; i < 5; i++) {
+        assert(f({}) === "outer,outer,object,object,outer,stored");
+    }
+})();
+
+(function TestClosuresOfDifferentActivations() {
+    function make(n) {
+        var count = n;
+        eval("");
+        return function () {
+            return ++count;
+        };
+    }
+    var a = make(0);
+    var b = make(100);
+    for (var i = 0; i < 5; i++) {
+        a();
+        b();
+    }
+    assert(a() === 6);
+    assert(b() === 106);
+})();
+
+(function TestDeepScopeChain() {
+    function f(x) {
+        eval("");
+        return (function () {
+            return (function () {
+                return (function () {
+                    eval("");
+                    return x + shadowed;
+                })();
+            })();
+        })();
+    }
+    for (var i = 0; i < 5; i++) {
+        assert(f(i) === i + "global");
+    }
+})();
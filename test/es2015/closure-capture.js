@@ -0,0 +1,153 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// captured parameters and locals live in the heap slots of the function record
+
+(function TestParametersAndLocals() {
+    function outer(a, b) {
+        var c = a + b;
+        var d = 0;
+        var get = () => a + b + c + d;
+        var set = (x) => { a = x; d++; };
+        return [get, set];
+    }
+
+    var first = outer(1, 2);
+    var second = outer(10, 20);
+    assert(first[0]() === 6);
+    assert(second[0]() === 60);
+    first[1](5);
+    // each activation has its own slots
+    assert(first[0]() === 11);
+    assert(second[0]() === 60);
+})();
+
+(function TestNestedArrows() {
+    function outer(p) {
+        var local = p * 2;
+        return (q) => {
+            var inner = q + local;
+            return (r) => (s) => p + local + inner + q + r + s;
+        };
+    }
+
+    var f = outer(1);
+    assert(f(10)(100)(1000) === 1 + 2 + 12 + 10 + 100 + 1000);
+    assert(f(20)(200)(2000) === 1 + 2 + 22 + 20 + 200 + 2000);
+    assert(outer(3)(0)(0)(0) === 3 + 6 + 6);
+})();
+
+(function TestManySlots() {
+    function outer(a0, a1, a2, a3, a4, a5, a6, a7) {
+        var l0 = a0 * 10, l1 = a1 * 10, l2 = a2 * 10, l3 = a3 * 10, l4 = a4 * 10, l5 = a5 * 10, l6 = a6 * 10, l7 = a7 * 10;
+        return () => [a0, a1, a2, a3, a4, a5, a6, a7, l0, l1, l2, l3, l4, l5, l6, l7].join();
+    }
+
+    var closures = [];
+    for (var i = 0; i < 100; i++) {
+        closures.push(outer(i, i + 1, i + 2, i + 3, i + 4, i + 5, i + 6, i + 7));
+    }
+    if (typeof gc === "function") {
+        gc();
+    }
+    for (var i = 0; i < 100; i++) {
+        var expected = [];
+        for (var j = 0; j < 8; j++) {
+            expected.push(i + j);
+        }
+        for (var j = 0; j < 8; j++) {
+            expected.push((i + j) * 10);
+        }
+        assert(closures[i]() === expected.join());
+    }
+})();
+
+(function TestArgumentsObject() {
+    function outer(a, b) {
+        var get = () => a + b;
+        arguments[0] = 10;
+        b = 20;
+        return [get(), arguments[0], arguments[1]];
+    }
+
+    assert(outer(1, 2).join() === "30,10,20");
+})();
+
+(function TestEvalInFunction() {
+    function outer(a) {
+        var b = a + 1;
+        eval("var c = a + b;");
+        var get = () => a + b + c;
+        a = 10;
+        return get;
+    }
+
+    assert(outer(1)() === 10 + 2 + 3);
+})();
+
+(function TestEvalCreatesClosure() {
+    function outer(a) {
+        var b = a * 2;
+        return eval("(x) => a + b + x");
+    }
+
+    var f = outer(1);
+    var g = outer(5);
+    assert(f(100) === 103);
+    assert(g(100) === 115);
+})();
+
+(function TestEvalInArrow() {
+    function outer(a) {
+        var b = 2;
+        var arrow = (x) => eval("a + b + x");
+        var setA = (v) => eval("a = v");
+        return [arrow, setA];
+    }
+
+    var pair = outer(1);
+    assert(pair[0](10) === 13);
+    pair[1](7);
+    assert(pair[0](10) === 19);
+})();
+
+(function TestNestedFunctionsAndEval() {
+    function level1(a) {
+        var x = a;
+        function level2(b) {
+            var y = b;
+            function level3(c) {
+                return eval("x + y + c");
+            }
+            return level3;
+        }
+        return level2;
+    }
+
+    assert(level1(1)(2)(3) === 6);
+    assert(level1(100)(20)(3) === 123);
+})();
+
+(function TestStrictEval() {
+    "use strict";
+    function outer(a) {
+        var b = a + 1;
+        eval("var b = 100;");
+        return () => eval("a + b");
+    }
+
+    // strict eval has its own variable environment
+    assert(outer(1)() === 3);
+})();
@@ -0,0 +1,162 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// eval code is cached per source and caller code block, and reused on later calls
+// every case runs the same source more than once, so later results come from the cache
+
+var a = 1, b = 2;
+
+(function TestGlobalAndIndirect() {
+    for (var i = 0; i < 3; i++) {
+        assert(eval("a+b") === 3);
+        assert((0, eval)("a+b") === 3);
+    }
+    a = 10;
+    assert(eval("a+b") === 12);
+    assert((0, eval)("a+b") === 12);
+    a = 1;
+})();
+
+(function TestDifferentScopes() {
+    function f(a, b) {
+        return eval("a+b");
+    }
+    function g() {
+        var a = "x", b = "y";
+        return eval("a+b");
+    }
+    function h(b) {
+        return eval("a+b");
+    }
+    for (var i = 0; i < 3; i++) {
+        assert(f(i, 10) === i + 10);
+        assert(g() === "xy");
+        assert(h(100) === 101);
+        assert(eval("a+b") === 3);
+    }
+    // closures of one function see their own bindings
+    function make(a) {
+        return function(b) {
+            return eval("a+b");
+        };
+    }
+    var add5 = make(5), add7 = make(7);
+    for (var i = 0; i < 3; i++) {
+        assert(add5(i) === 5 + i);
+        assert(add7(i) === 7 + i);
+    }
+})();
+
+(function TestDynamicScopes() {
+    // with and catch scopes change between calls of the same code block
+    function withScope(o) {
+        with (o) {
+            return eval("a+b");
+        }
+    }
+    function catchScope(e) {
+        try {
+            throw e;
+        } catch (a) {
+            return eval("a+b");
+        }
+    }
+    for (var i = 0; i < 3; i++) {
+        assert(withScope({ a: i }) === i + 2);
+        assert(withScope({ b: i }) === 1 + i);
+        assert(withScope({}) === 3);
+        assert(catchScope(i * 10) === i * 10 + 2);
+    }
+})();
+
+(function TestStrictMode() {
+    // sloppy eval declares var in caller, strict eval keeps it in eval code
+    function sloppy() {
+        eval("var declared = a + b");
+        return declared;
+    }
+    function strict() {
+        "use strict";
+        eval("var declared = a + b");
+        return typeof declared;
+    }
+    function strictSource() {
+        eval("'use strict'; var declared = a + b");
+        return typeof declared;
+    }
+    for (var i = 0; i < 3; i++) {
+        assert(sloppy() === 3);
+        assert(strict() === "undefined");
+        assert(strictSource() === "undefined");
+        assert(typeof declared === "undefined");
+    }
+
+    // this of eval code follows caller
+    function thisOfSloppy() {
+        return eval("this");
+    }
+    function thisOfStrict() {
+        "use strict";
+        return eval("this");
+    }
+    var o = {};
+    for (var i = 0; i < 3; i++) {
+        assert(thisOfSloppy.call(o) === o);
+        assert(thisOfStrict.call(o) === o);
+        assert(thisOfStrict() === undefined);
+        assert(thisOfSloppy() === this);
+    }
+})();
+
+(function TestDeclarationsAndArguments() {
+    // functions declared by eval code are new objects on every call
+    function declare() {
+        eval("function inner() { return a + b; }");
+        return inner;
+    }
+    var first = declare(), second = declare();
+    assert(first !== second);
+    assert(first() === 3 && second() === 3);
+
+    function args() {
+        return eval("arguments.length + arguments[0]");
+    }
+    for (var i = 0; i < 3; i++) {
+        assert(args(i) === 1 + i);
+        assert(args(i, i) === 2 + i);
+    }
+
+    // errors are thrown again on every evaluation
+    for (var i = 0; i < 3; i++) {
+        var thrown = false;
+        try {
+            eval("a+");
+        } catch (e) {
+            thrown = e instanceof SyntaxError;
+        }
+        assert(thrown);
+        assert(eval("a+b") === 3);
+    }
+})();
+
+(function TestFunctionConstructor() {
+    for (var i = 0; i < 3; i++) {
+        var add = new Function("a", "b", "return a+b");
+        var sum = new Function("return a+b");
+        assert(add(i, 1) === i + 1);
+        assert(sum() === 3);
+        assert(add !== new Function("a", "b", "return a+b"));
+    }
+})();
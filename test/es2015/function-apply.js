@@ -0,0 +1,97 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Function.prototype.apply copies arguments objects and fast mode arrays directly,
+// and falls back to generic element lookups when they are modified
+
+function collect() {
+    return Array.prototype.slice.call(arguments).join();
+}
+
+function count() {
+    return arguments.length;
+}
+
+(function TestIntactArguments() {
+    function f(a, b) {
+        a = "mapped";
+        return collect.apply(null, arguments);
+    }
+    assert(f(1, 2, 3) === "mapped,2,3");
+    assert(f() === "");
+
+    function strict(a) {
+        "use strict";
+        a = "not mapped";
+        return collect.apply(null, arguments);
+    }
+    assert(strict(1, 2) === "1,2");
+})();
+
+(function TestModifiedArguments() {
+    function shorter() {
+        arguments.length = 1;
+        return collect.apply(null, arguments);
+    }
+    assert(shorter(1, 2, 3) === "1");
+
+    function longer() {
+        arguments.length = 5;
+        return collect.apply(null, arguments);
+    }
+    assert(longer(1, 2) === "1,2,,,");
+
+    function deleted() {
+        delete arguments[1];
+        return collect.apply(null, arguments);
+    }
+    assert(deleted(1, 2, 3) === "1,,3");
+
+    function accessor() {
+        Object.defineProperty(arguments, "0", { get: function () { return "getter"; } });
+        return collect.apply(null, arguments);
+    }
+    assert(accessor(1, 2) === "getter,2");
+})();
+
+(function TestArrays() {
+    assert(collect.apply(null, [1, 2, 3]) === "1,2,3");
+
+    var holes = [1, , 3];
+    Array.prototype[1] = "proto";
+    assert(collect.apply(null, holes) === "1,proto,3");
+    delete Array.prototype[1];
+
+    var sparse = [];
+    sparse[100] = 1;
+    assert(count.apply(null, sparse) === 101);
+
+    var arrayLike = { length: 3, 0: "a", 2: "c" };
+    assert(collect.apply(null, arrayLike) === "a,,c");
+})();
+
+(function TestLargeArguments() {
+    // buffers of 512 bytes or more are not on the stack
+    var big = [];
+    for (var i = 0; i < 1000; i++) {
+        big.push(i);
+    }
+    function forward() {
+        arguments.length = 999;
+        return count.apply(null, arguments);
+    }
+    assert(count.apply(null, big) === 1000);
+    assert(forward.apply(null, big) === 999);
+})();
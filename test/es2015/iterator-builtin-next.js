@@ -0,0 +1,197 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+var kinds = [
+  { make: function() { return [1, 2, 3]; }, expected: ["1", "2", "3"] },
+  { make: function() { return "abc"; }, expected: ["a", "b", "c"] },
+  { make: function() { return new Map([[1, "a"], [2, "b"], [3, "c"]]); }, expected: ["1,a", "2,b", "3,c"] },
+  { make: function() { return new Set([1, 2, 3]); }, expected: ["1", "2", "3"] },
+];
+
+var consumers = [
+  function forOf(iterable) {
+    var result = [];
+    for (var v of iterable) {
+      result.push(v);
+    }
+    return result;
+  },
+  function spread(iterable) {
+    return [...iterable];
+  },
+  function spreadArguments(iterable) {
+    return (function() { return Array.prototype.slice.call(arguments); })(...iterable);
+  },
+  function destructuring(iterable) {
+    var [a, b, c] = iterable;
+    return [a, b, c];
+  },
+  function rest(iterable) {
+    var [a, ...rest] = iterable;
+    return [a].concat(rest);
+  },
+  function arrayFrom(iterable) {
+    return Array.from(iterable);
+  },
+  function setConstructor(iterable) {
+    var result = [];
+    new Set(iterable).forEach(function(v) { result.push(v); });
+    return result;
+  },
+];
+
+// harness does not iterate arrays, because iterator prototypes are patched while it runs
+function check(actual, expected) {
+  assert(actual.length === expected.length);
+  for (var i = 0; i < actual.length; i++) {
+    assert(String(actual[i]) === expected[i]);
+  }
+}
+
+function prefixed(prefix, expected) {
+  var result = [];
+  for (var i = 0; i < expected.length; i++) {
+    result.push(prefix + expected[i]);
+  }
+  return result;
+}
+
+function wrapNext(next, prefix) {
+  return function() {
+    var result = next.call(this);
+    if (!result.done) {
+      result.value = prefix + String(result.value);
+    }
+    return result;
+  };
+}
+
+function TestBuiltinNext(kind) {
+  for (var i = 0; i < consumers.length; i++) {
+    var consume = consumers[i];
+    check(consume(kind.make()), kind.expected);
+  }
+}
+
+function TestPatchedPrototypeNext(kind) {
+  var proto = Object.getPrototypeOf(kind.make()[Symbol.iterator]());
+  var next = proto.next;
+  proto.next = wrapNext(next, "p");
+  try {
+    for (var i = 0; i < consumers.length; i++) {
+      var consume = consumers[i];
+      check(consume(kind.make()), prefixed("p", kind.expected));
+    }
+  } finally {
+    proto.next = next;
+  }
+  TestBuiltinNext(kind);
+}
+
+function TestOwnNext(kind) {
+  var iterable = {};
+  iterable[Symbol.iterator] = function() {
+    var iterator = kind.make()[Symbol.iterator]();
+    iterator.next = wrapNext(iterator.next, "o");
+    return iterator;
+  };
+  for (var i = 0; i < consumers.length; i++) {
+    var consume = consumers[i];
+    check(consume(iterable), prefixed("o", kind.expected));
+  }
+  TestBuiltinNext(kind);
+}
+
+function TestAccessorNext(kind) {
+  var proto = Object.getPrototypeOf(kind.make()[Symbol.iterator]());
+  var descriptor = Object.getOwnPropertyDescriptor(proto, "next");
+  var wrapped = wrapNext(descriptor.value, "g");
+  var getCount = 0;
+  Object.defineProperty(proto, "next", { get: function() { getCount++; return wrapped; }, configurable: true });
+  try {
+    for (var i = 0; i < consumers.length; i++) {
+      var consume = consumers[i];
+      var before = getCount;
+      check(consume(kind.make()), prefixed("g", kind.expected));
+      assert(getCount > before);
+    }
+  } finally {
+    Object.defineProperty(proto, "next", descriptor);
+  }
+  TestBuiltinNext(kind);
+}
+
+// ES2015 IteratorStep reads next method on every step, so changes in the middle of iteration are seen
+function TestPatchDuringIteration(kind) {
+  var proto = Object.getPrototypeOf(kind.make()[Symbol.iterator]());
+  var next = proto.next;
+  var expected = [kind.expected[0]].concat(prefixed("m", kind.expected.slice(1)));
+
+  var result = [];
+  try {
+    for (var v of kind.make()) {
+      result.push(v);
+      if (result.length === 1) {
+        proto.next = wrapNext(next, "m");
+      }
+    }
+  } finally {
+    proto.next = next;
+  }
+  check(result, expected);
+
+  try {
+    result = Array.from(kind.make(), function(v, k) {
+      if (k === 0) {
+        proto.next = wrapNext(next, "m");
+      }
+      return v;
+    });
+  } finally {
+    proto.next = next;
+  }
+  check(result, expected);
+
+  var iterator = kind.make()[Symbol.iterator]();
+  var iterable = {};
+  iterable[Symbol.iterator] = function() { return iterator; };
+  result = [];
+  for (var v of iterable) {
+    result.push(v);
+    if (result.length === 1) {
+      iterator.next = wrapNext(next, "m");
+    }
+  }
+  check(result, expected);
+
+  iterator = kind.make()[Symbol.iterator]();
+  result = [];
+  for (var v of iterable) {
+    result.push(v);
+    Object.setPrototypeOf(iterator, { next: function() { return { done: true }; } });
+  }
+  check(result, [kind.expected[0]]);
+
+  TestBuiltinNext(kind);
+}
+
+for (var i = 0; i < kinds.length; i++) {
+  var kind = kinds[i];
+  TestBuiltinNext(kind);
+  TestPatchDuringIteration(kind);
+  TestPatchedPrototypeNext(kind);
+  TestOwnNext(kind);
+  TestAccessorNext(kind);
+}
@@ -0,0 +1,61 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+var log = [];
+
+function TestReactionThrowsInBatch() {
+  var p = Promise.resolve(1);
+  p.then(function(v) { log.push("a" + v); });
+  p.then(function(v) { log.push("b" + v); throw new Error("b"); }).catch(function(e) {
+    assert(e instanceof Error);
+    assert(e.message === "b");
+    assert(typeof e.stack === "string");
+    log.push("catch-b");
+  });
+  p.then(function(v) { log.push("c" + v); throw 42; }).then(function() {
+    log.push("not reached");
+  }, function(e) {
+    assert(e === 42);
+    log.push("catch-c");
+  });
+  p.then(function(v) { log.push("d" + v); });
+}
+
+function TestThenableResolveThrowsInBatch() {
+  var p = Promise.resolve(2);
+  var thenable = {};
+  Object.defineProperty(thenable, "then", { get: function() { throw new TypeError("then"); } });
+  p.then(function() { return thenable; }).catch(function(e) {
+    assert(e instanceof TypeError);
+    log.push("catch-then");
+  });
+  p.then(function(v) { log.push("e" + v); });
+}
+
+TestReactionThrowsInBatch();
+TestThenableResolveThrowsInBatch();
+
+var expected = "a1,b1,c1,d1,e2,catch-b,catch-c,catch-then";
+
+function check() {
+  assert(log.join() === expected);
+}
+
+if (typeof drainJobQueue === "function") {
+  drainJobQueue();
+  check();
+} else {
+  Promise.resolve().then(function() {}).then(function() {}).then(check);
+}
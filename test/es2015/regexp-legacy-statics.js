@@ -0,0 +1,66 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// right context starts at the end of the whole match, not at the end of the last capture group
+function checkContexts(input, left, match, right) {
+    assert(RegExp.leftContext === left);
+    assert(RegExp["$`"] === left);
+    assert(RegExp.lastMatch === match);
+    assert(RegExp["$&"] === match);
+    assert(RegExp.rightContext === right);
+    assert(RegExp["$'"] === right);
+    assert(RegExp.leftContext + RegExp.lastMatch + RegExp.rightContext === input);
+}
+
+// exec: the last group ends before the match does
+var m = /(a)b/.exec("xaby");
+assert(m[0] === "ab" && m[1] === "a");
+checkContexts("xaby", "x", "ab", "y");
+assert(RegExp.$1 === "a");
+assert(RegExp.lastParen === "a");
+
+// several groups, the last matched group ends in the middle of the match
+/(\d+)-(\d+)[a-z]+/.exec("id 12-34abc tail");
+checkContexts("id 12-34abc tail", "id ", "12-34abc", " tail");
+assert(RegExp.$1 === "12" && RegExp.$2 === "34");
+assert(RegExp.lastParen === "34");
+
+// the last group does not participate, so the last matched group is an earlier one
+/(p)(q)?rs/.exec("_prs_");
+checkContexts("_prs_", "_", "prs", "_");
+assert(RegExp.$1 === "p" && RegExp.$2 === "");
+assert(RegExp.lastParen === "");
+
+// lookahead group ends after the match
+/(a)(?=(bc))/.exec("zabcd");
+checkContexts("zabcd", "z", "a", "bcd");
+assert(RegExp.$2 === "bc");
+
+// test and exec of the same pattern agree
+var r = /(o)o+/;
+r.test("foooo!");
+checkContexts("foooo!", "f", "oooo", "!");
+r.exec("foooo!");
+checkContexts("foooo!", "f", "oooo", "!");
+
+// String.prototype.match and replace record the same contexts
+"key=value;".match(/(\w+)=/);
+checkContexts("key=value;", "", "key=", "value;");
+"aXbXc".replace(/(X)b/, "-");
+checkContexts("aXbXc", "a", "Xb", "Xc");
+
+// global matching leaves the contexts of the last match
+"1a2b3c".replace(/(\d)[a-z]/g, "");
+checkContexts("1a2b3c", "1a2b", "3c", "");
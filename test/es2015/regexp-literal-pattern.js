@@ -0,0 +1,96 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// patterns without regex syntax are matched by String::find instead of the yarr interpreter
+// results should be the same as the interpreter gives
+
+(function TestEscapedSlash() {
+    var fromLiteral = /a\/b/;
+    var fromString = new RegExp("a/b");
+    assert(fromLiteral.source === "a\\/b");
+    assert(fromString.source === "a\\/b");
+    assert(fromLiteral.exec("xxa/b")[0] === "a/b");
+    assert(fromString.exec("xxa/b").index === 2);
+    assert(fromString.exec("a\\/b") === null);
+    assert("1/2/3".replace(new RegExp("/", "g"), "-") === "1-2-3");
+})();
+
+(function TestEmptySource() {
+    var empty = new RegExp("");
+    assert(empty.source === "(?:)");
+    assert(empty.test(""));
+    assert(empty.exec("abc").index === 0);
+    assert(empty.exec("abc")[0] === "");
+    assert("abc".replace(new RegExp("", "g"), "-") === "-a-b-c-");
+    assert("abc".split(new RegExp("")).join() === "a,b,c");
+
+    var emptyGlobal = new RegExp("", "g");
+    emptyGlobal.lastIndex = 2;
+    assert(emptyGlobal.exec("abc").index === 2);
+    assert(emptyGlobal.lastIndex === 2);
+})();
+
+(function TestGlobalLastIndex() {
+    var re = /ab/g;
+    var str = "xabyab";
+    var m = re.exec(str);
+    assert(m.index === 1 && re.lastIndex === 3);
+    m = re.exec(str);
+    assert(m.index === 4 && re.lastIndex === 6);
+    assert(re.exec(str) === null);
+    assert(re.lastIndex === 0);
+
+    re.lastIndex = 2;
+    assert(re.test(str));
+    assert(re.lastIndex === 6);
+    re.lastIndex = 7;
+    assert(!re.test(str));
+    assert(re.lastIndex === 0);
+
+    assert(str.match(/ab/g).join() === "ab,ab");
+    assert(str.replace(/ab/g, "c") === "xcyc");
+})();
+
+(function TestStickyLastIndex() {
+    var re = /ab/y;
+    var str = "ababx";
+    var m = re.exec(str);
+    assert(m.index === 0 && re.lastIndex === 2);
+    m = re.exec(str);
+    assert(m.index === 2 && re.lastIndex === 4);
+    assert(re.exec(str) === null);
+    assert(re.lastIndex === 0);
+
+    re.lastIndex = 2;
+    assert(re.test(str));
+    assert(re.lastIndex === 4);
+    re.lastIndex = 6;
+    assert(!re.test(str));
+    assert(re.lastIndex === 0);
+
+    var nonSticky = /ab/;
+    nonSticky.lastIndex = 2;
+    assert(nonSticky.exec(str).index === 0);
+    assert(nonSticky.lastIndex === 2);
+})();
+
+(function TestNonLiteralNeighbours() {
+    // one syntax character makes the pattern go to the interpreter
+    assert(/a.c/.exec("xabc").index === 1);
+    assert(/ab?c/.exec("xac").index === 1);
+    assert(/AB/i.exec("xab").index === 1);
+    assert(/가나/.exec("다가나").index === 1);
+    assert(/😀/.exec("a😀").index === 1);
+})();
@@ -0,0 +1,63 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// a regexp literal keeps its compiled pattern at the literal site,
+// but every evaluation must still create a new object
+function literal() {
+    return /ab+c/g;
+}
+
+var first = literal();
+var second = literal();
+assert(first !== second);
+assert(first.source === "ab+c" && second.source === "ab+c");
+assert(first.global && second.global && !first.ignoreCase && !first.multiline);
+
+// lastIndex and own properties are not shared through the literal site
+assert(first.exec("xabbc abc") !== null);
+assert(first.lastIndex === 5);
+assert(second.lastIndex === 0);
+first.custom = 1;
+assert(second.custom === undefined);
+assert(literal().custom === undefined);
+assert(literal().lastIndex === 0);
+
+// objects created in a loop are distinct and start from a fresh lastIndex
+var objects = [];
+for (var i = 0; i < 10; i++) {
+    var r = /x(y)?/gi;
+    assert(r.lastIndex === 0);
+    assert(r.test("aXy"));
+    assert(r.lastIndex === 3);
+    objects.push(r);
+}
+for (var i = 0; i < objects.length; i++) {
+    for (var j = i + 1; j < objects.length; j++) {
+        assert(objects[i] !== objects[j]);
+    }
+}
+
+// a literal with the same source as an explicitly constructed regexp behaves the same
+var constructed = new RegExp("ab+c", "g");
+assert(constructed !== literal());
+assert(String(constructed) === String(literal()));
+assert("abc abbc".replace(literal(), "-") === "abc abbc".replace(constructed, "-"));
+
+// literal site still works after compile() replaces the pattern of an object it created
+var compiled = literal();
+compiled.compile("z+");
+assert(compiled.source === "z+");
+assert(literal().source === "ab+c");
+assert(literal().test("abbc"));
@@ -0,0 +1,142 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the interpreter only starts at candidates found from pattern source: a prefix, a required literal,
+// or a set of first characters. a wrong candidate drops matches, so these compare with expected results
+
+function matchIndexes(re, input) {
+    var result = [];
+    var m;
+    re.lastIndex = 0;
+    while ((m = re.exec(input)) !== null) {
+        result.push(m.index + ":" + m[0]);
+        if (m[0] === "") {
+            re.lastIndex++;
+        }
+    }
+    return result.join(",");
+}
+
+(function TestAnnexBBraces() {
+    // braces which are not quantifiers are literal characters
+    assert(/{a/.exec("x{a").index === 1);
+    assert(/a{/.exec("aa{")[0] === "a{");
+    assert(/a{/.exec("aa{").index === 1);
+    assert(/a{2/.exec("aa{2").index === 1);
+    assert(/a{,3}/.exec("aaa{,3}").index === 2);
+    assert(/x}y/.exec("x}x}y").index === 2);
+    assert(/a{2}b/.exec("abaab").index === 2);
+    assert(/a{0}b/.exec("aab").index === 2);
+    assert(/a{0}b/.exec("aab")[0] === "b");
+    assert(/ba{0,1}c/.exec("bbc").index === 1);
+    assert(/a{2}?x/.exec("aaax").index === 1);
+    assert(matchIndexes(/b{1,}c/g, "bc bbc c") === "0:bc,3:bbc");
+})();
+
+(function TestFirstCharacterClass() {
+    // annex B: \d cannot start a range, so - and z are also members
+    var re = /[\d-z]x/g;
+    assert(matchIndexes(re, "ax 5x -x zx yx") === "3:5x,6:-x,9:zx");
+    assert(/[\d-z]/.exec("a-").index === 1);
+    assert(/[a-]b/.exec("x-b").index === 1);
+    assert(/[-a]b/.exec("x-b").index === 1);
+    assert(/[\-a]b/.exec("x-b").index === 1);
+    assert(/[\.-0]b/.exec("x/b").index === 1);
+    assert(/[c-e]z/.exec("az bz dz").index === 6);
+    // escapes which are not a single character
+    assert(/[\w]b/.exec("-b _b").index === 3);
+    assert(/[\s]b/.exec("ab b").index === 2);
+    assert(/[\b]b/.exec("ab\bb").index === 2);
+    assert(/[\D]1/.exec("11a1").index === 2);
+    // negated and empty classes
+    assert(/[^a]b/.exec("abab cb").index === 5);
+    assert(/[]a/.exec("aaa") === null);
+    assert(/[^]a/.exec("\na").index === 0);
+    // characters out of Latin1 range
+    assert(/[\u0100a]b/.exec("x\u0100b").index === 1);
+    assert(/[\u00e9-\u00ea]b/.exec("x\u00eab").index === 1);
+    // more first characters than are scanned one by one
+    assert(/[a-z]9/.exec("AZ z9").index === 3);
+    assert(/[abcde]9/.exec("e8 d9").index === 3);
+    assert(/[xy]9/.exec("y8x9").index === 2);
+    assert(/[xy]9/.exec("\u0100y8x9").index === 3);
+    assert(/\d:/.exec("a1 2:").index === 3);
+    assert(/\d:/.exec("\u0100a1 2:").index === 4);
+})();
+
+(function TestQuantifiedFirstAtom() {
+    // a first atom which can be skipped does not give first characters
+    assert(/a*b/.exec("xb").index === 1);
+    assert(/a*b/.exec("xb")[0] === "b");
+    assert(/a?bc/.exec("bc").index === 0);
+    assert(/[xy]*z/.exec("az").index === 1);
+    assert(/[xy]?z/.exec("xz").index === 0);
+    assert(/\d*x/.exec("ax")[0] === "x");
+    assert(/\d?x/.exec("1x")[0] === "1x");
+    assert(/(ab)?c/.exec("xc").index === 1);
+    assert(/a{0,2}c/.exec("xc").index === 1);
+    assert(/a*?b/.exec("aab")[0] === "aab");
+    // required ones keep them
+    assert(/a+b/.exec("xaab").index === 1);
+    assert(/a+b/.exec("xaab")[0] === "aab");
+    assert(/[xy]+z/.exec("ayxz").index === 1);
+    assert(/\d+x/.exec("a12x")[0] === "12x");
+    assert(/a{2,}b/.exec("ab aab").index === 3);
+    assert(matchIndexes(/a+/g, "baab aaa") === "1:aa,5:aaa");
+})();
+
+(function TestAlternation() {
+    // top level alternatives do not share a prefix or a required literal
+    assert(/ab|cd/.exec("xcd").index === 1);
+    assert(/ab|cd/.exec("xcd")[0] === "cd");
+    assert(/abc|x/.exec("abx").index === 2);
+    assert(/a|/.exec("b").index === 0);
+    assert(/|a/.exec("a")[0] === "");
+    assert(matchIndexes(/foo|ba+r/g, "bar foo baar") === "0:bar,4:foo,8:baar");
+    // escaped or grouped alternatives are not at top level
+    assert(/a\|b/.exec("a|b ab").index === 0);
+    assert(/a\|b/.exec("ab") === null);
+    assert(/[|]b/.exec("a|b").index === 1);
+    assert(/x(a|b)y/.exec("xay xby").index === 0);
+    assert(/x(a|b)y/.exec("xc xby").index === 3);
+    assert(/(a|bc)d/.exec("bcd").index === 0);
+})();
+
+(function TestIgnoreCase() {
+    // ignoreCase changes meaning of every character in the source
+    assert(/abc/i.exec("xABC").index === 1);
+    assert(/a+b/i.exec("xAAB")[0] === "AAB");
+    assert(/[a-c]z/i.exec("xBZ").index === 1);
+    assert(/\u00e9t\u00e9/i.exec("\u00c9T\u00c9").index === 0);
+    assert(/x[yz]/i.exec("XZ")[0] === "XZ");
+    assert(matchIndexes(/ab/gi, "Ab aB AB") === "0:Ab,3:aB,6:AB");
+    assert("ABC".replace(/b/i, "-") === "A-C");
+})();
+
+(function TestOtherAtoms() {
+    // atoms which end a prefix or a required literal
+    assert(/^ab/.exec("ab").index === 0);
+    assert(/^ab/.exec("xab") === null);
+    assert(/^ab/m.exec("x\nab").index === 2);
+    assert(/a.c/.exec("xabc").index === 1);
+    assert(/a$/.exec("aba").index === 2);
+    assert(/\bfoo/.exec("xfoo foo").index === 5);
+    assert(/(a)\1b/.exec("xaab").index === 1);
+    assert(/\x41b/.exec("xAb").index === 1);
+    assert(/\u0041b/.exec("xAb").index === 1);
+    assert(/(?=ab)a/.exec("xab").index === 1);
+    assert(/(?!ab)a/.exec("abac").index === 2);
+    assert(/a\/b/.exec("xa/b").index === 1);
+})();
@@ -0,0 +1,67 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// ropes deeper than ROPE_STRING_MAX_DEPTH are rebalanced instead of being flattened
+
+function pieceOf(i) {
+    return (i % 3 == 0 ? "가" : "") + "p" + i + ";";
+}
+
+(function TestAppendAndPrependKeepOrder() {
+    var rope = "begin-of-the-rope-string-";
+    var parts = [rope];
+    for (var i = 0; i < 3000; i++) {
+        if (i % 5 == 0) {
+            var prefix = "prefix-longer-than-min-length-" + i;
+            rope = prefix + rope;
+            parts.unshift(prefix);
+        } else {
+            rope += pieceOf(i);
+            parts.push(pieceOf(i));
+        }
+
+        if (i % 250 == 0) {
+            // read without flattening
+            assert(rope.startsWith(parts[0]));
+            assert(rope.endsWith(parts[parts.length - 1]));
+        }
+    }
+
+    var flat = parts.join("");
+    assert(rope.length === flat.length);
+    for (var i = 0; i < flat.length; i += 97) {
+        assert(rope.charCodeAt(i) === flat.charCodeAt(i));
+    }
+    assert(rope.endsWith(parts[parts.length - 3] + parts[parts.length - 2] + parts[parts.length - 1]));
+    assert(rope.startsWith(parts[0] + parts[1] + parts[2]));
+    assert(!rope.endsWith("x" + parts[parts.length - 1]));
+    assert(rope.startsWith(flat.substring(1000, 1200), 1000));
+    assert(!rope.startsWith(flat.substring(1000, 1200), 1001));
+    assert(rope === flat);
+})();
+
+(function TestDeepRopeCharAt() {
+    var s = "";
+    for (var i = 0; i < 100000; i++) {
+        s += "ACGTACGTAC";
+        if (i % 10000 == 0) {
+            assert(s.charCodeAt(0) === 65);
+            assert(s.charCodeAt(s.length - 1) === 67);
+        }
+    }
+    assert(s.length === 1000000);
+    assert(s.endsWith("GTACACGTACGTAC"));
+    assert(s.charAt(500005) === "C");
+})();
@@ -0,0 +1,182 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+function argumentsOf() {
+  return Array.prototype.slice.call(arguments);
+}
+
+function assertElements(actual, expected) {
+  assert(actual.length === expected.length);
+  for (var i = 0; i < expected.length; i++) {
+    assert(actual[i] === expected[i]);
+  }
+}
+
+function TestHoles() {
+  var a = [1, , 3];
+  var b = [...a];
+  assertElements(b, [1, undefined, 3]);
+  assert(1 in b);
+  assertElements(argumentsOf(...a), [1, undefined, 3]);
+  assertElements(argumentsOf(0, ...[, ], 2), [0, undefined, 2]);
+  assertElements(new Array(...[, , 4]), [undefined, undefined, 4]);
+}
+
+function TestElisions() {
+  var a = [1, 2];
+  var b = [3];
+  var c = [...a, , ...b];
+  assert(c.length === 4);
+  assertElements(c, [1, 2, undefined, 3]);
+  assert(!(2 in c));
+
+  var d = [...a, , ];
+  assert(d.length === 3);
+  assert(!(2 in d));
+
+  var e = [, ...a, , , ];
+  assert(e.length === 5);
+  assert(!(0 in e));
+  assert(e[1] === 1 && e[2] === 2);
+  assert(!(3 in e) && !(4 in e));
+
+  assertElements([...[], , ...[]], [undefined]);
+  assert([...[], , ...[]].length === 1);
+}
+
+function TestHoleReadThroughPrototype() {
+  var objectPrototype = Object.getPrototypeOf(Array.prototype);
+  var reads = [];
+  var proxy = new Proxy({}, {
+    get: function(target, key, receiver) {
+      if (typeof key === "string") {
+        reads.push(key);
+      }
+      return key === "1" ? 100 : undefined;
+    },
+    has: function(target, key) {
+      return key === "1";
+    }
+  });
+  Object.setPrototypeOf(Array.prototype, proxy);
+  try {
+    var a = [0, , 2];
+    assertElements([...a], [0, 100, 2]);
+    assertElements(argumentsOf(...a), [0, 100, 2]);
+    assertElements(argumentsOf.apply(null, a), [0, 100, 2]);
+    assert(Math.max.apply(null, [1, , 3]) === 100);
+  } finally {
+    Object.setPrototypeOf(Array.prototype, objectPrototype);
+  }
+  assert(reads.indexOf("1") !== -1);
+}
+
+function TestPatchedArrayIterator() {
+  var values = Array.prototype[Symbol.iterator];
+  Array.prototype[Symbol.iterator] = function() {
+    var done = false;
+    return {
+      next: function() {
+        var result = { value: "patched", done: done };
+        done = true;
+        return result;
+      }
+    };
+  };
+  try {
+    assertElements([...[1, 2]], ["patched"]);
+    assertElements(argumentsOf(...[1, 2]), ["patched"]);
+    assertElements(new Array(...[1, 2]), ["patched"]);
+  } finally {
+    Array.prototype[Symbol.iterator] = values;
+  }
+  assertElements([...[1, 2]], [1, 2]);
+}
+
+function TestPatchedArrayIteratorNext() {
+  var arrayIteratorPrototype = Object.getPrototypeOf([][Symbol.iterator]());
+  var next = arrayIteratorPrototype.next;
+  arrayIteratorPrototype.next = function() {
+    var result = next.call(this);
+    if (!result.done) {
+      result.value *= 10;
+    }
+    return result;
+  };
+  try {
+    var a = [1, 2];
+    var b = [...a];
+    assert(b.length === 2 && b[0] === 10 && b[1] === 20);
+    var c = argumentsOf(...a);
+    assert(c.length === 2 && c[0] === 10 && c[1] === 20);
+  } finally {
+    arrayIteratorPrototype.next = next;
+  }
+  assertElements([...[1, 2]], [1, 2]);
+}
+
+function TestSubclassedArray() {
+  class MyArray extends Array {
+    [Symbol.iterator]() {
+      var array = this;
+      var i = 0;
+      return {
+        next: function() {
+          return i < array.length ? { value: array[i++] * 2, done: false } : { value: undefined, done: true };
+        }
+      };
+    }
+  }
+  var a = MyArray.from([1, 2, 3]);
+  assert(a instanceof MyArray);
+  assertElements([...a], [2, 4, 6]);
+  assertElements(argumentsOf(...a), [2, 4, 6]);
+  assertElements(argumentsOf.apply(null, a), [1, 2, 3]);
+
+  class PlainArray extends Array {
+  }
+  var b = PlainArray.of(1, 2, 3);
+  b.length = 4;
+  assertElements([...b], [1, 2, 3, undefined]);
+  assertElements(argumentsOf(...b), [1, 2, 3, undefined]);
+  assertElements(argumentsOf.apply(null, b), [1, 2, 3, undefined]);
+}
+
+function TestMathMaxApplyWithHoles() {
+  assert(isNaN(Math.max.apply(null, [1, , 3])));
+  assert(isNaN(Math.min.apply(null, [, 1])));
+  assert(Math.max.apply(null, [1, 5, 3]) === 5);
+  var sparse = [];
+  sparse[3] = 7;
+  assert(isNaN(Math.max.apply(null, sparse)));
+  assert(Math.max(...[4, 9, 2]) === 9);
+  assert(isNaN(Math.max(...[4, , 2])));
+}
+
+function TestManyArguments() {
+  var a = [16, 17];
+  var result = argumentsOf(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, ...a);
+  assert(result.length === 18);
+  assert(result[16] === 16 && result[17] === 17);
+}
+
+TestHoles();
+TestElisions();
+TestHoleReadThroughPrototype();
+TestPatchedArrayIterator();
+TestPatchedArrayIteratorNext();
+TestSubclassedArray();
+TestMathMaxApplyWithHoles();
+TestManyArguments();
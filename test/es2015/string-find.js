@@ -0,0 +1,174 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// String::find scans for the first character of short needles, and uses Horspool for longer needles in long haystacks
+// results are compared with a naive search for 8-bit and 16-bit haystacks and needles,
+// needle lengths around the Horspool threshold(8) and haystack lengths around 256
+
+function naiveIndexOf(haystack, needle, pos) {
+    for (var i = pos; i + needle.length <= haystack.length; i++) {
+        var j = 0;
+        while (j < needle.length && haystack.charCodeAt(i + j) === needle.charCodeAt(j)) {
+            j++;
+        }
+        if (j === needle.length) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+function naiveLastIndexOf(haystack, needle) {
+    for (var i = haystack.length - needle.length; i >= 0; i--) {
+        if (haystack.substring(i, i + needle.length) === needle) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// substrings longer than 32 characters are views of the original buffer, so this keeps a 16-bit buffer
+function wide(s) {
+    return ("\u0100" + s).substring(1);
+}
+
+var seed = 7;
+function random(n) {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    return seed % n;
+}
+
+// small alphabets give many partial matches
+function makeString(length, alphabet) {
+    var s = "";
+    for (var i = 0; i < length; i++) {
+        s += alphabet[random(alphabet.length)];
+    }
+    return s;
+}
+
+function checkFind(haystack, needle) {
+    var positions = [0, 1, haystack.length >> 1, haystack.length - needle.length, haystack.length];
+    for (var k = 0; k < positions.length; k++) {
+        var pos = Math.max(0, positions[k]);
+        assert(haystack.indexOf(needle, pos) === naiveIndexOf(haystack, needle, pos));
+    }
+    assert(haystack.includes(needle) === (naiveIndexOf(haystack, needle, 0) !== -1));
+    assert(haystack.lastIndexOf(needle) === naiveLastIndexOf(haystack, needle));
+}
+
+function needlesOf(haystack) {
+    var needles = [];
+    for (var length = 1; length <= 20; length++) {
+        var at = random(haystack.length - length);
+        var found = haystack.substring(at, at + length);
+        needles.push(found);
+        // last character changed, so Horspool compares almost the whole needle before it moves on
+        needles.push(found.substring(0, length - 1) + (found[length - 1] === "a" ? "b" : "a"));
+        needles.push(haystack.substring(haystack.length - length));
+    }
+    return needles;
+}
+
+(function TestLatin1HaystackAndNeedle() {
+    for (var length = 240; length <= 272; length += 4) {
+        var haystack = makeString(length, "aab");
+        var needles = needlesOf(haystack);
+        for (var i = 0; i < needles.length; i++) {
+            checkFind(haystack, needles[i]);
+        }
+    }
+})();
+
+(function TestWideHaystack() {
+    // 16-bit haystack with Latin1 content, and 8-bit needles
+    for (var length = 240; length <= 272; length += 4) {
+        var haystack = makeString(length, "aab\u00e9");
+        var wideHaystack = wide(haystack);
+        var needles = needlesOf(haystack);
+        for (var i = 0; i < needles.length; i++) {
+            checkFind(wideHaystack, needles[i]);
+            assert(wideHaystack.indexOf(needles[i]) === haystack.indexOf(needles[i]));
+        }
+    }
+
+    // 16-bit haystack and needles with characters out of Latin1
+    for (var length = 240; length <= 272; length += 8) {
+        var haystack = makeString(length, "aab\u0161");
+        var needles = needlesOf(haystack);
+        for (var i = 0; i < needles.length; i++) {
+            checkFind(haystack, needles[i]);
+        }
+    }
+})();
+
+(function TestWideNeedle() {
+    // 16-bit needles are never found in 8-bit haystack unless they are Latin1 content
+    var haystack = makeString(300, "aab");
+    for (var length = 1; length <= 20; length++) {
+        var needle = haystack.substring(100, 100 + length - 1) + "\u0100";
+        checkFind(haystack, needle);
+        assert(haystack.indexOf(needle) === -1);
+    }
+    // long needles of Latin1 content in a 16-bit buffer
+    for (var length = 33; length <= 40; length++) {
+        var needle = wide(haystack.substring(150, 150 + length));
+        checkFind(haystack, needle);
+        assert(haystack.indexOf(needle) <= 150);
+    }
+})();
+
+(function TestSkipTableLowByte() {
+    // skip table is indexed by low byte, so \u0161 and 'a' share an entry
+    var needle = "bbbbbbb\u0161";
+    var haystack = "";
+    for (var i = 0; i < 300; i++) {
+        haystack += i % 37 ? "a" : "b";
+    }
+    haystack += needle + "a";
+    checkFind(haystack, needle);
+    assert(haystack.indexOf(needle) === 300);
+    checkFind(haystack, "bbbbbbba");
+    checkFind(haystack, "abbbbbbb\u0161a");
+    checkFind(wide(haystack), "a\u0161a");
+})();
+
+(function TestHaystackLengthFromPosition() {
+    // haystack length counted from the position decides Horspool, so the same search runs both ways
+    var haystack = makeString(600, "ab") + "abababbaabab";
+    var needle = "abababbaabab";
+    for (var pos = 0; pos <= haystack.length; pos += 37) {
+        assert(haystack.indexOf(needle, pos) === naiveIndexOf(haystack, needle, pos));
+    }
+    for (var pos = 330; pos <= 360; pos++) {
+        assert(haystack.indexOf(needle, pos) === naiveIndexOf(haystack, needle, pos));
+    }
+})();
+
+(function TestSplitAndReplace() {
+    var haystack = makeString(400, "ab,");
+    var separators = [",", "a,", ",b,a", "ab,ba,ab", "aaaaaaaaa"];
+    for (var i = 0; i < separators.length; i++) {
+        var parts = haystack.split(separators[i]);
+        assert(parts.join(separators[i]) === haystack);
+        for (var j = 0; j < parts.length; j++) {
+            assert(parts[j].indexOf(separators[i]) === -1);
+        }
+        assert(wide(haystack).split(separators[i]).join() === parts.join());
+        var index = haystack.indexOf(separators[i]);
+        var replaced = haystack.replace(separators[i], "#");
+        assert(index === -1 ? replaced === haystack : replaced === haystack.substring(0, index) + "#" + haystack.substring(index + separators[i].length));
+    }
+})();
@@ -0,0 +1,69 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// equal strings must hash equally whether they are stored in 8-bit or 16-bit buffers, flat or as ropes
+// substrings longer than 32 characters are views of the original buffer, so these keep 16-bit buffers
+function wide(s) {
+    return ("\u0100" + s).substring(1);
+}
+
+function makeKey(i) {
+    var s = "key" + i + "_\u00e9_";
+    // lengths 33 to 48 cover every tail length of 8 character blocks
+    while (s.length < 33 + i % 16) {
+        s += String.fromCharCode(97 + s.length % 26);
+    }
+    return s;
+}
+
+var keys = [];
+var o = {};
+var map = new Map();
+for (var i = 0; i < 200; i++) {
+    keys.push(makeKey(i));
+    o[keys[i]] = i;
+    map.set(keys[i], i);
+}
+
+for (var i = 0; i < keys.length; i++) {
+    var key = keys[i];
+    var wideKey = wide(key);
+    var ropeKey = wide(key.substring(0, 33)) + key.substring(33);
+    var ropeKey8 = key.substring(0, 10) + key.substring(10);
+
+    assert(wideKey === key);
+    assert(o[wideKey] === i);
+    assert(o[ropeKey] === i);
+    assert(o[ropeKey8] === i);
+    assert(o.hasOwnProperty(wideKey));
+    assert(map.get(wideKey) === i);
+    assert(map.get(ropeKey) === i);
+}
+
+// keys defined with 16-bit strings are found with 8-bit ones
+var p = {};
+for (var i = 0; i < keys.length; i++) {
+    p[wide(keys[i])] = i;
+}
+for (var i = 0; i < keys.length; i++) {
+    assert(p[keys[i]] === i);
+    assert(Object.getOwnPropertyDescriptor(p, keys[i]).value === i);
+}
+assert(Object.keys(p).length === keys.length);
+
+// strings with characters out of latin1 are not equal to their 8-bit truncation
+var q = {};
+q["\u0161" + keys[0].substring(1)] = 1;
+assert(q[keys[0]] === undefined);
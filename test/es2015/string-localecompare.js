@@ -0,0 +1,117 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// with ICU, localeCompare compares ASCII strings with a weight table instead of calling ICU
+// results of the table should be same as ICU collation
+
+function sign(n) {
+    return n < 0 ? -1 : (n > 0 ? 1 : 0);
+}
+
+// code unit comparison puts "B" before "a", so this is false without ICU
+var hasICU = "a".localeCompare("B") < 0;
+var hasIntl = typeof Intl !== "undefined";
+
+(function TestKnownOrders() {
+    if (!hasICU) {
+        return;
+    }
+    // case: lower case comes first at tertiary level, but primary difference wins
+    assert("a".localeCompare("A") < 0);
+    assert("A".localeCompare("b") < 0);
+    assert("ab".localeCompare("Ab") < 0);
+    assert("Ab".localeCompare("ac") < 0);
+    // punctuation and spaces come before digits and digits before letters
+    assert(" ".localeCompare("_") < 0);
+    assert("_".localeCompare("-") < 0);
+    assert("-".localeCompare(",") < 0);
+    assert("!".localeCompare("0") < 0);
+    assert("9".localeCompare("a") < 0);
+    // digits are not numeric
+    assert("10".localeCompare("9") < 0);
+    assert("item10".localeCompare("item9") < 0);
+    // prefix is smaller
+    assert("abc".localeCompare("abcd") < 0);
+    assert("abcd".localeCompare("abc") > 0);
+    assert("".localeCompare("a") < 0);
+    assert("".localeCompare("") === 0);
+    assert("same".localeCompare("same") === 0);
+    // control characters are ignorable
+    assert("a\u0001b".localeCompare("ab") === 0);
+    // primary difference after a tertiary difference
+    assert("Ab".localeCompare("ac") < 0);
+    assert("aB".localeCompare("ab") > 0);
+})();
+
+(function TestAgreesWithCollator() {
+    if (!hasICU || !hasIntl) {
+        return;
+    }
+    var collator = new Intl.Collator();
+    var alphabet = " !\"#$%&'()*+,-./0123456789:;<=>?@ABCZ[\\]^_`abcz{|}~\u0001\t";
+    var seed = 1;
+    function random(n) {
+        seed = (seed * 1103515245 + 12345) % 2147483648;
+        return seed % n;
+    }
+    function randomString() {
+        var length = random(6);
+        var s = "";
+        for (var i = 0; i < length; i++) {
+            s += alphabet[random(alphabet.length)];
+        }
+        return s;
+    }
+    for (var i = 0; i < 5000; i++) {
+        var a = randomString();
+        var b = random(3) == 0 ? a + randomString() : randomString();
+        // options makes localeCompare call ICU
+        var expected = sign(collator.compare(a, b));
+        assert(sign(a.localeCompare(b)) === expected);
+        assert(sign(a.localeCompare(b, undefined, {})) === expected);
+    }
+})();
+
+(function TestLocaleArgument() {
+    if (!hasICU || !hasIntl) {
+        return;
+    }
+    // collator of locale string is cached between calls
+    for (var i = 0; i < 3; i++) {
+        assert("a".localeCompare("B", "en") < 0);
+        assert("ä".localeCompare("z", "de") < 0);
+        assert("ä".localeCompare("z", "sv") > 0);
+        assert("a".localeCompare("A", "en", { sensitivity: "base" }) === 0);
+        assert("a".localeCompare("A", "en") !== 0);
+        assert("item10".localeCompare("item9", "en", { numeric: true }) > 0);
+        assert("item10".localeCompare("item9", "en") < 0);
+    }
+})();
+
+(function TestSortWithCollator() {
+    if (!hasICU || !hasIntl) {
+        return;
+    }
+    var words = ["banana", "Apple", "apple", "_under", "10", "9", "cherry", "Banana", "a-b", "ab", 3, "", "Zeta"];
+    var byCollator = words.slice().sort(new Intl.Collator().compare);
+    var byLocaleCompare = words.slice().sort(function (a, b) {
+        return String(a).localeCompare(String(b));
+    });
+    assert(byCollator.join() === byLocaleCompare.join());
+    assert(byCollator.join() === ",_under,10,3,9,a-b,ab,apple,Apple,banana,Banana,cherry,Zeta");
+
+    var numeric = ["10", "9", "100", "1"].sort(new Intl.Collator(undefined, { numeric: true }).compare);
+    assert(numeric.join() === "1,9,10,100");
+})();